@@ -38,6 +38,7 @@
 #include "ndtypes.h"
 #include "xnd.h"
 #include "gumath.h"
+#include "cache.h"
 
 
 /* flags that apply to all arguments */
@@ -90,6 +91,27 @@ opt_safe(int outer, ndt_context_t *ctx)
     return true;
 }
 
+/*
+ * Bring the NA counts of the input bitmaps up to date, so that the kernels
+ * can skip the validity work for inputs without NA values.  The counts of
+ * the outputs are invalidated before the kernels run and the kernels do not
+ * write them, which allows running the kernels concurrently.
+ */
+void
+gm_prepare_bitmaps(const gm_kernel_t *kernel, xnd_t stack[])
+{
+    const int64_t nin = kernel->set->sig->Function.nin;
+    const int64_t nargs = kernel->set->sig->Function.nargs;
+
+    for (int64_t i = 0; i < nin; i++) {
+        (void)xnd_bitmap_count_na(&stack[i].bitmap);
+    }
+
+    for (int64_t i = nin; i < nargs; i++) {
+        xnd_bitmap_invalidate(&stack[i].bitmap);
+    }
+}
+
 int
 gm_apply(const gm_kernel_t *kernel, xnd_t stack[], int outer_dims,
          ndt_context_t *ctx)
@@ -102,7 +124,7 @@ gm_apply(const gm_kernel_t *kernel, xnd_t stack[], int outer_dims,
             return -1;
         }
 
-        return gm_xnd_map(kernel->set->OptC, stack, nargs, outer_dims-1, ctx);
+        return gm_xnd_map_1D(kernel->set->OptC, stack, nargs, outer_dims-1, ctx);
     }
 
     case OPT_Z: {
@@ -110,7 +132,7 @@ gm_apply(const gm_kernel_t *kernel, xnd_t stack[], int outer_dims,
             return -1;
         }
 
-        return gm_xnd_map(kernel->set->OptZ, stack, nargs, outer_dims-1, ctx);
+        return gm_xnd_map_1D(kernel->set->OptZ, stack, nargs, outer_dims-1, ctx);
     }
 
     case OPT_S: {
@@ -118,7 +140,7 @@ gm_apply(const gm_kernel_t *kernel, xnd_t stack[], int outer_dims,
             return -1;
         }
 
-        return gm_xnd_map(kernel->set->OptS, stack, nargs, outer_dims-1, ctx);
+        return gm_xnd_map_1D(kernel->set->OptS, stack, nargs, outer_dims-1, ctx);
     }
 
     case INNER_C: {
@@ -216,6 +238,23 @@ select_kernel(const ndt_apply_spec_t *spec, const gm_kernel_set_t *set,
     return kernel;
 }
 
+/* Select a specialized kernel and remember the choice for the input types. */
+static gm_kernel_t
+cache_kernel(const gm_func_t *f, const ndt_apply_spec_t *spec,
+             const gm_kernel_set_t *set, const ndt_t *types[],
+             const int64_t li[], int nin, int nout, bool check_broadcast,
+             ndt_context_t *ctx)
+{
+    gm_kernel_t kernel = select_kernel(spec, set, ctx);
+
+    if (kernel.set != NULL) {
+        gm_cache_insert(f->cache, &kernel, spec, types, li, nin, nout,
+                        check_broadcast);
+    }
+
+    return kernel;
+}
+
 /* Look up a multimethod by name and select a kernel. */
 gm_kernel_t
 gm_select(ndt_apply_spec_t *spec, const gm_tbl_t *tbl, const char *name,
@@ -223,6 +262,8 @@ gm_select(ndt_apply_spec_t *spec, const gm_tbl_t *tbl, const char *name,
           bool check_broadcast, const xnd_t args[], ndt_context_t *ctx)
 {
     gm_kernel_t empty_kernel = {0U, NULL};
+    gm_kernel_t kernel;
+    const uint32_t flags = ctx->flags;
     const gm_func_t *f;
     char *s;
     int i;
@@ -232,25 +273,87 @@ gm_select(ndt_apply_spec_t *spec, const gm_tbl_t *tbl, const char *name,
         return empty_kernel;
     }
 
+    if (gm_cache_lookup(f->cache, &kernel, spec, types, li, nin, nout,
+                        check_broadcast)) {
+        return kernel;
+    }
+
+    if (gm_func_resolve(f, ctx) < 0) {
+        return empty_kernel;
+    }
+
     if (f->typecheck != NULL) {
         const gm_kernel_set_t *set = f->typecheck(spec, f, types, li, nin, nout,
                                                   check_broadcast, ctx);
         if (set == NULL) {
             return empty_kernel;
         }
-        return select_kernel(spec, set, ctx);
+        return cache_kernel(f, spec, set, types, li, nin, nout,
+                            check_broadcast, ctx);
     }
 
-    for (i = 0; i < f->nkernels; i++) {
-        const gm_kernel_set_t *set = &f->kernels[i];
-        if (ndt_typecheck(spec, set->sig, types, li, nin, nout,
-                          check_broadcast, set->constraint, args,
-                          ctx) < 0) {
-            ndt_err_clear(ctx);
-            continue;
+    /*
+     * The errors of rejected candidates are cleared immediately, so only the
+     * error code is recorded.  The message is formatted once if no kernel
+     * matches.
+     */
+    ctx->flags |= NDT_Probe;
+
+    if (nin == 0) {
+        for (i = 0; i < f->nkernels; i++) {
+            const gm_kernel_set_t *set = &f->kernels[i];
+            if (set->matcher != NULL &&
+                gm_matcher_reject(set->matcher, types, nin, nout, check_broadcast)) {
+                continue;
+            }
+            if (ndt_typecheck(spec, set->sig, types, li, nin, nout,
+                              check_broadcast, set->constraint, args,
+                              ctx) < 0) {
+                ndt_err_clear(ctx);
+                continue;
+            }
+            ctx->flags = flags;
+            return cache_kernel(f, spec, set, types, li, nin, nout,
+                                check_broadcast, ctx);
         }
-        return select_kernel(spec, set, ctx);
     }
+    else {
+        /*
+         * Only kernels whose first input has the same dtype as types[0] and
+         * kernels with a generic first input can match.  Merge both lists to
+         * preserve the order of registration.
+         */
+        const gm_kernel_list_t *x = gm_func_index(f, types[0]);
+        const gm_kernel_list_t *y = &f->any;
+        const int xlen = x ? x->len : 0;
+        int j = 0, k = 0;
+
+        while (j < xlen || k < y->len) {
+            if (k == y->len || (j < xlen && x->list[j] < y->list[k])) {
+                i = x->list[j++];
+            }
+            else {
+                i = y->list[k++];
+            }
+
+            const gm_kernel_set_t *set = &f->kernels[i];
+            if (set->matcher != NULL &&
+                gm_matcher_reject(set->matcher, types, nin, nout, check_broadcast)) {
+                continue;
+            }
+            if (ndt_typecheck(spec, set->sig, types, li, nin, nout,
+                              check_broadcast, set->constraint, args,
+                              ctx) < 0) {
+                ndt_err_clear(ctx);
+                continue;
+            }
+            ctx->flags = flags;
+            return cache_kernel(f, spec, set, types, li, nin, nout,
+                                check_broadcast, ctx);
+        }
+    }
+
+    ctx->flags = flags;
 
     s = ndt_list_as_string(types, nin, ctx);
     if (s == NULL) {
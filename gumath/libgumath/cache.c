@@ -0,0 +1,330 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2017-2018, plures
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ndtypes.h"
+#include "xnd.h"
+#include "gumath.h"
+#include "cache.h"
+#ifndef _MSC_VER
+#include "config.h"
+#endif
+
+
+/*
+ * Dispatch cache for a single multimethod.  Kernel selection depends only on
+ * the argument types, the linear indices and the number of arguments, unless
+ * a kernel has a constraint function that inspects the argument values.  The
+ * cache is disabled for multimethods with such kernels.
+ *
+ * The cache is small and uses round-robin replacement: most programs call a
+ * given function with a handful of distinct argument types.
+ */
+
+
+/******************************************************************************/
+/*                                    Locks                                   */
+/******************************************************************************/
+
+#if defined(_MSC_VER)
+#include <windows.h>
+typedef SRWLOCK cache_lock_t;
+#define CACHE_LOCK_INIT(lock) InitializeSRWLock(lock)
+#define CACHE_LOCK_FREE(lock) (void)(lock)
+#define CACHE_LOCK(lock) AcquireSRWLockExclusive(lock)
+#define CACHE_UNLOCK(lock) ReleaseSRWLockExclusive(lock)
+#elif defined(HAVE_PTHREAD_H)
+#include <pthread.h>
+typedef pthread_mutex_t cache_lock_t;
+#define CACHE_LOCK_INIT(lock) pthread_mutex_init(lock, NULL)
+#define CACHE_LOCK_FREE(lock) pthread_mutex_destroy(lock)
+#define CACHE_LOCK(lock) pthread_mutex_lock(lock)
+#define CACHE_UNLOCK(lock) pthread_mutex_unlock(lock)
+#else
+typedef int cache_lock_t;
+#define CACHE_LOCK_INIT(lock) (void)(lock)
+#define CACHE_LOCK_FREE(lock) (void)(lock)
+#define CACHE_LOCK(lock) (void)(lock)
+#define CACHE_UNLOCK(lock) (void)(lock)
+#endif
+
+
+/******************************************************************************/
+/*                                Cache entries                               */
+/******************************************************************************/
+
+#define GM_CACHE_SIZE 16
+
+typedef struct {
+    /* key */
+    int nin;
+    int nout;
+    bool check_broadcast;
+    const ndt_t **types;   /* nin+nout argument types, then the resolved types */
+    int64_t *li;
+
+    /* value */
+    gm_kernel_t kernel;
+    uint32_t flags;
+    int outer_dims;
+    int spec_nin;
+    int spec_nout;
+} cache_entry_t;
+
+struct _gm_cache {
+    cache_lock_t lock;
+    bool disabled;
+    int next;
+    cache_entry_t *entries; /* allocated on first insert */
+};
+
+static void
+entry_clear(cache_entry_t *e)
+{
+    const int n = e->nin + e->nout + e->spec_nin + e->spec_nout;
+
+    if (e->kernel.set == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < n; i++) {
+        ndt_decref(e->types[i]);
+    }
+
+    ndt_free(e->types);
+    ndt_free(e->li);
+    e->types = NULL;
+    e->li = NULL;
+    e->kernel.set = NULL;
+}
+
+static bool
+entry_match(const cache_entry_t *e, const ndt_t *types[], const int64_t li[],
+            int nin, int nout, bool check_broadcast)
+{
+    if (e->kernel.set == NULL || e->nin != nin || e->nout != nout ||
+        e->check_broadcast != check_broadcast) {
+        return false;
+    }
+
+    for (int i = 0; i < nin+nout; i++) {
+        if (e->li[i] != li[i]) {
+            return false;
+        }
+    }
+
+    for (int i = 0; i < nin+nout; i++) {
+        if (e->types[i] != types[i] && !ndt_equal(e->types[i], types[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/******************************************************************************/
+/*                                  Cache API                                 */
+/******************************************************************************/
+
+gm_cache_t *
+gm_cache_new(ndt_context_t *ctx)
+{
+    gm_cache_t *c;
+
+    c = ndt_alloc_size(sizeof *c);
+    if (c == NULL) {
+        return ndt_memory_error(ctx);
+    }
+
+    CACHE_LOCK_INIT(&c->lock);
+    c->disabled = false;
+    c->next = 0;
+    c->entries = NULL;
+
+    return c;
+}
+
+void
+gm_cache_del(gm_cache_t *c)
+{
+    if (c == NULL) {
+        return;
+    }
+
+    gm_cache_clear(c);
+    CACHE_LOCK_FREE(&c->lock);
+    ndt_free(c);
+}
+
+/* Remove all entries.  Called whenever a kernel is added to the multimethod. */
+void
+gm_cache_clear(gm_cache_t *c)
+{
+    CACHE_LOCK(&c->lock);
+
+    if (c->entries != NULL) {
+        for (int i = 0; i < GM_CACHE_SIZE; i++) {
+            entry_clear(&c->entries[i]);
+        }
+        ndt_free(c->entries);
+        c->entries = NULL;
+    }
+    c->next = 0;
+
+    CACHE_UNLOCK(&c->lock);
+}
+
+/* Permanently disable the cache, used if selection depends on argument values. */
+void
+gm_cache_disable(gm_cache_t *c)
+{
+    gm_cache_clear(c);
+
+    CACHE_LOCK(&c->lock);
+    c->disabled = true;
+    CACHE_UNLOCK(&c->lock);
+}
+
+/*
+ * Look up a previous kernel selection for the argument types.  On success,
+ * fill in 'kernel' and 'spec' and return true.  The caller owns the types
+ * in 'spec' and must release them with ndt_apply_spec_clear().
+ */
+bool
+gm_cache_lookup(gm_cache_t *c, gm_kernel_t *kernel, ndt_apply_spec_t *spec,
+                const ndt_t *types[], const int64_t li[], int nin, int nout,
+                bool check_broadcast)
+{
+    bool found = false;
+
+    CACHE_LOCK(&c->lock);
+
+    if (c->disabled || c->entries == NULL) {
+        goto out;
+    }
+
+    for (int i = 0; i < GM_CACHE_SIZE; i++) {
+        const cache_entry_t *e = &c->entries[i];
+        if (entry_match(e, types, li, nin, nout, check_broadcast)) {
+            const ndt_t **resolved = e->types + (nin+nout);
+            *kernel = e->kernel;
+            spec->flags = e->flags;
+            spec->outer_dims = e->outer_dims;
+            spec->nin = e->spec_nin;
+            spec->nout = e->spec_nout;
+            spec->nargs = e->spec_nin + e->spec_nout;
+            for (int k = 0; k < spec->nargs; k++) {
+                ndt_incref(resolved[k]);
+                spec->types[k] = resolved[k];
+            }
+            found = true;
+            break;
+        }
+    }
+
+out:
+    CACHE_UNLOCK(&c->lock);
+    return found;
+}
+
+/*
+ * Record a kernel selection.  The cache is best effort, so allocation
+ * failures are not reported.
+ */
+void
+gm_cache_insert(gm_cache_t *c, const gm_kernel_t *kernel,
+                const ndt_apply_spec_t *spec, const ndt_t *types[],
+                const int64_t li[], int nin, int nout, bool check_broadcast)
+{
+    const int nkeys = nin + nout;
+    const ndt_t **t;
+    int64_t *l;
+    cache_entry_t *e;
+
+    t = ndt_alloc(nkeys + spec->nargs, sizeof *t);
+    l = ndt_alloc(nkeys, sizeof *l);
+    if (t == NULL || l == NULL) {
+        ndt_free(t);
+        ndt_free(l);
+        return;
+    }
+
+    for (int i = 0; i < nkeys; i++) {
+        ndt_incref(types[i]);
+        t[i] = types[i];
+        l[i] = li[i];
+    }
+
+    for (int i = 0; i < spec->nargs; i++) {
+        ndt_incref(spec->types[i]);
+        t[nkeys+i] = spec->types[i];
+    }
+
+    CACHE_LOCK(&c->lock);
+
+    if (c->entries == NULL && !c->disabled) {
+        c->entries = ndt_calloc(GM_CACHE_SIZE, sizeof *c->entries);
+    }
+
+    if (c->disabled || c->entries == NULL) {
+        CACHE_UNLOCK(&c->lock);
+        for (int i = 0; i < nkeys + spec->nargs; i++) {
+            ndt_decref(t[i]);
+        }
+        ndt_free(t);
+        ndt_free(l);
+        return;
+    }
+
+    e = &c->entries[c->next];
+    c->next = (c->next + 1) % GM_CACHE_SIZE;
+
+    entry_clear(e);
+    e->nin = nin;
+    e->nout = nout;
+    e->check_broadcast = check_broadcast;
+    e->types = t;
+    e->li = l;
+    e->kernel = *kernel;
+    e->flags = spec->flags;
+    e->outer_dims = spec->outer_dims;
+    e->spec_nin = spec->nin;
+    e->spec_nout = spec->nout;
+
+    CACHE_UNLOCK(&c->lock);
+}
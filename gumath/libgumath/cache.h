@@ -0,0 +1,61 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2017-2018, plures
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CACHE_H
+#define CACHE_H
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "ndtypes.h"
+#include "gumath.h"
+
+
+/******************************************************************************/
+/*                               Dispatch cache                               */
+/******************************************************************************/
+
+/* Private to the owners of gm_func_t: func.c and apply.c. */
+gm_cache_t *gm_cache_new(ndt_context_t *ctx);
+void gm_cache_del(gm_cache_t *c);
+void gm_cache_clear(gm_cache_t *c);
+void gm_cache_disable(gm_cache_t *c);
+bool gm_cache_lookup(gm_cache_t *c, gm_kernel_t *kernel, ndt_apply_spec_t *spec,
+                     const ndt_t *types[], const int64_t li[], int nin, int nout,
+                     bool check_broadcast);
+void gm_cache_insert(gm_cache_t *c, const gm_kernel_t *kernel,
+                     const ndt_apply_spec_t *spec, const ndt_t *types[],
+                     const int64_t li[], int nin, int nout, bool check_broadcast);
+
+
+#endif /* CACHE_H */
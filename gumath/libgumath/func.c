@@ -33,6 +33,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include <stdint.h>
 #include <inttypes.h>
 #include <stdbool.h>
@@ -40,6 +41,41 @@
 #include <assert.h>
 #include "ndtypes.h"
 #include "gumath.h"
+#include "cache.h"
+#ifndef _MSC_VER
+#include "config.h"
+#endif
+
+
+/******************************************************************************/
+/*                                    Locks                                   */
+/******************************************************************************/
+
+/*
+ * Serializes the parsing of pending signatures.  Taken only while a function
+ * has pending kernels, so resolved functions are looked up without locking.
+ */
+#if defined(_MSC_VER)
+#include <windows.h>
+static SRWLOCK resolve_lock = SRWLOCK_INIT;
+#define RESOLVE_LOCK() AcquireSRWLockExclusive(&resolve_lock)
+#define RESOLVE_UNLOCK() ReleaseSRWLockExclusive(&resolve_lock)
+/* 'resolved' is volatile, which has acquire/release semantics on MSVC. */
+#define LOAD_RESOLVED(f) ((f)->resolved)
+#define STORE_RESOLVED(f, v) ((f)->resolved = (v))
+#else
+#if defined(HAVE_PTHREAD_H)
+#include <pthread.h>
+static pthread_mutex_t resolve_lock = PTHREAD_MUTEX_INITIALIZER;
+#define RESOLVE_LOCK() pthread_mutex_lock(&resolve_lock)
+#define RESOLVE_UNLOCK() pthread_mutex_unlock(&resolve_lock)
+#else
+#define RESOLVE_LOCK()
+#define RESOLVE_UNLOCK()
+#endif
+#define LOAD_RESOLVED(f) atomic_load_explicit(&(f)->resolved, memory_order_acquire)
+#define STORE_RESOLVED(f, v) atomic_store_explicit(&(f)->resolved, v, memory_order_release)
+#endif
 
 
 /******************************************************************************/
@@ -63,6 +99,23 @@ gm_func_new(const char *name, ndt_context_t *ctx)
     }
     f->typecheck = NULL;
     f->nkernels = 0;
+    f->alloc = 0;
+    f->kernels = NULL;
+    f->any = (gm_kernel_list_t){0, 0, NULL};
+    for (int i = 0; i < GM_INDEX_MAX-GM_INDEX_MIN+1; i++) {
+        f->index[i] = (gm_kernel_list_t){0, 0, NULL};
+    }
+    f->resolved = 1;
+    f->npending = 0;
+    f->palloc = 0;
+    f->pending = NULL;
+
+    f->cache = gm_cache_new(ctx);
+    if (f->cache == NULL) {
+        ndt_free(f->name);
+        ndt_free(f);
+        return NULL;
+    }
 
     return f;
 }
@@ -71,9 +124,18 @@ void
 gm_func_del(gm_func_t *f)
 {
     ndt_free(f->name);
+    gm_cache_del(f->cache);
 
     for (int i = 0; i < f->nkernels; i++) {
         ndt_decref(f->kernels[i].sig);
+        gm_matcher_del(f->kernels[i].matcher);
+    }
+
+    ndt_free(f->kernels);
+    ndt_free(f->pending);
+    ndt_free(f->any.list);
+    for (int i = 0; i < GM_INDEX_MAX-GM_INDEX_MIN+1; i++) {
+        ndt_free(f->index[i].list);
     }
 
     ndt_free(f);
@@ -96,19 +158,83 @@ gm_add_func(gm_tbl_t *tbl, const char *name, ndt_context_t *ctx)
     return f;
 }
 
-int
-gm_add_kernel(gm_tbl_t *tbl, const gm_kernel_init_t *k, ndt_context_t *ctx)
+/******************************************************************************/
+/*                               Kernel storage                               */
+/******************************************************************************/
+
+static int
+list_append(gm_kernel_list_t *x, int n, ndt_context_t *ctx)
+{
+    if (x->len == x->alloc) {
+        const int alloc = x->alloc == 0 ? 4 : 2 * x->alloc;
+        int *list = ndt_realloc(x->list, alloc, sizeof *list);
+        if (list == NULL) {
+            (void)ndt_memory_error(ctx);
+            return -1;
+        }
+        x->list = list;
+        x->alloc = alloc;
+    }
+
+    x->list[x->len++] = n;
+    return 0;
+}
+
+static gm_kernel_list_t *
+index_slot(gm_func_t *f, const ndt_t *t)
+{
+    const ndt_t *dtype = ndt_dtype(t);
+
+    /* dtypes that only match themselves in ndt_typecheck() */
+    switch (dtype->tag) {
+    case Bool:
+    case Int8: case Int16: case Int32: case Int64:
+    case Uint8: case Uint16: case Uint32: case Uint64:
+    case BFloat16: case Float16: case Float32: case Float64:
+    case BComplex32: case Complex32: case Complex64: case Complex128:
+    case String:
+        return &f->index[dtype->tag-GM_INDEX_MIN];
+    default:
+        return NULL;
+    }
+}
+
+/*
+ * Return the kernels whose first input has the same dtype as 't', or NULL
+ * if the dtype of 't' is not indexed.  Kernels in 'f->any' are candidates
+ * in all cases.
+ */
+const gm_kernel_list_t *
+gm_func_index(const gm_func_t *f, const ndt_t *t)
+{
+    return index_slot((gm_func_t *)f, t);
+}
+
+static int
+add_kernel(gm_func_t *f, const gm_kernel_init_t *k, ndt_context_t *ctx)
 {
-    gm_func_t *f = gm_tbl_find(tbl, k->name, ctx);
     gm_kernel_set_t kernel;
+    gm_kernel_list_t *slot;
     const ndt_t *t;
 
-    if (f == NULL) {
-        ndt_err_clear(ctx);
-        f = gm_add_func(tbl, k->name, ctx);
-        if (f == NULL) {
+    if (f->nkernels == f->alloc) {
+        gm_kernel_set_t *kernels;
+        int alloc;
+
+        if (f->alloc > INT_MAX/2) {
+            ndt_err_format(ctx, NDT_RuntimeError,
+                "%s: maximum number of kernels reached", f->name);
             return -1;
         }
+
+        alloc = f->alloc == 0 ? 4 : 2 * f->alloc;
+        kernels = ndt_realloc(f->kernels, alloc, sizeof *kernels);
+        if (kernels == NULL) {
+            (void)ndt_memory_error(ctx);
+            return -1;
+        }
+        f->kernels = kernels;
+        f->alloc = alloc;
     }
 
     t = ndt_from_string_v(k->sig, ctx);
@@ -116,15 +242,19 @@ gm_add_kernel(gm_tbl_t *tbl, const gm_kernel_init_t *k, ndt_context_t *ctx)
         return -1;
     }
 
-    if (f->nkernels == GM_MAX_KERNELS) {
+    slot = NULL;
+    if (t->tag == Function && t->Function.nin > 0) {
+        slot = index_slot(f, t->Function.types[0]);
+    }
+
+    if (list_append(slot ? slot : &f->any, f->nkernels, ctx) < 0) {
         ndt_decref(t);
-        ndt_err_format(ctx, NDT_RuntimeError,
-            "%s: maximum number of kernels reached for", f->name);
         return -1;
     }
 
     kernel.sig = t;
     kernel.constraint = k->constraint;
+    kernel.cap = k->cap;
     kernel.OptC = k->OptC;
     kernel.OptZ = k->OptZ;
     kernel.OptS = k->OptS;
@@ -133,49 +263,139 @@ gm_add_kernel(gm_tbl_t *tbl, const gm_kernel_init_t *k, ndt_context_t *ctx)
     kernel.Xnd = k->Xnd;
     kernel.Strided = k->Strided;
 
+    /* Best effort: without a matcher gm_select() uses ndt_typecheck() alone. */
+    kernel.matcher = gm_matcher_new(t);
+
     f->kernels[f->nkernels++] = kernel;
+
+    if (kernel.constraint != NULL) {
+        gm_cache_disable(f->cache);
+    }
+    else {
+        gm_cache_clear(f->cache);
+    }
+
     return 0;
 }
 
+static int
+resolve(gm_func_t *f, ndt_context_t *ctx)
+{
+    int i;
+
+    for (i = 0; i < f->npending; i++) {
+        if (add_kernel(f, f->pending[i], ctx) < 0) {
+            break;
+        }
+    }
+
+    f->npending -= i;
+    memmove(f->pending, f->pending+i, f->npending * (sizeof *f->pending));
+
+    return f->npending == 0 ? 0 : -1;
+}
+
+/*
+ * Parse the signatures of the kernels that were added lazily.  Must be called
+ * before accessing 'f->kernels' or the kernel index.  Safe to call from
+ * multiple threads: the lock is only taken while kernels are pending, and the
+ * release store of 'resolved' publishes the parsed kernels to lookups that
+ * skip the lock.  Adding kernels concurrently with lookups is not safe.
+ */
 int
-gm_add_kernel_typecheck(gm_tbl_t *tbl, const gm_kernel_init_t *k, ndt_context_t *ctx,
-                        gm_typecheck_t typecheck)
+gm_func_resolve(const gm_func_t *f, ndt_context_t *ctx)
 {
-    gm_func_t *f = gm_tbl_find(tbl, k->name, ctx);
-    gm_kernel_set_t kernel;
-    const ndt_t *t;
+    gm_func_t *g = (gm_func_t *)f;
+    int ret;
+
+    if (LOAD_RESOLVED(g)) {
+        return 0;
+    }
+
+    RESOLVE_LOCK();
+    ret = g->npending == 0 ? 0 : resolve(g, ctx);
+    if (ret == 0) {
+        STORE_RESOLVED(g, 1);
+    }
+    RESOLVE_UNLOCK();
+
+    return ret;
+}
+
+static gm_func_t *
+find_or_add_func(gm_tbl_t *tbl, const char *name, gm_typecheck_t typecheck,
+                 ndt_context_t *ctx)
+{
+    gm_func_t *f = gm_tbl_find(tbl, name, ctx);
 
     if (f == NULL) {
         ndt_err_clear(ctx);
-        f = gm_add_func(tbl, k->name, ctx);
+        f = gm_add_func(tbl, name, ctx);
         if (f == NULL) {
-            return -1;
+            return NULL;
         }
         f->typecheck = typecheck;
     }
 
-    t = ndt_from_string_v(k->sig, ctx);
-    if (t == NULL) {
+    return f;
+}
+
+int
+gm_add_kernel(gm_tbl_t *tbl, const gm_kernel_init_t *k, ndt_context_t *ctx)
+{
+    return gm_add_kernel_typecheck(tbl, k, ctx, NULL);
+}
+
+int
+gm_add_kernel_typecheck(gm_tbl_t *tbl, const gm_kernel_init_t *k, ndt_context_t *ctx,
+                        gm_typecheck_t typecheck)
+{
+    gm_func_t *f = find_or_add_func(tbl, k->name, typecheck, ctx);
+
+    if (f == NULL || gm_func_resolve(f, ctx) < 0) {
         return -1;
     }
 
-    if (f->nkernels == GM_MAX_KERNELS) {
-        ndt_decref(t);
-        ndt_err_format(ctx, NDT_RuntimeError,
-            "%s: maximum number of kernels reached for", f->name);
+    return add_kernel(f, k, ctx);
+}
+
+/*
+ * Add a kernel without parsing its signature.  Parsing happens on the first
+ * lookup of the function, so '*k' must remain valid for the lifetime of the
+ * table.  Used for the large builtin tables, where parsing thousands of
+ * signatures would dominate the initialization time.
+ */
+int
+gm_add_kernel_lazy(gm_tbl_t *tbl, const gm_kernel_init_t *k, ndt_context_t *ctx,
+                   gm_typecheck_t typecheck)
+{
+    gm_func_t *f = find_or_add_func(tbl, k->name, typecheck, ctx);
+
+    if (f == NULL) {
         return -1;
     }
 
-    kernel.sig = t;
-    kernel.constraint = k->constraint;
-    kernel.OptC = k->OptC;
-    kernel.OptZ = k->OptZ;
-    kernel.OptS = k->OptS;
-    kernel.C = k->C;
-    kernel.Fortran = k->Fortran;
-    kernel.Xnd = k->Xnd;
-    kernel.Strided = k->Strided;
+    if (f->npending == f->palloc) {
+        const gm_kernel_init_t **pending;
+        int alloc;
 
-    f->kernels[f->nkernels++] = kernel;
+        if (f->palloc > INT_MAX/2) {
+            ndt_err_format(ctx, NDT_RuntimeError,
+                "%s: maximum number of kernels reached", f->name);
+            return -1;
+        }
+
+        alloc = f->palloc == 0 ? 4 : 2 * f->palloc;
+        pending = ndt_realloc(f->pending, alloc, sizeof *pending);
+        if (pending == NULL) {
+            (void)ndt_memory_error(ctx);
+            return -1;
+        }
+        f->pending = pending;
+        f->palloc = alloc;
+    }
+
+    f->pending[f->npending++] = k;
+    STORE_RESOLVED(f, 0);
     return 0;
 }
@@ -76,16 +76,25 @@ extern "C" {
 #endif
 
 
-#define GM_MAX_KERNELS 8192
 #define GM_THREAD_CUTOFF 1000000
 
 typedef float float32_t;
 typedef double float64_t;
 
 
+/*
+ * Kernel capabilities (gm_kernel_init_t.cap).  Kernels without flags are
+ * plain C functions that may run in any thread, concurrently with other
+ * kernels and without holding the GIL of an embedding interpreter.
+ */
+#define GM_CAP_REQUIRES_GIL 0x0001U /* calls back into Python, never threaded */
+
 typedef int (* gm_xnd_kernel_t)(xnd_t stack[], ndt_context_t *ctx);
 typedef int (* gm_strided_kernel_t)(char **args, intptr_t *dimensions, intptr_t *steps, void *data);
 
+/* Compiled signature matcher, see matcher.c */
+typedef struct _gm_matcher gm_matcher_t;
+
 /*
  * Collection of specialized kernels for a single function signature.
  *
@@ -98,6 +107,8 @@ typedef int (* gm_strided_kernel_t)(char **args, intptr_t *dimensions, intptr_t
 typedef struct {
     const ndt_t *sig;
     const ndt_constraint_t *constraint;
+    uint32_t cap;
+    gm_matcher_t *matcher;   /* Fast rejection of non-matching types, may be NULL. */
 
     /* Xnd signatures */
     gm_xnd_kernel_t OptC;    /* C in inner+1 dimensions */
@@ -141,6 +152,20 @@ typedef struct {
     const gm_kernel_set_t *set;
 } gm_kernel_t;
 
+/* Dispatch cache, see cache.c */
+typedef struct _gm_cache gm_cache_t;
+
+/* Kernel indices in order of registration */
+typedef struct {
+    int len;
+    int alloc;
+    int *list;
+} gm_kernel_list_t;
+
+/* Range of dtype tags that are indexed for fast candidate lookup */
+#define GM_INDEX_MIN String
+#define GM_INDEX_MAX Complex128
+
 /* Multimethod with associated kernels */
 typedef struct gm_func gm_func_t;
 typedef const gm_kernel_set_t *(*gm_typecheck_t)(ndt_apply_spec_t *spec, const gm_func_t *f,
@@ -150,8 +175,29 @@ typedef const gm_kernel_set_t *(*gm_typecheck_t)(ndt_apply_spec_t *spec, const g
 struct gm_func {
     char *name;
     gm_typecheck_t typecheck; /* Experimental optimized type-checking, may be NULL. */
+    gm_cache_t *cache;        /* Previous kernel selections */
     int nkernels;
-    gm_kernel_set_t kernels[GM_MAX_KERNELS];
+    int alloc;
+    gm_kernel_set_t *kernels;
+
+    /*
+     * Kernels indexed by the dtype of their first input.  Kernels whose first
+     * input has a dtype outside of the indexed range (typevars, records, ...)
+     * are in 'any'.
+     */
+    gm_kernel_list_t any;
+    gm_kernel_list_t index[GM_INDEX_MAX-GM_INDEX_MIN+1];
+
+    /*
+     * Kernels added with gm_add_kernel_lazy() whose signatures have not been
+     * parsed yet.  gm_func_resolve() moves them to 'kernels' in order.
+     * 'resolved' is nonzero if there are no pending kernels.  It is read
+     * without a lock, so that lookups only lock while kernels are pending.
+     */
+    ATOMIC_INT64 resolved;
+    int npending;
+    int palloc;
+    const gm_kernel_init_t **pending;
 };
 
 
@@ -168,12 +214,29 @@ GM_API void gm_func_del(gm_func_t *f);
 GM_API gm_func_t *gm_add_func(gm_tbl_t *tbl, const char *name, ndt_context_t *ctx);
 GM_API int gm_add_kernel(gm_tbl_t *tbl, const gm_kernel_init_t *kernel, ndt_context_t *ctx);
 GM_API int gm_add_kernel_typecheck(gm_tbl_t *tbl, const gm_kernel_init_t *kernel, ndt_context_t *ctx, gm_typecheck_t f);
+GM_API int gm_add_kernel_lazy(gm_tbl_t *tbl, const gm_kernel_init_t *kernel, ndt_context_t *ctx, gm_typecheck_t f);
+GM_API int gm_func_resolve(const gm_func_t *f, ndt_context_t *ctx);
+GM_API const gm_kernel_list_t *gm_func_index(const gm_func_t *f, const ndt_t *t);
 
 GM_API gm_kernel_t gm_select(ndt_apply_spec_t *spec, const gm_tbl_t *tbl, const char *name,
                              const ndt_t *types[], const int64_t li[], int nin, int nout,
                              bool check_broadcast, const xnd_t args[], ndt_context_t *ctx);
+GM_API void gm_prepare_bitmaps(const gm_kernel_t *kernel, xnd_t stack[]);
 GM_API int gm_apply(const gm_kernel_t *kernel, xnd_t stack[], int outer_dims, ndt_context_t *ctx);
 GM_API int gm_apply_thread(const gm_kernel_t *kernel, xnd_t stack[], int outer_dims, const int64_t nthreads, ndt_context_t *ctx);
+GM_API int64_t gm_get_max_threads(void);
+GM_API int gm_set_max_threads(int64_t n, ndt_context_t *ctx);
+GM_API int gm_copy_thread(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx);
+
+
+/******************************************************************************/
+/*                             Signature matchers                             */
+/******************************************************************************/
+
+GM_API gm_matcher_t *gm_matcher_new(const ndt_t *sig);
+GM_API void gm_matcher_del(gm_matcher_t *m);
+GM_API bool gm_matcher_reject(const gm_matcher_t *m, const ndt_t *types[], int nin,
+                              int nout, bool check_broadcast);
 
 
 /******************************************************************************/
@@ -205,6 +268,8 @@ GM_API int gm_np_map(const gm_strided_kernel_t f,
 GM_API int array_shape_check(xnd_t *x, const int64_t shape, ndt_context_t *ctx);
 GM_API int gm_xnd_map(const gm_xnd_kernel_t f, xnd_t stack[], const int nargs,
                       const int outer_dims, ndt_context_t *ctx);
+GM_API int gm_xnd_map_1D(const gm_xnd_kernel_t f, xnd_t stack[], const int nargs,
+                         const int outer_dims, ndt_context_t *ctx);
 
 
 /******************************************************************************/
@@ -218,6 +283,17 @@ GM_API gm_func_t *gm_tbl_find(const gm_tbl_t *tbl, const char *key, ndt_context_
 GM_API int gm_tbl_map(const gm_tbl_t *tbl, int (*f)(const gm_func_t *, void *state), void *state);
 
 
+/******************************************************************************/
+/*                           Instruction set dispatch                         */
+/******************************************************************************/
+
+GM_API void gm_init_isa(void);
+GM_API const char *gm_get_isa(void);
+GM_API int gm_set_isa(const char *name, ndt_context_t *ctx);
+GM_API int gm_get_strict_math(void);
+GM_API void gm_set_strict_math(int strict);
+
+
 /******************************************************************************/
 /*                       Library initialization and tables                    */
 /******************************************************************************/
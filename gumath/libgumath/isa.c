@@ -0,0 +1,137 @@
+/*
+* BSD 3-Clause License
+*
+* Copyright (c) 2017-2018, plures
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+*    this list of conditions and the following disclaimer in the documentation
+*    and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "ndtypes.h"
+#include "xnd.h"
+#include "gumath.h"
+#include "kernels/isa.h"
+
+
+/*****************************************************************************/
+/*                        Instruction set selection                          */
+/*****************************************************************************/
+
+int gm_isa_level = GM_ISA_BASE;
+
+/* Highest level supported by the cpu. */
+static int isa_max = GM_ISA_BASE;
+
+static const char *isa_names[] = {"base", "avx2", "avx512"};
+
+static int
+detect_isa(void)
+{
+#ifdef GM_ISA_DISPATCH
+    /* __builtin_cpu_supports() also checks that the OS saves the registers. */
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512vl") &&
+        __builtin_cpu_supports("avx512dq") &&
+        __builtin_cpu_supports("f16c")) {
+        return GM_ISA_AVX512;
+    }
+
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c")) {
+        return GM_ISA_AVX2;
+    }
+#endif
+
+    return GM_ISA_BASE;
+}
+
+void
+gm_init_isa(void)
+{
+    isa_max = detect_isa();
+    gm_isa_level = isa_max;
+}
+
+const char *
+gm_get_isa(void)
+{
+    return isa_names[gm_isa_level];
+}
+
+/*
+ * Select a lower level, e.g. for testing.  All levels compute identical
+ * results, so switching while kernels are running is harmless.
+ */
+int
+gm_set_isa(const char *name, ndt_context_t *ctx)
+{
+    int i;
+
+    for (i = 0; i < (int)(sizeof isa_names / sizeof isa_names[0]); i++) {
+        if (strcmp(name, isa_names[i]) == 0) {
+            if (i > isa_max) {
+                ndt_err_format(ctx, NDT_ValueError,
+                    "instruction set '%s' is not supported by this cpu", name);
+                return -1;
+            }
+            gm_isa_level = i;
+            return 0;
+        }
+    }
+
+    ndt_err_format(ctx, NDT_ValueError, "invalid instruction set: '%s'", name);
+    return -1;
+}
+
+
+/*****************************************************************************/
+/*                                Strict math                                */
+/*****************************************************************************/
+
+/*
+ * If set, the float32 and float64 math kernels call libm instead of the
+ * vectorized functions in kernels/vmath.h.
+ */
+int gm_strict_math = 0;
+
+int
+gm_get_strict_math(void)
+{
+    return gm_strict_math;
+}
+
+void
+gm_set_strict_math(int strict)
+{
+    gm_strict_math = !!strict;
+}
@@ -43,6 +43,138 @@
 #include "common.h"
 
 
+/****************************************************************************/
+/*                           Word-level bitmap ops                          */
+/****************************************************************************/
+
+/*
+ * Contiguous bitmaps are processed 64 bits at a time.  Bit n of a bitmap is
+ * bit n%8 of byte n/8, so the bits [off, off+64) are a little endian word,
+ * shifted if off is not byte aligned.  The leading bits up to the first byte
+ * boundary of the destination and the trailing bits are handled one at a time.
+ */
+
+static inline uint64_t
+load_word(const uint8_t *p)
+{
+    return (uint64_t)p[0]       | (uint64_t)p[1] << 8  |
+           (uint64_t)p[2] << 16 | (uint64_t)p[3] << 24 |
+           (uint64_t)p[4] << 32 | (uint64_t)p[5] << 40 |
+           (uint64_t)p[6] << 48 | (uint64_t)p[7] << 56;
+}
+
+static inline void
+store_word(uint8_t *p, uint64_t w)
+{
+    for (int i = 0; i < 8; i++) {
+        p[i] = (uint8_t)(w >> (8*i));
+    }
+}
+
+/* Bits [off, off+64).  Only reads bytes that contain one of these bits. */
+static inline uint64_t
+load_bits(const uint8_t *data, int64_t off)
+{
+    const uint8_t *p = data + off / 8;
+    const int shift = off % 8;
+    uint64_t w = load_word(p);
+
+    if (shift) {
+        w = (w >> shift) | ((uint64_t)p[8] << (64-shift));
+    }
+
+    return w;
+}
+
+/* dst[d:d+N] = a[i:i+N] & b[k:k+N], or a copy of a if b is NULL. */
+static void
+bitmap_and(uint8_t *dst, int64_t d, const uint8_t *a, int64_t i,
+           const uint8_t *b, int64_t k, int64_t N)
+{
+    for (; N > 0 && d % 8 != 0; N--, d++, i++, k++) {
+        set_bit(dst, d, is_valid(a, i) && (b == NULL || is_valid(b, k)));
+    }
+
+    if (b == NULL && i % 8 == 0) {
+        memcpy(dst + d/8, a + i/8, N/8);
+        d += N/8*8; i += N/8*8; N %= 8;
+    }
+    else if (b == NULL) {
+        for (; N >= 64; N -= 64, d += 64, i += 64) {
+            store_word(dst + d/8, load_bits(a, i));
+        }
+    }
+    else {
+        for (; N >= 64; N -= 64, d += 64, i += 64, k += 64) {
+            store_word(dst + d/8, load_bits(a, i) & load_bits(b, k));
+        }
+    }
+
+    for (; N > 0; N--, d++, i++, k++) {
+        set_bit(dst, d, is_valid(a, i) && (b == NULL || is_valid(b, k)));
+    }
+}
+
+/* Set N bits starting at off with the given step. */
+static void
+bitmap_fill_valid(uint8_t *dst, int64_t d, int64_t step, int64_t N)
+{
+    if (step != 1) {
+        for (; N > 0; N--, d += step) {
+            set_bit(dst, d, 1);
+        }
+        return;
+    }
+
+    for (; N > 0 && d % 8 != 0; N--, d++) {
+        set_bit(dst, d, 1);
+    }
+
+    memset(dst + d/8, 0xff, N/8);
+    d += N/8*8; N %= 8;
+
+    for (; N > 0; N--, d++) {
+        set_bit(dst, d, 1);
+    }
+}
+
+/*
+ * The NA count of an output bitmap is unknown after the kernel has written
+ * it, unless all written bits are valid and the bitmap had no NA bits.
+ */
+static inline void
+written(const xnd_t *out, bool all_valid)
+{
+    if (!all_valid || !xnd_bitmap_all_valid(&out->bitmap)) {
+        xnd_bitmap_invalidate(&out->bitmap);
+    }
+}
+
+bool
+bitmap_all_valid(const uint8_t *data, int64_t off, int64_t N)
+{
+    for (; N > 0 && off % 8 != 0; N--, off++) {
+        if (!is_valid(data, off)) {
+            return false;
+        }
+    }
+
+    for (; N >= 64; N -= 64, off += 64) {
+        if (load_word(data + off/8) != UINT64_MAX) {
+            return false;
+        }
+    }
+
+    for (; N > 0; N--, off++) {
+        if (!is_valid(data, off)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
 /****************************************************************************/
 /*                           Unary bitmap kernels                           */
 /****************************************************************************/
@@ -62,6 +194,19 @@ unary_update_bitmap_1D_S(xnd_t stack[])
     assert(b0 != NULL);
     assert(b1 != NULL);
 
+    if (xnd_bitmap_all_valid(&stack[0].bitmap)) {
+        bitmap_fill_valid(b1, li1, s1, N);
+        written(&stack[1], true);
+        return;
+    }
+
+    written(&stack[1], false);
+
+    if (s0 == 1 && s1 == 1) {
+        bitmap_and(b1, li1, b0, li0, NULL, 0, N);
+        return;
+    }
+
     for (i=0, k0=li0, k1=li1; i<N; i++, k0+=s0, k1+=s1) {
         bool x = is_valid(b0, k0);
         set_bit(b1, k1, x);
@@ -82,6 +227,18 @@ unary_reduce_bitmap_1D_S(xnd_t stack[])
     assert(b0 != NULL);
     assert(b1 != NULL);
 
+    if (xnd_bitmap_all_valid(&stack[0].bitmap)) {
+        return;
+    }
+
+    written(&stack[1], false);
+
+    if (s0 == 1) {
+        bool x = bitmap_all_valid(b0, li0, N) && is_valid(b1, li1);
+        set_bit(b1, li1, x);
+        return;
+    }
+
     for (i=0, k0=li0; i<N; i++, k0+=s0) {
         bool x = is_valid(b0, k0) && is_valid(b1, li1);
         set_bit(b1, li1, x);
@@ -101,6 +258,7 @@ unary_update_bitmap_0D(xnd_t stack[])
 
     bool x = is_valid(b0, li0);
     set_bit(b1, li1, x);
+    written(&stack[1], x);
 }
 
 
@@ -123,6 +281,31 @@ binary_update_bitmap_1D_S(xnd_t stack[])
     uint8_t *b2 = get_bitmap1D(&stack[2]);
     int64_t i, k0, k1, k2;
 
+    /* Bitmaps without NA bits do not affect the result. */
+    if (xnd_bitmap_all_valid(&stack[0].bitmap)) b0 = NULL;
+    if (xnd_bitmap_all_valid(&stack[1].bitmap)) b1 = NULL;
+
+    if (!b0 && !b1) {
+        bitmap_fill_valid(b2, li2, s2, N);
+        written(&stack[2], true);
+        return;
+    }
+
+    written(&stack[2], false);
+
+    if (s2 == 1 && (!b0 || s0 == 1) && (!b1 || s1 == 1)) {
+        if (b0 && b1) {
+            bitmap_and(b2, li2, b0, li0, b1, li1, N);
+        }
+        else if (b0) {
+            bitmap_and(b2, li2, b0, li0, NULL, 0, N);
+        }
+        else if (b1) {
+            bitmap_and(b2, li2, b1, li1, NULL, 0, N);
+        }
+        return;
+    }
+
     if (b0 && b1) {
         for (i=0, k0=li0, k1=li1, k2=li2; i<N; i++, k0+=s0, k1+=s1, k2+=s2) {
             bool x = is_valid(b0, k0) && is_valid(b1, k1);
@@ -167,6 +350,8 @@ binary_update_bitmap_0D(xnd_t stack[])
         bool x = is_valid(b1, li1);
         set_bit(b2, li2, x);
     }
+
+    written(&stack[2], is_valid(b2, li2));
 }
 
 void
@@ -186,6 +371,9 @@ binary_update_bitmap_1D_S_bool(xnd_t stack[])
 
     assert(!ndt_is_optional(stack[2].type));
 
+    if (xnd_bitmap_all_valid(&stack[0].bitmap)) b0 = NULL;
+    if (xnd_bitmap_all_valid(&stack[1].bitmap)) b1 = NULL;
+
     if (b0 && b1) {
         for (i=0, k0=li0, k1=li1, k2=li2; i<N; i++, k0+=s0, k1+=s1, k2+=s2) {
             bool x = is_valid(b0, k0);
@@ -118,6 +118,8 @@ linear_index1D(const xnd_t *x, const int64_t i)
 /* LOCAL SCOPE */
 NDT_PRAGMA(NDT_HIDE_SYMBOLS_START)
 
+bool bitmap_all_valid(const uint8_t *data, int64_t off, int64_t N);
+
 void unary_update_bitmap_1D_S(xnd_t stack[]);
 void unary_reduce_bitmap_1D_S(xnd_t stack[]);
 void unary_update_bitmap_0D(xnd_t stack[]);
@@ -31,19 +31,27 @@
 */
 
 
+#include <algorithm>
 #include <cinttypes>
 #include <complex>
 #include <cmath>
 #include "contrib/bfloat16.h"
+#include "float16.h"
 #include "cpu_device_binary.h"
 #include "device.hh"
+#include "isa.h"
 
 
 /*****************************************************************************/
 /*                         CPU device binary kernels                         */
 /*****************************************************************************/
 
-#define CPU_DEVICE_BINARY(name, func, t0, t1, t2, common) \
+/*
+ * The 1D_Z kernels are used when one input is broadcast with a zero step
+ * (s0 == 0 or s1 == 0) and the other input and the output are contiguous.
+ * The broadcast operand is converted once outside the loop.
+ */
+#define CPU_DEVICE_BINARY_1D_C_SCALAR(name, func, t0, t1, t2, common) \
 extern "C" void                                                             \
 gm_cpu_device_fixed_1D_C_##name##_##t0##_##t1##_##t2(                       \
     const char *a0, const char *a1, char *a2,                               \
@@ -70,6 +78,186 @@ gm_cpu_device_fixed_1D_C_##name##_##t0##_##t1##_##t2(                       \
 }                                                                           \
                                                                             \
 extern "C" void                                                             \
+gm_cpu_device_fixed_1D_Z_##name##_##t0##_##t1##_##t2(                       \
+    const char *a0, const char *a1, char *a2,                               \
+    const int64_t s0, const int64_t s1,                                     \
+    const int64_t N)                                                        \
+{                                                                           \
+    const t0##_t *x0 = (const t0##_t *)a0;                                  \
+    const t1##_t *x1 = (const t1##_t *)a1;                                  \
+    t2##_t *x2 = (t2##_t *)a2;                                              \
+    (void)s1;                                                               \
+                                                                            \
+    if (s0 == 0) {                                                          \
+        const common##_t c = (common##_t)x0[0];                             \
+        for (int64_t i = 0; i < N; i++) {                                   \
+            x2[i] = func(c, (common##_t)x1[i]);                             \
+        }                                                                   \
+    }                                                                       \
+    else {                                                                  \
+        const common##_t c = (common##_t)x1[0];                             \
+        for (int64_t i = 0; i < N; i++) {                                   \
+            x2[i] = func((common##_t)x0[i], c);                             \
+        }                                                                   \
+    }                                                                       \
+}
+
+/*
+ * Vectorizable kernels: a plain loop is compiled once per instruction set
+ * and the clone is selected at runtime (see isa.h).  The compiler versions
+ * the loop for overlapping arguments, so in-place operations are safe.
+ *
+ * Kernels with float16 or bfloat16 operands run in blocks: the operands are
+ * widened to float (with F16C where available), the loop computes in float
+ * and the results are narrowed in one pass.  For the exact operations in the
+ * vectorized families this gives the same results as the scalar kernels.
+ */
+#define CPU_DEVICE_BINARY_LOOP(name, func, t0, t1, t2, common, isa, target) \
+static target void                                                          \
+binary_1D_C_##name##_##t0##_##t1##_##t2##_##isa(                            \
+    const t0##_t *x0, const t1##_t *x1, t2##_t *x2,                         \
+    const int64_t N)                                                        \
+{                                                                           \
+    typedef gm::half_wide<t0##_t>::type w0_t;                               \
+    typedef gm::half_wide<t1##_t>::type w1_t;                               \
+    typedef gm::half_wide<t2##_t>::type w2_t;                               \
+    typedef gm::half_wide<common##_t>::type wc_t;                           \
+                                                                            \
+    if (gm::half_wide<t0##_t>::value || gm::half_wide<t1##_t>::value ||     \
+        gm::half_wide<t2##_t>::value) {                                     \
+        w0_t b0[GM_HALF_BLOCKSIZE];                                         \
+        w1_t b1[GM_HALF_BLOCKSIZE];                                         \
+        w2_t b2[GM_HALF_BLOCKSIZE];                                         \
+                                                                            \
+        for (int64_t i = 0; i < N; i += GM_HALF_BLOCKSIZE) {                \
+            const int64_t n = std::min<int64_t>(N-i, GM_HALF_BLOCKSIZE);    \
+            const w0_t *y0 = gm::half_widen_##isa(x0+i, b0, n);             \
+            const w1_t *y1 = gm::half_widen_##isa(x1+i, b1, n);             \
+            w2_t *y2 = gm::half_out(x2+i, b2);                              \
+                                                                            \
+            for (int64_t k = 0; k < n; k++) {                               \
+                y2[k] = func((wc_t)y0[k], (wc_t)y1[k]);                     \
+            }                                                               \
+                                                                            \
+            gm::half_narrow_##isa(x2+i, y2, n);                             \
+        }                                                                   \
+    }                                                                       \
+    else {                                                                  \
+        for (int64_t i = 0; i < N; i++) {                                   \
+            x2[i] = func((common##_t)x0[i], (common##_t)x1[i]);             \
+        }                                                                   \
+    }                                                                       \
+}                                                                           \
+                                                                            \
+static target void                                                          \
+binary_1D_Z_##name##_##t0##_##t1##_##t2##_##isa(                            \
+    const t0##_t *x0, const t1##_t *x1, t2##_t *x2,                         \
+    const int64_t s0, const int64_t N)                                      \
+{                                                                           \
+    typedef gm::half_wide<t0##_t>::type w0_t;                               \
+    typedef gm::half_wide<t1##_t>::type w1_t;                               \
+    typedef gm::half_wide<t2##_t>::type w2_t;                               \
+    typedef gm::half_wide<common##_t>::type wc_t;                           \
+                                                                            \
+    if (gm::half_wide<t0##_t>::value || gm::half_wide<t1##_t>::value ||     \
+        gm::half_wide<t2##_t>::value) {                                     \
+        w0_t b0[GM_HALF_BLOCKSIZE];                                         \
+        w1_t b1[GM_HALF_BLOCKSIZE];                                         \
+        w2_t b2[GM_HALF_BLOCKSIZE];                                         \
+        const wc_t c0 = (wc_t)(w0_t)x0[0];                                  \
+        const wc_t c1 = (wc_t)(w1_t)x1[0];                                  \
+                                                                            \
+        for (int64_t i = 0; i < N; i += GM_HALF_BLOCKSIZE) {                \
+            const int64_t n = std::min<int64_t>(N-i, GM_HALF_BLOCKSIZE);    \
+            w2_t *y2 = gm::half_out(x2+i, b2);                              \
+                                                                            \
+            if (s0 == 0) {                                                  \
+                const w1_t *y1 = gm::half_widen_##isa(x1+i, b1, n);         \
+                for (int64_t k = 0; k < n; k++) {                           \
+                    y2[k] = func(c0, (wc_t)y1[k]);                          \
+                }                                                           \
+            }                                                               \
+            else {                                                          \
+                const w0_t *y0 = gm::half_widen_##isa(x0+i, b0, n);         \
+                for (int64_t k = 0; k < n; k++) {                           \
+                    y2[k] = func((wc_t)y0[k], c1);                          \
+                }                                                           \
+            }                                                               \
+                                                                            \
+            gm::half_narrow_##isa(x2+i, y2, n);                             \
+        }                                                                   \
+    }                                                                       \
+    else if (s0 == 0) {                                                     \
+        const common##_t c = (common##_t)x0[0];                             \
+        for (int64_t i = 0; i < N; i++) {                                   \
+            x2[i] = func(c, (common##_t)x1[i]);                             \
+        }                                                                   \
+    }                                                                       \
+    else {                                                                  \
+        const common##_t c = (common##_t)x1[0];                             \
+        for (int64_t i = 0; i < N; i++) {                                   \
+            x2[i] = func((common##_t)x0[i], c);                             \
+        }                                                                   \
+    }                                                                       \
+}
+
+/*
+ * Only the kernels for inputs of the same type are cloned per instruction
+ * set.  Mixed input types are much rarer and use the baseline loop, which
+ * keeps the size and the compile time of this file reasonable.
+ */
+#ifdef GM_ISA_DISPATCH
+  #define CPU_DEVICE_BINARY_CLONES(name, func, t0, t1, t2, common) \
+    CPU_DEVICE_BINARY_LOOP(name, func, t0, t1, t2, common, base, )                  \
+    CPU_DEVICE_BINARY_LOOP(name, func, t0, t1, t2, common, avx2, GM_TARGET_AVX2)     \
+    CPU_DEVICE_BINARY_LOOP(name, func, t0, t1, t2, common, avx512, GM_TARGET_AVX512)
+#else
+  #define CPU_DEVICE_BINARY_CLONES(name, func, t0, t1, t2, common) \
+    CPU_DEVICE_BINARY_LOOP(name, func, t0, t1, t2, common, base, )
+#endif
+
+#define CPU_DEVICE_BINARY_BASE(name, func, t0, t1, t2, common) \
+    CPU_DEVICE_BINARY_LOOP(name, func, t0, t1, t2, common, base, )
+
+#define CPU_DEVICE_BINARY_1D_C_LOOP(name, func, t0, t1, t2, common, clones, call) \
+clones(name, func, t0, t1, t2, common)                                      \
+                                                                            \
+extern "C" void                                                             \
+gm_cpu_device_fixed_1D_C_##name##_##t0##_##t1##_##t2(                       \
+    const char *a0, const char *a1, char *a2,                               \
+    const int64_t N)                                                        \
+{                                                                           \
+    const t0##_t *x0 = (const t0##_t *)a0;                                  \
+    const t1##_t *x1 = (const t1##_t *)a1;                                  \
+    t2##_t *x2 = (t2##_t *)a2;                                              \
+                                                                            \
+    call(binary_1D_C_##name##_##t0##_##t1##_##t2, (x0, x1, x2, N))          \
+}                                                                           \
+                                                                            \
+extern "C" void                                                             \
+gm_cpu_device_fixed_1D_Z_##name##_##t0##_##t1##_##t2(                       \
+    const char *a0, const char *a1, char *a2,                               \
+    const int64_t s0, const int64_t s1,                                     \
+    const int64_t N)                                                        \
+{                                                                           \
+    const t0##_t *x0 = (const t0##_t *)a0;                                  \
+    const t1##_t *x1 = (const t1##_t *)a1;                                  \
+    t2##_t *x2 = (t2##_t *)a2;                                              \
+    (void)s1;                                                               \
+                                                                            \
+    call(binary_1D_Z_##name##_##t0##_##t1##_##t2, (x0, x1, x2, s0, N))      \
+}
+
+#define CPU_DEVICE_BINARY_1D_C_ISA(name, func, t0, t1, t2, common) \
+    CPU_DEVICE_BINARY_1D_C_LOOP(name, func, t0, t1, t2, common,     \
+                                CPU_DEVICE_BINARY_CLONES, GM_ISA_CALL)
+
+#define CPU_DEVICE_BINARY_1D_C_BASE(name, func, t0, t1, t2, common) \
+    CPU_DEVICE_BINARY_1D_C_LOOP(name, func, t0, t1, t2, common,      \
+                                CPU_DEVICE_BINARY_BASE, GM_ISA_CALL_BASE)
+
+#define CPU_DEVICE_BINARY_1D_S_0D(name, func, t0, t1, t2, common) \
+extern "C" void                                                             \
 gm_cpu_device_fixed_1D_S_##name##_##t0##_##t1##_##t2(                       \
     const char *a0, const char *a1, char *a2,                               \
     const int64_t s0, const int64_t s1, const int64_t s2,                   \
@@ -95,11 +283,29 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     *x2 = func((common##_t)x0, (common##_t)x1);                             \
 }
 
+/*
+ * For the function families that benefit from vectorization, the contiguous
+ * kernels are redefined to CPU_DEVICE_BINARY_1D_C_BASE and, for inputs of the
+ * same type, to CPU_DEVICE_BINARY_1D_C_ISA.
+ */
+#define CPU_DEVICE_BINARY_1D_C CPU_DEVICE_BINARY_1D_C_SCALAR
+#define CPU_DEVICE_BINARY_1D_C_SAME CPU_DEVICE_BINARY_1D_C_SCALAR
+
+#define CPU_DEVICE_BINARY(name, func, t0, t1, t2, common) \
+    CPU_DEVICE_BINARY_1D_C(name, func, t0, t1, t2, common) \
+    CPU_DEVICE_BINARY_1D_S_0D(name, func, t0, t1, t2, common)
+
+#define CPU_DEVICE_BINARY_SAME(name, func, t0, t1, t2, common) \
+    CPU_DEVICE_BINARY_1D_C_SAME(name, func, t0, t1, t2, common) \
+    CPU_DEVICE_BINARY_1D_S_0D(name, func, t0, t1, t2, common)
+
+/* Complex kernels do not vectorize, they are always scalar. */
 #ifdef _MSC_VER
   #define CPU_DEVICE_BINARYC(name, func, t0, t1, t2, common)
 #else
   #define CPU_DEVICE_BINARYC(name, func, t0, t1, t2, common) \
-    CPU_DEVICE_BINARY(name, func, t0, t1, t2, common)
+    CPU_DEVICE_BINARY_1D_C_SCALAR(name, func, t0, t1, t2, common) \
+    CPU_DEVICE_BINARY_1D_S_0D(name, func, t0, t1, t2, common)
 #endif
 
 #define CPU_DEVICE_NOIMPL(name, func, t0, t1, t2, common)
@@ -111,7 +317,7 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
 /*****************************************************************************/
 
 #define CPU_DEVICE_ALL_BINARY(name, func, hfunc) \
-    CPU_DEVICE_BINARY(name, func, uint8, uint8, uint8, uint8)                      \
+    CPU_DEVICE_BINARY_SAME(name, func, uint8, uint8, uint8, uint8)                 \
     CPU_DEVICE_BINARY(name, func, uint8, uint16, uint16, uint16)                   \
     CPU_DEVICE_BINARY(name, func, uint8, uint32, uint32, uint32)                   \
     CPU_DEVICE_BINARY(name, func, uint8, uint64, uint64, uint64)                   \
@@ -120,7 +326,7 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, uint8, int32, int32, int32)                      \
     CPU_DEVICE_BINARY(name, func, uint8, int64, int64, int64)                      \
     CPU_DEVICE_BINARY(name, func, uint8, bfloat16, bfloat16, bfloat16)             \
-    CPU_DEVICE_NOIMPL(name, hfunc, uint8, float16, float16, float16)               \
+    CPU_DEVICE_BINARY(name, hfunc, uint8, float16, float16, float16)               \
     CPU_DEVICE_BINARY(name, func, uint8, float32, float32, float32)                \
     CPU_DEVICE_BINARY(name, func, uint8, float64, float64, float64)                \
     CPU_DEVICE_NOIMPL(name, func, uint8, complex32, complex32, complex32)          \
@@ -128,7 +334,7 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARYC(name, func, uint8, complex128, complex128, complex128)      \
                                                                                    \
     CPU_DEVICE_BINARY(name, func, uint16, uint8, uint16, uint16)                   \
-    CPU_DEVICE_BINARY(name, func, uint16, uint16, uint16, uint16)                  \
+    CPU_DEVICE_BINARY_SAME(name, func, uint16, uint16, uint16, uint16)             \
     CPU_DEVICE_BINARY(name, func, uint16, uint32, uint32, uint32)                  \
     CPU_DEVICE_BINARY(name, func, uint16, uint64, uint64, uint64)                  \
     CPU_DEVICE_BINARY(name, func, uint16, int8, int32, int32)                      \
@@ -136,7 +342,7 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, uint16, int32, int32, int32)                     \
     CPU_DEVICE_BINARY(name, func, uint16, int64, int64, int64)                     \
     CPU_DEVICE_BINARY(name, func, uint16, bfloat16, float32, float32)              \
-    CPU_DEVICE_NOIMPL(name, func, uint16, float16, float32, float32)               \
+    CPU_DEVICE_BINARY(name, func, uint16, float16, float32, float32)               \
     CPU_DEVICE_BINARY(name, func, uint16, float32, float32, float32)               \
     CPU_DEVICE_BINARY(name, func, uint16, float64, float64, float64)               \
     CPU_DEVICE_NOIMPL(name, func, uint16, complex32, complex64, complex64)         \
@@ -145,14 +351,14 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
                                                                                    \
     CPU_DEVICE_BINARY(name, func, uint32, uint8, uint32, uint32)                   \
     CPU_DEVICE_BINARY(name, func, uint32, uint16, uint32, uint32)                  \
-    CPU_DEVICE_BINARY(name, func, uint32, uint32, uint32, uint32)                  \
+    CPU_DEVICE_BINARY_SAME(name, func, uint32, uint32, uint32, uint32)             \
     CPU_DEVICE_BINARY(name, func, uint32, uint64, uint64, uint64)                  \
     CPU_DEVICE_BINARY(name, func, uint32, int8, int64, int64)                      \
     CPU_DEVICE_BINARY(name, func, uint32, int16, int64, int64)                     \
     CPU_DEVICE_BINARY(name, func, uint32, int32, int64, int64)                     \
     CPU_DEVICE_BINARY(name, func, uint32, int64, int64, int64)                     \
     CPU_DEVICE_BINARY(name, func, uint32, bfloat16, float64, float64)              \
-    CPU_DEVICE_NOIMPL(name, func, uint32, float16, float64, float64)               \
+    CPU_DEVICE_BINARY(name, func, uint32, float16, float64, float64)               \
     CPU_DEVICE_BINARY(name, func, uint32, float32, float64, float64)               \
     CPU_DEVICE_BINARY(name, func, uint32, float64, float64, float64)               \
     CPU_DEVICE_NOIMPL(name, func, uint32, complex32, complex128, complex128)       \
@@ -162,17 +368,17 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, uint64, uint8, uint64, uint64)                   \
     CPU_DEVICE_BINARY(name, func, uint64, uint16, uint64, uint64)                  \
     CPU_DEVICE_BINARY(name, func, uint64, uint32, uint64, uint64)                  \
-    CPU_DEVICE_BINARY(name, func, uint64, uint64, uint64, uint64)                  \
+    CPU_DEVICE_BINARY_SAME(name, func, uint64, uint64, uint64, uint64)             \
                                                                                    \
     CPU_DEVICE_BINARY(name, func, int8, uint8, int16, int16)                       \
     CPU_DEVICE_BINARY(name, func, int8, uint16, int32, int32)                      \
     CPU_DEVICE_BINARY(name, func, int8, uint32, int64, int64)                      \
-    CPU_DEVICE_BINARY(name, func, int8, int8, int8, int8)                          \
+    CPU_DEVICE_BINARY_SAME(name, func, int8, int8, int8, int8)                     \
     CPU_DEVICE_BINARY(name, func, int8, int16, int16, int16)                       \
     CPU_DEVICE_BINARY(name, func, int8, int32, int32, int32)                       \
     CPU_DEVICE_BINARY(name, func, int8, int64, int64, int64)                       \
     CPU_DEVICE_BINARY(name, func, int8, bfloat16, bfloat16, bfloat16)              \
-    CPU_DEVICE_NOIMPL(name, hfunc, int8, float16, float16, float16)                \
+    CPU_DEVICE_BINARY(name, hfunc, int8, float16, float16, float16)                \
     CPU_DEVICE_BINARY(name, func, int8, float32, float32, float32)                 \
     CPU_DEVICE_BINARY(name, func, int8, float64, float64, float64)                 \
     CPU_DEVICE_NOIMPL(name, func, int8, complex32, complex32, complex32)           \
@@ -183,11 +389,11 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, int16, uint16, int32, int32)                     \
     CPU_DEVICE_BINARY(name, func, int16, uint32, int64, int64)                     \
     CPU_DEVICE_BINARY(name, func, int16, int8, int16, int16)                       \
-    CPU_DEVICE_BINARY(name, func, int16, int16, int16, int16)                      \
+    CPU_DEVICE_BINARY_SAME(name, func, int16, int16, int16, int16)                 \
     CPU_DEVICE_BINARY(name, func, int16, int32, int32, int32)                      \
     CPU_DEVICE_BINARY(name, func, int16, int64, int64, int64)                      \
     CPU_DEVICE_BINARY(name, func, int16, bfloat16, float32, float32)               \
-    CPU_DEVICE_NOIMPL(name, func, int16, float16, float32, float32)                \
+    CPU_DEVICE_BINARY(name, func, int16, float16, float32, float32)                \
     CPU_DEVICE_BINARY(name, func, int16, float32, float32, float32)                \
     CPU_DEVICE_BINARY(name, func, int16, float64, float64, float64)                \
     CPU_DEVICE_NOIMPL(name, func, int16, complex32, complex64, complex64)          \
@@ -199,10 +405,10 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, int32, uint32, int64, int64)                     \
     CPU_DEVICE_BINARY(name, func, int32, int8, int32, int32)                       \
     CPU_DEVICE_BINARY(name, func, int32, int16, int32, int32)                      \
-    CPU_DEVICE_BINARY(name, func, int32, int32, int32, int32)                      \
+    CPU_DEVICE_BINARY_SAME(name, func, int32, int32, int32, int32)                 \
     CPU_DEVICE_BINARY(name, func, int32, int64, int64, int64)                      \
     CPU_DEVICE_BINARY(name, func, int32, bfloat16, float64, float64)               \
-    CPU_DEVICE_NOIMPL(name, func, int32, float16, float64, float64)                \
+    CPU_DEVICE_BINARY(name, func, int32, float16, float64, float64)                \
     CPU_DEVICE_BINARY(name, func, int32, float32, float64, float64)                \
     CPU_DEVICE_BINARY(name, func, int32, float64, float64, float64)                \
     CPU_DEVICE_NOIMPL(name, func, int32, complex32, complex128, complex128)        \
@@ -215,7 +421,7 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, int64, int8, int64, int64)                       \
     CPU_DEVICE_BINARY(name, func, int64, int16, int64, int64)                      \
     CPU_DEVICE_BINARY(name, func, int64, int32, int64, int64)                      \
-    CPU_DEVICE_BINARY(name, func, int64, int64, int64, int64)                      \
+    CPU_DEVICE_BINARY_SAME(name, func, int64, int64, int64, int64)                 \
                                                                                    \
     CPU_DEVICE_BINARY(name, func, bfloat16, uint8, bfloat16, bfloat16)             \
     CPU_DEVICE_BINARY(name, func, bfloat16, uint16, float32, float32)              \
@@ -223,27 +429,27 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, bfloat16, int8, bfloat16, bfloat16)              \
     CPU_DEVICE_BINARY(name, func, bfloat16, int16, float32, float32)               \
     CPU_DEVICE_BINARY(name, func, bfloat16, int32, float64, float64)               \
-    CPU_DEVICE_BINARY(name, func, bfloat16, bfloat16, bfloat16, bfloat16)          \
-    CPU_DEVICE_NOIMPL(name, func, bfloat16, float16, float32, float32)             \
+    CPU_DEVICE_BINARY_SAME(name, func, bfloat16, bfloat16, bfloat16, bfloat16)     \
+    CPU_DEVICE_BINARY(name, func, bfloat16, float16, float32, float32)             \
     CPU_DEVICE_BINARY(name, func, bfloat16, float32, float32, float32)             \
     CPU_DEVICE_BINARY(name, func, bfloat16, float64, float64, float64)             \
     CPU_DEVICE_NOIMPL(name, func, bfloat16, complex32, complex32, complex64)       \
     CPU_DEVICE_BINARY(name, func, bfloat16, complex64, complex64, complex64)       \
     CPU_DEVICE_BINARY(name, func, bfloat16, complex128, complex128, complex128)    \
                                                                                    \
-    CPU_DEVICE_NOIMPL(name, hfunc, float16, uint8, float16, float16)               \
-    CPU_DEVICE_NOIMPL(name, func, float16, uint16, float32, float32)               \
-    CPU_DEVICE_NOIMPL(name, func, float16, uint32, float64, float64)               \
-    CPU_DEVICE_NOIMPL(name, hfunc, float16, int8, float16, float16)                \
-    CPU_DEVICE_NOIMPL(name, func, float16, int16, float32, float32)                \
-    CPU_DEVICE_NOIMPL(name, func, float16, int32, float64, float64)                \
-    CPU_DEVICE_NOIMPL(name, func, float16, bfloat16, float32, float32)             \
-    CPU_DEVICE_NOIMPL(name, hfunc, float16, float16, float16, float16)             \
-    CPU_DEVICE_NOIMPL(name, func, float16, float32, float32, float32)              \
-    CPU_DEVICE_NOIMPL(name, func, float16, float64, float64, float64)              \
+    CPU_DEVICE_BINARY(name, hfunc, float16, uint8, float16, float16)               \
+    CPU_DEVICE_BINARY(name, func, float16, uint16, float32, float32)               \
+    CPU_DEVICE_BINARY(name, func, float16, uint32, float64, float64)               \
+    CPU_DEVICE_BINARY(name, hfunc, float16, int8, float16, float16)                \
+    CPU_DEVICE_BINARY(name, func, float16, int16, float32, float32)                \
+    CPU_DEVICE_BINARY(name, func, float16, int32, float64, float64)                \
+    CPU_DEVICE_BINARY(name, func, float16, bfloat16, float32, float32)             \
+    CPU_DEVICE_BINARY_SAME(name, hfunc, float16, float16, float16, float16)        \
+    CPU_DEVICE_BINARY(name, func, float16, float32, float32, float32)              \
+    CPU_DEVICE_BINARY(name, func, float16, float64, float64, float64)              \
     CPU_DEVICE_NOIMPL(name, func, float16, complex32, complex32, complex32)        \
-    CPU_DEVICE_NOIMPL(name, func, float16, complex64, complex64, complex64)        \
-    CPU_DEVICE_NOIMPL(name, func, float16, complex128, complex128, complex128)     \
+    CPU_DEVICE_BINARY(name, func, float16, complex64, complex64, complex64)        \
+    CPU_DEVICE_BINARY(name, func, float16, complex128, complex128, complex128)     \
                                                                                    \
     CPU_DEVICE_BINARY(name, func, float32, uint8, float32, float32)                \
     CPU_DEVICE_BINARY(name, func, float32, uint16, float32, float32)               \
@@ -252,8 +458,8 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, float32, int16, float32, float32)                \
     CPU_DEVICE_BINARY(name, func, float32, int32, float64, float64)                \
     CPU_DEVICE_BINARY(name, func, float32, bfloat16, float32, float32)             \
-    CPU_DEVICE_NOIMPL(name, func, float32, float16, float32, float32)              \
-    CPU_DEVICE_BINARY(name, func, float32, float32, float32, float32)              \
+    CPU_DEVICE_BINARY(name, func, float32, float16, float32, float32)              \
+    CPU_DEVICE_BINARY_SAME(name, func, float32, float32, float32, float32)         \
     CPU_DEVICE_BINARY(name, func, float32, float64, float64, float64)              \
     CPU_DEVICE_NOIMPL(name, func, float32, complex32, complex64, complex64)        \
     CPU_DEVICE_BINARYC(name, func, float32, complex64, complex64, complex64)       \
@@ -266,9 +472,9 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, float64, int16, float64, float64)                \
     CPU_DEVICE_BINARY(name, func, float64, int32, float64, float64)                \
     CPU_DEVICE_BINARY(name, func, float64, bfloat16, float64, float64)             \
-    CPU_DEVICE_NOIMPL(name, func, float64, float16, float64, float64)              \
+    CPU_DEVICE_BINARY(name, func, float64, float16, float64, float64)              \
     CPU_DEVICE_BINARY(name, func, float64, float32, float64, float64)              \
-    CPU_DEVICE_BINARY(name, func, float64, float64, float64, float64)              \
+    CPU_DEVICE_BINARY_SAME(name, func, float64, float64, float64, float64)         \
     CPU_DEVICE_NOIMPL(name, func, float64, complex32, complex128, complex128)      \
     CPU_DEVICE_BINARYC(name, func, float64, complex64, complex128, complex128)     \
     CPU_DEVICE_BINARYC(name, func, float64, complex128, complex128, complex128)    \
@@ -294,7 +500,7 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARYC(name, func, complex64, int16, complex64, complex64)         \
     CPU_DEVICE_BINARYC(name, func, complex64, int32, complex128, complex128)       \
     CPU_DEVICE_BINARY(name, func, complex64, bfloat16, complex64, complex64)       \
-    CPU_DEVICE_NOIMPL(name, func, complex64, float16, complex64, complex64)        \
+    CPU_DEVICE_BINARY(name, func, complex64, float16, complex64, complex64)        \
     CPU_DEVICE_BINARYC(name, func, complex64, float32, complex64, complex64)       \
     CPU_DEVICE_BINARYC(name, func, complex64, float64, complex128, complex128)     \
     CPU_DEVICE_NOIMPL(name, func, complex64, complex32, complex64, complex64)      \
@@ -308,7 +514,7 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARYC(name, func, complex128, int16, complex128, complex128)      \
     CPU_DEVICE_BINARYC(name, func, complex128, int32, complex128, complex128)      \
     CPU_DEVICE_BINARY(name, func, complex128, bfloat16, complex128, complex128)    \
-    CPU_DEVICE_NOIMPL(name, func, complex128, float16, complex128, complex128)     \
+    CPU_DEVICE_BINARY(name, func, complex128, float16, complex128, complex128)     \
     CPU_DEVICE_BINARYC(name, func, complex128, float32, complex128, complex128)    \
     CPU_DEVICE_BINARYC(name, func, complex128, float64, complex128, complex128)    \
     CPU_DEVICE_NOIMPL(name, func, complex128, complex32, complex128, complex128)   \
@@ -316,7 +522,7 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARYC(name, func, complex128, complex128, complex128, complex128)
 
 #define CPU_DEVICE_ALL_BINARY_NO_COMPLEX(name, func, hfunc) \
-    CPU_DEVICE_BINARY(name, func, uint8, uint8, uint8, uint8)                     \
+    CPU_DEVICE_BINARY_SAME(name, func, uint8, uint8, uint8, uint8)                \
     CPU_DEVICE_BINARY(name, func, uint8, uint16, uint16, uint16)                  \
     CPU_DEVICE_BINARY(name, func, uint8, uint32, uint32, uint32)                  \
     CPU_DEVICE_BINARY(name, func, uint8, uint64, uint64, uint64)                  \
@@ -325,7 +531,7 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, uint8, int32, int32, int32)                     \
     CPU_DEVICE_BINARY(name, func, uint8, int64, int64, int64)                     \
     CPU_DEVICE_BINARY(name, func, uint8, bfloat16, bfloat16, bfloat16)            \
-    CPU_DEVICE_NOIMPL(name, hfunc, uint8, float16, float16, float16)              \
+    CPU_DEVICE_BINARY(name, hfunc, uint8, float16, float16, float16)              \
     CPU_DEVICE_BINARY(name, func, uint8, float32, float32, float32)               \
     CPU_DEVICE_BINARY(name, func, uint8, float64, float64, float64)               \
     CPU_DEVICE_NOKERN(name, func, uint8, complex32, complex32, complex32)         \
@@ -333,7 +539,7 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_NOKERN(name, func, uint8, complex128, complex128, complex128)      \
                                                                                   \
     CPU_DEVICE_BINARY(name, func, uint16, uint8, uint16, uint16)                  \
-    CPU_DEVICE_BINARY(name, func, uint16, uint16, uint16, uint16)                 \
+    CPU_DEVICE_BINARY_SAME(name, func, uint16, uint16, uint16, uint16)            \
     CPU_DEVICE_BINARY(name, func, uint16, uint32, uint32, uint32)                 \
     CPU_DEVICE_BINARY(name, func, uint16, uint64, uint64, uint64)                 \
     CPU_DEVICE_BINARY(name, func, uint16, int8, int32, int32)                     \
@@ -341,7 +547,7 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, uint16, int32, int32, int32)                    \
     CPU_DEVICE_BINARY(name, func, uint16, int64, int64, int64)                    \
     CPU_DEVICE_BINARY(name, func, uint16, bfloat16, float32, float32)             \
-    CPU_DEVICE_NOIMPL(name, func, uint16, float16, float32, float32)              \
+    CPU_DEVICE_BINARY(name, func, uint16, float16, float32, float32)              \
     CPU_DEVICE_BINARY(name, func, uint16, float32, float32, float32)              \
     CPU_DEVICE_BINARY(name, func, uint16, float64, float64, float64)              \
     CPU_DEVICE_NOKERN(name, func, uint16, complex32, complex64, complex64)        \
@@ -350,14 +556,14 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
                                                                                   \
     CPU_DEVICE_BINARY(name, func, uint32, uint8, uint32, uint32)                  \
     CPU_DEVICE_BINARY(name, func, uint32, uint16, uint32, uint32)                 \
-    CPU_DEVICE_BINARY(name, func, uint32, uint32, uint32, uint32)                 \
+    CPU_DEVICE_BINARY_SAME(name, func, uint32, uint32, uint32, uint32)            \
     CPU_DEVICE_BINARY(name, func, uint32, uint64, uint64, uint64)                 \
     CPU_DEVICE_BINARY(name, func, uint32, int8, int64, int64)                     \
     CPU_DEVICE_BINARY(name, func, uint32, int16, int64, int64)                    \
     CPU_DEVICE_BINARY(name, func, uint32, int32, int64, int64)                    \
     CPU_DEVICE_BINARY(name, func, uint32, int64, int64, int64)                    \
     CPU_DEVICE_BINARY(name, func, uint32, bfloat16, float64, float64)             \
-    CPU_DEVICE_NOIMPL(name, func, uint32, float16, float64, float64)              \
+    CPU_DEVICE_BINARY(name, func, uint32, float16, float64, float64)              \
     CPU_DEVICE_BINARY(name, func, uint32, float32, float64, float64)              \
     CPU_DEVICE_BINARY(name, func, uint32, float64, float64, float64)              \
     CPU_DEVICE_NOKERN(name, func, uint32, complex32, complex128, complex128)      \
@@ -367,17 +573,17 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, uint64, uint8, uint64, uint64)                  \
     CPU_DEVICE_BINARY(name, func, uint64, uint16, uint64, uint64)                 \
     CPU_DEVICE_BINARY(name, func, uint64, uint32, uint64, uint64)                 \
-    CPU_DEVICE_BINARY(name, func, uint64, uint64, uint64, uint64)                 \
+    CPU_DEVICE_BINARY_SAME(name, func, uint64, uint64, uint64, uint64)            \
                                                                                   \
     CPU_DEVICE_BINARY(name, func, int8, uint8, int16, int16)                      \
     CPU_DEVICE_BINARY(name, func, int8, uint16, int32, int32)                     \
     CPU_DEVICE_BINARY(name, func, int8, uint32, int64, int64)                     \
-    CPU_DEVICE_BINARY(name, func, int8, int8, int8, int8)                         \
+    CPU_DEVICE_BINARY_SAME(name, func, int8, int8, int8, int8)                    \
     CPU_DEVICE_BINARY(name, func, int8, int16, int16, int16)                      \
     CPU_DEVICE_BINARY(name, func, int8, int32, int32, int32)                      \
     CPU_DEVICE_BINARY(name, func, int8, int64, int64, int64)                      \
     CPU_DEVICE_BINARY(name, func, int8, bfloat16, bfloat16, bfloat16)             \
-    CPU_DEVICE_NOIMPL(name, hfunc, int8, float16, float16, float16)               \
+    CPU_DEVICE_BINARY(name, hfunc, int8, float16, float16, float16)               \
     CPU_DEVICE_BINARY(name, func, int8, float32, float32, float32)                \
     CPU_DEVICE_BINARY(name, func, int8, float64, float64, float64)                \
     CPU_DEVICE_NOKERN(name, func, int8, complex32, complex32, complex32)          \
@@ -388,11 +594,11 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, int16, uint16, int32, int32)                    \
     CPU_DEVICE_BINARY(name, func, int16, uint32, int64, int64)                    \
     CPU_DEVICE_BINARY(name, func, int16, int8, int16, int16)                      \
-    CPU_DEVICE_BINARY(name, func, int16, int16, int16, int16)                     \
+    CPU_DEVICE_BINARY_SAME(name, func, int16, int16, int16, int16)                \
     CPU_DEVICE_BINARY(name, func, int16, int32, int32, int32)                     \
     CPU_DEVICE_BINARY(name, func, int16, int64, int64, int64)                     \
     CPU_DEVICE_BINARY(name, func, int16, bfloat16, float32, float32)              \
-    CPU_DEVICE_NOIMPL(name, func, int16, float16, float32, float32)               \
+    CPU_DEVICE_BINARY(name, func, int16, float16, float32, float32)               \
     CPU_DEVICE_BINARY(name, func, int16, float32, float32, float32)               \
     CPU_DEVICE_BINARY(name, func, int16, float64, float64, float64)               \
     CPU_DEVICE_NOKERN(name, func, int16, complex32, complex64, complex64)         \
@@ -404,10 +610,10 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, int32, uint32, int64, int64)                    \
     CPU_DEVICE_BINARY(name, func, int32, int8, int32, int32)                      \
     CPU_DEVICE_BINARY(name, func, int32, int16, int32, int32)                     \
-    CPU_DEVICE_BINARY(name, func, int32, int32, int32, int32)                     \
+    CPU_DEVICE_BINARY_SAME(name, func, int32, int32, int32, int32)                \
     CPU_DEVICE_BINARY(name, func, int32, int64, int64, int64)                     \
     CPU_DEVICE_BINARY(name, func, int32, bfloat16, float64, float64)              \
-    CPU_DEVICE_NOIMPL(name, func, int32, float16, float64, float64)               \
+    CPU_DEVICE_BINARY(name, func, int32, float16, float64, float64)               \
     CPU_DEVICE_BINARY(name, func, int32, float32, float64, float64)               \
     CPU_DEVICE_BINARY(name, func, int32, float64, float64, float64)               \
     CPU_DEVICE_NOKERN(name, func, int32, complex32, complex128, complex128)       \
@@ -420,7 +626,7 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, int64, int8, int64, int64)                      \
     CPU_DEVICE_BINARY(name, func, int64, int16, int64, int64)                     \
     CPU_DEVICE_BINARY(name, func, int64, int32, int64, int64)                     \
-    CPU_DEVICE_BINARY(name, func, int64, int64, int64, int64)                     \
+    CPU_DEVICE_BINARY_SAME(name, func, int64, int64, int64, int64)                \
                                                                                   \
     CPU_DEVICE_BINARY(name, func, bfloat16, uint8, bfloat16, bfloat16)            \
     CPU_DEVICE_BINARY(name, func, bfloat16, uint16, float32, float32)             \
@@ -428,24 +634,24 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, bfloat16, int8, bfloat16, bfloat16)             \
     CPU_DEVICE_BINARY(name, func, bfloat16, int16, float32, float32)              \
     CPU_DEVICE_BINARY(name, func, bfloat16, int32, float64, float64)              \
-    CPU_DEVICE_BINARY(name, func, bfloat16, bfloat16, bfloat16, bfloat16)         \
-    CPU_DEVICE_NOIMPL(name, func, bfloat16, float16, float32, float32)            \
+    CPU_DEVICE_BINARY_SAME(name, func, bfloat16, bfloat16, bfloat16, bfloat16)    \
+    CPU_DEVICE_BINARY(name, func, bfloat16, float16, float32, float32)            \
     CPU_DEVICE_BINARY(name, func, bfloat16, float32, float32, float32)            \
     CPU_DEVICE_BINARY(name, func, bfloat16, float64, float64, float64)            \
     CPU_DEVICE_NOKERN(name, func, bfloat16, complex32, complex32, complex32)      \
     CPU_DEVICE_NOKERN(name, func, bfloat16, complex64, complex64, complex64)      \
     CPU_DEVICE_NOKERN(name, func, bfloat16, complex128, complex128, complex128)   \
                                                                                   \
-    CPU_DEVICE_NOIMPL(name, hfunc, float16, uint8, float16, float16)              \
-    CPU_DEVICE_NOIMPL(name, func, float16, uint16, float32, float32)              \
-    CPU_DEVICE_NOIMPL(name, func, float16, uint32, float64, float64)              \
-    CPU_DEVICE_NOIMPL(name, hfunc, float16, int8, float16, float16)               \
-    CPU_DEVICE_NOIMPL(name, func, float16, int16, float32, float32)               \
-    CPU_DEVICE_NOIMPL(name, func, float16, int32, float64, float64)               \
-    CPU_DEVICE_NOIMPL(name, func, float16, bfloat16, float32, float32)            \
-    CPU_DEVICE_NOIMPL(name, hfunc, float16, float16, float16, float16)            \
-    CPU_DEVICE_NOIMPL(name, func, float16, float32, float32, float32)             \
-    CPU_DEVICE_NOIMPL(name, func, float16, float64, float64, float64)             \
+    CPU_DEVICE_BINARY(name, hfunc, float16, uint8, float16, float16)              \
+    CPU_DEVICE_BINARY(name, func, float16, uint16, float32, float32)              \
+    CPU_DEVICE_BINARY(name, func, float16, uint32, float64, float64)              \
+    CPU_DEVICE_BINARY(name, hfunc, float16, int8, float16, float16)               \
+    CPU_DEVICE_BINARY(name, func, float16, int16, float32, float32)               \
+    CPU_DEVICE_BINARY(name, func, float16, int32, float64, float64)               \
+    CPU_DEVICE_BINARY(name, func, float16, bfloat16, float32, float32)            \
+    CPU_DEVICE_BINARY_SAME(name, hfunc, float16, float16, float16, float16)       \
+    CPU_DEVICE_BINARY(name, func, float16, float32, float32, float32)             \
+    CPU_DEVICE_BINARY(name, func, float16, float64, float64, float64)             \
     CPU_DEVICE_NOKERN(name, func, float16, complex32, complex32, complex32)       \
     CPU_DEVICE_NOKERN(name, func, float16, complex64, complex64, complex64)       \
     CPU_DEVICE_NOKERN(name, func, float16, complex128, complex128, complex128)    \
@@ -457,8 +663,8 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, float32, int16, float32, float32)               \
     CPU_DEVICE_BINARY(name, func, float32, int32, float64, float64)               \
     CPU_DEVICE_BINARY(name, func, float32, bfloat16, float32, float32)            \
-    CPU_DEVICE_NOIMPL(name, func, float32, float16, float32, float32)             \
-    CPU_DEVICE_BINARY(name, func, float32, float32, float32, float32)             \
+    CPU_DEVICE_BINARY(name, func, float32, float16, float32, float32)             \
+    CPU_DEVICE_BINARY_SAME(name, func, float32, float32, float32, float32)        \
     CPU_DEVICE_BINARY(name, func, float32, float64, float64, float64)             \
     CPU_DEVICE_NOKERN(name, func, float32, complex32, complex64, complex64)       \
     CPU_DEVICE_NOKERN(name, func, float32, complex64, complex64, complex64)       \
@@ -471,9 +677,9 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, float64, int16, float64, float64)               \
     CPU_DEVICE_BINARY(name, func, float64, int32, float64, float64)               \
     CPU_DEVICE_BINARY(name, func, float64, bfloat16, float64, float64)            \
-    CPU_DEVICE_NOIMPL(name, func, float64, float16, float64, float64)             \
+    CPU_DEVICE_BINARY(name, func, float64, float16, float64, float64)             \
     CPU_DEVICE_BINARY(name, func, float64, float32, float64, float64)             \
-    CPU_DEVICE_BINARY(name, func, float64, float64, float64, float64)             \
+    CPU_DEVICE_BINARY_SAME(name, func, float64, float64, float64, float64)        \
     CPU_DEVICE_NOKERN(name, func, float64, complex32, complex128, complex128)     \
     CPU_DEVICE_NOKERN(name, func, float64, complex64, complex128, complex128)     \
     CPU_DEVICE_NOKERN(name, func, float64, complex128, complex128, complex128)    \
@@ -513,7 +719,7 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_NOKERN(name, func, complex128, int16, complex128, complex128)      \
     CPU_DEVICE_NOKERN(name, func, complex128, int32, complex128, complex128)      \
     CPU_DEVICE_NOKERN(name, func, complex128, bfloat16, complex128, complex128)   \
-    CPU_DEVICE_NOIMPL(name, func, complex128, float16, complex128, complex128)    \
+    CPU_DEVICE_NOKERN(name, func, complex128, float16, complex128, complex128)    \
     CPU_DEVICE_NOKERN(name, func, complex128, float32, complex128, complex128)    \
     CPU_DEVICE_NOKERN(name, func, complex128, float64, complex128, complex128)    \
     CPU_DEVICE_NOKERN(name, func, complex128, complex32, complex128, complex128)  \
@@ -521,16 +727,16 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_NOKERN(name, func, complex128, complex128, complex128, complex128) \
 
 #define CPU_DEVICE_ALL_BINARY_FLOAT_RETURN(name, func, hfunc) \
-    CPU_DEVICE_NOIMPL(name, hfunc, uint8, uint8, float16, float16)                 \
+    CPU_DEVICE_BINARY_SAME(name, hfunc, uint8, uint8, float16, float16)            \
     CPU_DEVICE_BINARY(name, func, uint8, uint16, float32, float32)                 \
     CPU_DEVICE_BINARY(name, func, uint8, uint32, float64, float64)                 \
     CPU_DEVICE_NOKERN(name, func, uint8, uint64, uint64, uint64)                   \
-    CPU_DEVICE_NOIMPL(name, hfunc, uint8, int8, float16, float16)                  \
+    CPU_DEVICE_BINARY(name, hfunc, uint8, int8, float16, float16)                  \
     CPU_DEVICE_BINARY(name, func, uint8, int16, float32, float32)                  \
     CPU_DEVICE_BINARY(name, func, uint8, int32, float64, float64)                  \
     CPU_DEVICE_NOKERN(name, func, uint8, int64, int64, int64)                      \
     CPU_DEVICE_BINARY(name, func, uint8, bfloat16, bfloat16, bfloat16)             \
-    CPU_DEVICE_NOIMPL(name, hfunc, uint8, float16, float16, float16)               \
+    CPU_DEVICE_BINARY(name, hfunc, uint8, float16, float16, float16)               \
     CPU_DEVICE_BINARY(name, func, uint8, float32, float32, float32)                \
     CPU_DEVICE_BINARY(name, func, uint8, float64, float64, float64)                \
     CPU_DEVICE_NOIMPL(name, func, uint8, complex32, complex32, complex32)          \
@@ -538,7 +744,7 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARYC(name, func, uint8, complex128, complex128, complex128)      \
                                                                                    \
     CPU_DEVICE_BINARY(name, func, uint16, uint8, float32, float32)                 \
-    CPU_DEVICE_BINARY(name, func, uint16, uint16, float32, float32)                \
+    CPU_DEVICE_BINARY_SAME(name, func, uint16, uint16, float32, float32)           \
     CPU_DEVICE_BINARY(name, func, uint16, uint32, float64, float64)                \
     CPU_DEVICE_NOKERN(name, func, uint16, uint64, uint64, uint64)                  \
     CPU_DEVICE_BINARY(name, func, uint16, int8, float32, float32)                  \
@@ -546,7 +752,7 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, uint16, int32, float64, float64)                 \
     CPU_DEVICE_NOKERN(name, func, uint16, int64, int64, int64)                     \
     CPU_DEVICE_BINARY(name, func, uint16, bfloat16, float32, float32)              \
-    CPU_DEVICE_NOIMPL(name, func, uint16, float16, float32, float32)               \
+    CPU_DEVICE_BINARY(name, func, uint16, float16, float32, float32)               \
     CPU_DEVICE_BINARY(name, func, uint16, float32, float32, float32)               \
     CPU_DEVICE_BINARY(name, func, uint16, float64, float64, float64)               \
     CPU_DEVICE_NOIMPL(name, func, uint16, complex32, complex64, complex64)         \
@@ -555,14 +761,14 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
                                                                                    \
     CPU_DEVICE_BINARY(name, func, uint32, uint8, float64, float64)                 \
     CPU_DEVICE_BINARY(name, func, uint32, uint16, float64, float64)                \
-    CPU_DEVICE_BINARY(name, func, uint32, uint32, float64, float64)                \
+    CPU_DEVICE_BINARY_SAME(name, func, uint32, uint32, float64, float64)           \
     CPU_DEVICE_NOKERN(name, func, uint32, uint64, uint64, uint64)                  \
     CPU_DEVICE_BINARY(name, func, uint32, int8, float64, float64)                  \
     CPU_DEVICE_BINARY(name, func, uint32, int16, float64, float64)                 \
     CPU_DEVICE_BINARY(name, func, uint32, int32, float64, float64)                 \
     CPU_DEVICE_NOKERN(name, func, uint32, int64, int64, int64)                     \
     CPU_DEVICE_BINARY(name, func, uint32, bfloat16, float64, float64)              \
-    CPU_DEVICE_NOIMPL(name, func, uint32, float16, float64, float64)               \
+    CPU_DEVICE_BINARY(name, func, uint32, float16, float64, float64)               \
     CPU_DEVICE_BINARY(name, func, uint32, float32, float64, float64)               \
     CPU_DEVICE_BINARY(name, func, uint32, float64, float64, float64)               \
     CPU_DEVICE_NOIMPL(name, func, uint32, complex32, complex128, complex128)       \
@@ -574,15 +780,15 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_NOKERN(name, func, uint64, uint32, uint64, uint64)                  \
     CPU_DEVICE_NOKERN(name, func, uint64, uint64, uint64, uint64)                  \
                                                                                    \
-    CPU_DEVICE_NOIMPL(name, hfunc, int8, uint8, float16, float16)                  \
+    CPU_DEVICE_BINARY(name, hfunc, int8, uint8, float16, float16)                  \
     CPU_DEVICE_BINARY(name, func, int8, uint16, float32, float32)                  \
     CPU_DEVICE_BINARY(name, func, int8, uint32, float64, float64)                  \
-    CPU_DEVICE_NOIMPL(name, hfunc, int8, int8, float16, float16)                   \
+    CPU_DEVICE_BINARY_SAME(name, hfunc, int8, int8, float16, float16)              \
     CPU_DEVICE_BINARY(name, func, int8, int16, float32, float32)                   \
     CPU_DEVICE_BINARY(name, func, int8, int32, float64, float64)                   \
     CPU_DEVICE_NOKERN(name, func, int8, int64, int64, int64)                       \
     CPU_DEVICE_BINARY(name, func, int8, bfloat16, bfloat16, bfloat16)              \
-    CPU_DEVICE_NOIMPL(name, hfunc, int8, float16, float16, float16)                \
+    CPU_DEVICE_BINARY(name, hfunc, int8, float16, float16, float16)                \
     CPU_DEVICE_BINARY(name, func, int8, float32, float32, float32)                 \
     CPU_DEVICE_BINARY(name, func, int8, float64, float64, float64)                 \
     CPU_DEVICE_NOIMPL(name, func, int8, complex32, complex32, complex32)           \
@@ -593,11 +799,11 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, int16, uint16, float32, float32)                 \
     CPU_DEVICE_BINARY(name, func, int16, uint32, float64, float64)                 \
     CPU_DEVICE_BINARY(name, func, int16, int8, float32, float32)                   \
-    CPU_DEVICE_BINARY(name, func, int16, int16, float32, float32)                  \
+    CPU_DEVICE_BINARY_SAME(name, func, int16, int16, float32, float32)             \
     CPU_DEVICE_BINARY(name, func, int16, int32, float64, float64)                  \
     CPU_DEVICE_NOKERN(name, func, int16, int64, int64, int64)                      \
     CPU_DEVICE_BINARY(name, func, int16, bfloat16, float32, float32)               \
-    CPU_DEVICE_NOIMPL(name, func, int16, float16, float32, float32)                \
+    CPU_DEVICE_BINARY(name, func, int16, float16, float32, float32)                \
     CPU_DEVICE_BINARY(name, func, int16, float32, float32, float32)                \
     CPU_DEVICE_BINARY(name, func, int16, float64, float64, float64)                \
     CPU_DEVICE_NOIMPL(name, func, int16, complex32, complex64, complex64)          \
@@ -609,10 +815,10 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, int32, uint32, float64, float64)                 \
     CPU_DEVICE_BINARY(name, func, int32, int8, float64, float64)                   \
     CPU_DEVICE_BINARY(name, func, int32, int16, float64, float64)                  \
-    CPU_DEVICE_BINARY(name, func, int32, int32, float64, float64)                  \
+    CPU_DEVICE_BINARY_SAME(name, func, int32, int32, float64, float64)             \
     CPU_DEVICE_NOKERN(name, func, int32, int64, int64, int64)                      \
     CPU_DEVICE_BINARY(name, func, int32, bfloat16, float64, float64)               \
-    CPU_DEVICE_NOIMPL(name, func, int32, float16, float64, float64)                \
+    CPU_DEVICE_BINARY(name, func, int32, float16, float64, float64)                \
     CPU_DEVICE_BINARY(name, func, int32, float32, float64, float64)                \
     CPU_DEVICE_BINARY(name, func, int32, float64, float64, float64)                \
     CPU_DEVICE_NOIMPL(name, func, int32, complex32, complex128, complex128)        \
@@ -633,27 +839,27 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, bfloat16, int8, bfloat16, bfloat16)              \
     CPU_DEVICE_BINARY(name, func, bfloat16, int16, float32, float32)               \
     CPU_DEVICE_BINARY(name, func, bfloat16, int32, float64, float64)               \
-    CPU_DEVICE_BINARY(name, func, bfloat16, bfloat16, bfloat16, bfloat16)          \
-    CPU_DEVICE_NOIMPL(name, func, bfloat16, float16, float32, float32)             \
+    CPU_DEVICE_BINARY_SAME(name, func, bfloat16, bfloat16, bfloat16, bfloat16)     \
+    CPU_DEVICE_BINARY(name, func, bfloat16, float16, float32, float32)             \
     CPU_DEVICE_BINARY(name, func, bfloat16, float32, float32, float32)             \
     CPU_DEVICE_BINARY(name, func, bfloat16, float64, float64, float64)             \
     CPU_DEVICE_NOIMPL(name, func, bfloat16, complex32, complex64, complex64)       \
     CPU_DEVICE_BINARY(name, func, bfloat16, complex64, complex64, complex64)       \
     CPU_DEVICE_BINARY(name, func, bfloat16, complex128, complex128, complex128)    \
                                                                                    \
-    CPU_DEVICE_NOIMPL(name, hfunc, float16, uint8, float16, float16)               \
-    CPU_DEVICE_NOIMPL(name, func, float16, uint16, float32, float32)               \
-    CPU_DEVICE_NOIMPL(name, func, float16, uint32, float64, float64)               \
-    CPU_DEVICE_NOIMPL(name, hfunc, float16, int8, float16, float16)                \
-    CPU_DEVICE_NOIMPL(name, func, float16, int16, float32, float32)                \
-    CPU_DEVICE_NOIMPL(name, func, float16, int32, float64, float64)                \
-    CPU_DEVICE_NOIMPL(name, func, float16, bfloat16, float32, float32)             \
-    CPU_DEVICE_NOIMPL(name, hfunc, float16, float16, float16, float16)             \
-    CPU_DEVICE_NOIMPL(name, func, float16, float32, float32, float32)              \
-    CPU_DEVICE_NOIMPL(name, func, float16, float64, float64, float64)              \
+    CPU_DEVICE_BINARY(name, hfunc, float16, uint8, float16, float16)               \
+    CPU_DEVICE_BINARY(name, func, float16, uint16, float32, float32)               \
+    CPU_DEVICE_BINARY(name, func, float16, uint32, float64, float64)               \
+    CPU_DEVICE_BINARY(name, hfunc, float16, int8, float16, float16)                \
+    CPU_DEVICE_BINARY(name, func, float16, int16, float32, float32)                \
+    CPU_DEVICE_BINARY(name, func, float16, int32, float64, float64)                \
+    CPU_DEVICE_BINARY(name, func, float16, bfloat16, float32, float32)             \
+    CPU_DEVICE_BINARY_SAME(name, hfunc, float16, float16, float16, float16)        \
+    CPU_DEVICE_BINARY(name, func, float16, float32, float32, float32)              \
+    CPU_DEVICE_BINARY(name, func, float16, float64, float64, float64)              \
     CPU_DEVICE_NOIMPL(name, func, float16, complex32, complex32, complex32)        \
-    CPU_DEVICE_NOIMPL(name, func, float16, complex64, complex64, complex64)        \
-    CPU_DEVICE_NOIMPL(name, func, float16, complex128, complex128, complex128)     \
+    CPU_DEVICE_BINARY(name, func, float16, complex64, complex64, complex64)        \
+    CPU_DEVICE_BINARY(name, func, float16, complex128, complex128, complex128)     \
                                                                                    \
     CPU_DEVICE_BINARY(name, func, float32, uint8, float32, float32)                \
     CPU_DEVICE_BINARY(name, func, float32, uint16, float32, float32)               \
@@ -662,8 +868,8 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, float32, int16, float32, float32)                \
     CPU_DEVICE_BINARY(name, func, float32, int32, float64, float64)                \
     CPU_DEVICE_BINARY(name, func, float32, bfloat16, float32, float32)             \
-    CPU_DEVICE_NOIMPL(name, func, float32, float16, float32, float32)              \
-    CPU_DEVICE_BINARY(name, func, float32, float32, float32, float32)              \
+    CPU_DEVICE_BINARY(name, func, float32, float16, float32, float32)              \
+    CPU_DEVICE_BINARY_SAME(name, func, float32, float32, float32, float32)         \
     CPU_DEVICE_BINARY(name, func, float32, float64, float64, float64)              \
     CPU_DEVICE_NOIMPL(name, func, float32, complex32, complex64, complex64)        \
     CPU_DEVICE_BINARYC(name, func, float32, complex64, complex64, complex64)       \
@@ -676,9 +882,9 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARY(name, func, float64, int16, float64, float64)                \
     CPU_DEVICE_BINARY(name, func, float64, int32, float64, float64)                \
     CPU_DEVICE_BINARY(name, func, float64, bfloat16, float64, float64)             \
-    CPU_DEVICE_NOIMPL(name, func, float64, float16, float64, float64)              \
+    CPU_DEVICE_BINARY(name, func, float64, float16, float64, float64)              \
     CPU_DEVICE_BINARY(name, func, float64, float32, float64, float64)              \
-    CPU_DEVICE_BINARY(name, func, float64, float64, float64, float64)              \
+    CPU_DEVICE_BINARY_SAME(name, func, float64, float64, float64, float64)         \
     CPU_DEVICE_NOIMPL(name, func, float64, complex32, complex128, complex128)      \
     CPU_DEVICE_BINARYC(name, func, float64, complex64, complex128, complex128)     \
     CPU_DEVICE_BINARYC(name, func, float64, complex128, complex128, complex128)    \
@@ -704,7 +910,7 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARYC(name, func, complex64, int16, complex64, complex64)         \
     CPU_DEVICE_BINARYC(name, func, complex64, int32, complex128, complex128)       \
     CPU_DEVICE_BINARY(name, func, complex64, bfloat16, complex64, complex64)       \
-    CPU_DEVICE_NOIMPL(name, func, complex64, float16, complex64, complex64)        \
+    CPU_DEVICE_BINARY(name, func, complex64, float16, complex64, complex64)        \
     CPU_DEVICE_BINARYC(name, func, complex64, float32, complex64, complex64)       \
     CPU_DEVICE_BINARYC(name, func, complex64, float64, complex128, complex128)     \
     CPU_DEVICE_NOIMPL(name, func, complex64, complex32, complex64, complex64)      \
@@ -718,31 +924,51 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                               \
     CPU_DEVICE_BINARYC(name, func, complex128, int16, complex128, complex128)      \
     CPU_DEVICE_BINARYC(name, func, complex128, int32, complex128, complex128)      \
     CPU_DEVICE_BINARY(name, func, complex128, bfloat16, complex128, complex128)    \
-    CPU_DEVICE_NOIMPL(name, func, complex128, float16, complex128, complex128)     \
+    CPU_DEVICE_BINARY(name, func, complex128, float16, complex128, complex128)     \
     CPU_DEVICE_BINARYC(name, func, complex128, float32, complex128, complex128)    \
     CPU_DEVICE_BINARYC(name, func, complex128, float64, complex128, complex128)    \
     CPU_DEVICE_NOIMPL(name, func, complex128, complex32, complex128, complex128)   \
     CPU_DEVICE_BINARYC(name, func, complex128, complex64, complex128, complex128)  \
     CPU_DEVICE_BINARYC(name, func, complex128, complex128, complex128, complex128)
 
+#undef CPU_DEVICE_BINARY_1D_C
+#undef CPU_DEVICE_BINARY_1D_C_SAME
+#define CPU_DEVICE_BINARY_1D_C CPU_DEVICE_BINARY_1D_C_BASE
+#define CPU_DEVICE_BINARY_1D_C_SAME CPU_DEVICE_BINARY_1D_C_ISA
+
 #define add(x, y) x + y
 CPU_DEVICE_ALL_BINARY(add, add, add)
 
 #define subtract(x, y) x - y
-CPU_DEVICE_ALL_BINARY(subtract, subtract, sub)
+CPU_DEVICE_ALL_BINARY(subtract, subtract, subtract)
 
 #define multiply(x, y) x * y
 CPU_DEVICE_ALL_BINARY(multiply, multiply, multiply)
 
+#undef CPU_DEVICE_BINARY_1D_C
+#undef CPU_DEVICE_BINARY_1D_C_SAME
+#define CPU_DEVICE_BINARY_1D_C CPU_DEVICE_BINARY_1D_C_SCALAR
+#define CPU_DEVICE_BINARY_1D_C_SAME CPU_DEVICE_BINARY_1D_C_SCALAR
+
 #define floor_divide(x, y) x / y
 CPU_DEVICE_ALL_BINARY_NO_COMPLEX(floor_divide, _floor_divide, _floor_divide)
 
 #define remainder(x, y) x % y
 CPU_DEVICE_ALL_BINARY_NO_COMPLEX(remainder, _remainder, _remainder)
 
+#undef CPU_DEVICE_BINARY_1D_C
+#undef CPU_DEVICE_BINARY_1D_C_SAME
+#define CPU_DEVICE_BINARY_1D_C CPU_DEVICE_BINARY_1D_C_BASE
+#define CPU_DEVICE_BINARY_1D_C_SAME CPU_DEVICE_BINARY_1D_C_ISA
+
 #define divide(x, y) x / y
 CPU_DEVICE_ALL_BINARY_FLOAT_RETURN(divide, divide, divide)
 
+#undef CPU_DEVICE_BINARY_1D_C
+#undef CPU_DEVICE_BINARY_1D_C_SAME
+#define CPU_DEVICE_BINARY_1D_C CPU_DEVICE_BINARY_1D_C_SCALAR
+#define CPU_DEVICE_BINARY_1D_C_SAME CPU_DEVICE_BINARY_1D_C_SCALAR
+
 CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
 
 
@@ -751,7 +977,7 @@ CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
 /*****************************************************************************/
 
 #define CPU_DEVICE_ALL_COMPARISON(name, func, hfunc, cfunc) \
-    CPU_DEVICE_BINARY(name, func, uint8, uint8, bool, uint8)                  \
+    CPU_DEVICE_BINARY_SAME(name, func, uint8, uint8, bool, uint8)             \
     CPU_DEVICE_BINARY(name, func, uint8, uint16, bool, uint16)                \
     CPU_DEVICE_BINARY(name, func, uint8, uint32, bool, uint32)                \
     CPU_DEVICE_BINARY(name, func, uint8, uint64, bool, uint64)                \
@@ -760,7 +986,7 @@ CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
     CPU_DEVICE_BINARY(name, func, uint8, int32, bool, int32)                  \
     CPU_DEVICE_BINARY(name, func, uint8, int64, bool, int64)                  \
     CPU_DEVICE_BINARY(name, func, uint8, bfloat16, bool, bfloat16)            \
-    CPU_DEVICE_NOIMPL(name, func, uint8, float16, bool, float16)              \
+    CPU_DEVICE_BINARY(name, func, uint8, float16, bool, float16)              \
     CPU_DEVICE_BINARY(name, func, uint8, float32, bool, float32)              \
     CPU_DEVICE_BINARY(name, func, uint8, float64, bool, float64)              \
     CPU_DEVICE_NOIMPL(name, cfunc, uint8, complex32, bool, complex32)         \
@@ -768,7 +994,7 @@ CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
     CPU_DEVICE_BINARYC(name, cfunc, uint8, complex128, bool, complex128)      \
                                                                               \
     CPU_DEVICE_BINARY(name, func, uint16, uint8, bool, uint16)                \
-    CPU_DEVICE_BINARY(name, func, uint16, uint16, bool, uint16)               \
+    CPU_DEVICE_BINARY_SAME(name, func, uint16, uint16, bool, uint16)          \
     CPU_DEVICE_BINARY(name, func, uint16, uint32, bool, uint32)               \
     CPU_DEVICE_BINARY(name, func, uint16, uint64, bool, uint64)               \
     CPU_DEVICE_BINARY(name, func, uint16, int8, bool, int32)                  \
@@ -776,7 +1002,7 @@ CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
     CPU_DEVICE_BINARY(name, func, uint16, int32, bool, int32)                 \
     CPU_DEVICE_BINARY(name, func, uint16, int64, bool, int64)                 \
     CPU_DEVICE_BINARY(name, func, uint16, bfloat16, bool, float32)            \
-    CPU_DEVICE_NOIMPL(name, func, uint16, float16, bool, float32)             \
+    CPU_DEVICE_BINARY(name, func, uint16, float16, bool, float32)             \
     CPU_DEVICE_BINARY(name, func, uint16, float32, bool, float32)             \
     CPU_DEVICE_BINARY(name, func, uint16, float64, bool, float64)             \
     CPU_DEVICE_NOIMPL(name, cfunc, uint16, complex32, bool, complex64)        \
@@ -785,14 +1011,14 @@ CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
                                                                               \
     CPU_DEVICE_BINARY(name, func, uint32, uint8, bool, uint32)                \
     CPU_DEVICE_BINARY(name, func, uint32, uint16, bool, uint32)               \
-    CPU_DEVICE_BINARY(name, func, uint32, uint32, bool, uint32)               \
+    CPU_DEVICE_BINARY_SAME(name, func, uint32, uint32, bool, uint32)          \
     CPU_DEVICE_BINARY(name, func, uint32, uint64, bool, uint64)               \
     CPU_DEVICE_BINARY(name, func, uint32, int8, bool, int64)                  \
     CPU_DEVICE_BINARY(name, func, uint32, int16, bool, int64)                 \
     CPU_DEVICE_BINARY(name, func, uint32, int32, bool, int64)                 \
     CPU_DEVICE_BINARY(name, func, uint32, int64, bool, int64)                 \
     CPU_DEVICE_BINARY(name, func, uint32, bfloat16, bool, float64)            \
-    CPU_DEVICE_NOIMPL(name, func, uint32, float16, bool, float64)             \
+    CPU_DEVICE_BINARY(name, func, uint32, float16, bool, float64)             \
     CPU_DEVICE_BINARY(name, func, uint32, float32, bool, float64)             \
     CPU_DEVICE_BINARY(name, func, uint32, float64, bool, float64)             \
     CPU_DEVICE_NOIMPL(name, cfunc, uint32, complex32, bool, complex128)       \
@@ -802,17 +1028,17 @@ CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
     CPU_DEVICE_BINARY(name, func, uint64, uint8, bool, uint64)                \
     CPU_DEVICE_BINARY(name, func, uint64, uint16, bool, uint64)               \
     CPU_DEVICE_BINARY(name, func, uint64, uint32, bool, uint64)               \
-    CPU_DEVICE_BINARY(name, func, uint64, uint64, bool, uint64)               \
+    CPU_DEVICE_BINARY_SAME(name, func, uint64, uint64, bool, uint64)          \
                                                                               \
     CPU_DEVICE_BINARY(name, func, int8, uint8, bool, int16)                   \
     CPU_DEVICE_BINARY(name, func, int8, uint16, bool, int32)                  \
     CPU_DEVICE_BINARY(name, func, int8, uint32, bool, int64)                  \
-    CPU_DEVICE_BINARY(name, func, int8, int8, bool, int8)                     \
+    CPU_DEVICE_BINARY_SAME(name, func, int8, int8, bool, int8)                \
     CPU_DEVICE_BINARY(name, func, int8, int16, bool, int16)                   \
     CPU_DEVICE_BINARY(name, func, int8, int32, bool, int32)                   \
     CPU_DEVICE_BINARY(name, func, int8, int64, bool, int64)                   \
     CPU_DEVICE_BINARY(name, func, int8, bfloat16, bool, bfloat16)             \
-    CPU_DEVICE_NOIMPL(name, func, int8, float16, bool, float16)               \
+    CPU_DEVICE_BINARY(name, func, int8, float16, bool, float16)               \
     CPU_DEVICE_BINARY(name, func, int8, float32, bool, float32)               \
     CPU_DEVICE_BINARY(name, func, int8, float64, bool, float64)               \
     CPU_DEVICE_NOIMPL(name, cfunc, int8, complex32, bool, complex32)          \
@@ -823,11 +1049,11 @@ CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
     CPU_DEVICE_BINARY(name, func, int16, uint16, bool, int32)                 \
     CPU_DEVICE_BINARY(name, func, int16, uint32, bool, int64)                 \
     CPU_DEVICE_BINARY(name, func, int16, int8, bool, int16)                   \
-    CPU_DEVICE_BINARY(name, func, int16, int16, bool, int16)                  \
+    CPU_DEVICE_BINARY_SAME(name, func, int16, int16, bool, int16)             \
     CPU_DEVICE_BINARY(name, func, int16, int32, bool, int32)                  \
     CPU_DEVICE_BINARY(name, func, int16, int64, bool, int64)                  \
     CPU_DEVICE_BINARY(name, func, int16, bfloat16, bool, float32)             \
-    CPU_DEVICE_NOIMPL(name, func, int16, float16, bool, float32)              \
+    CPU_DEVICE_BINARY(name, func, int16, float16, bool, float32)              \
     CPU_DEVICE_BINARY(name, func, int16, float32, bool, float32)              \
     CPU_DEVICE_BINARY(name, func, int16, float64, bool, float64)              \
     CPU_DEVICE_NOIMPL(name, cfunc, int16, complex32, bool, complex64)         \
@@ -839,10 +1065,10 @@ CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
     CPU_DEVICE_BINARY(name, func, int32, uint32, bool, int64)                 \
     CPU_DEVICE_BINARY(name, func, int32, int8, bool, int32)                   \
     CPU_DEVICE_BINARY(name, func, int32, int16, bool, int32)                  \
-    CPU_DEVICE_BINARY(name, func, int32, int32, bool, int32)                  \
+    CPU_DEVICE_BINARY_SAME(name, func, int32, int32, bool, int32)             \
     CPU_DEVICE_BINARY(name, func, int32, int64, bool, int64)                  \
     CPU_DEVICE_BINARY(name, func, int32, bfloat16, bool, float64)             \
-    CPU_DEVICE_NOIMPL(name, func, int32, float16, bool, float64)              \
+    CPU_DEVICE_BINARY(name, func, int32, float16, bool, float64)              \
     CPU_DEVICE_BINARY(name, func, int32, float32, bool, float64)              \
     CPU_DEVICE_BINARY(name, func, int32, float64, bool, float64)              \
     CPU_DEVICE_NOIMPL(name, cfunc, int32, complex32, bool, complex128)        \
@@ -855,7 +1081,7 @@ CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
     CPU_DEVICE_BINARY(name, func, int64, int8, bool, int64)                   \
     CPU_DEVICE_BINARY(name, func, int64, int16, bool, int64)                  \
     CPU_DEVICE_BINARY(name, func, int64, int32, bool, int64)                  \
-    CPU_DEVICE_BINARY(name, func, int64, int64, bool, int64)                  \
+    CPU_DEVICE_BINARY_SAME(name, func, int64, int64, bool, int64)             \
                                                                               \
     CPU_DEVICE_BINARY(name, func, bfloat16, uint8, bool, bfloat16)            \
     CPU_DEVICE_BINARY(name, func, bfloat16, uint16, bool, float32)            \
@@ -863,27 +1089,27 @@ CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
     CPU_DEVICE_BINARY(name, func, bfloat16, int8, bool, bfloat16)             \
     CPU_DEVICE_BINARY(name, func, bfloat16, int16, bool, float32)             \
     CPU_DEVICE_BINARY(name, func, bfloat16, int32, bool, float64)             \
-    CPU_DEVICE_BINARY(name, func, bfloat16, bfloat16, bool, bfloat16)         \
-    CPU_DEVICE_NOIMPL(name, func, bfloat16, float16, bool, float32)           \
+    CPU_DEVICE_BINARY_SAME(name, func, bfloat16, bfloat16, bool, bfloat16)    \
+    CPU_DEVICE_BINARY(name, func, bfloat16, float16, bool, float32)           \
     CPU_DEVICE_BINARY(name, func, bfloat16, float32, bool, float32)           \
     CPU_DEVICE_BINARY(name, func, bfloat16, float64, bool, float64)           \
     CPU_DEVICE_NOIMPL(name, cfunc, bfloat16, complex32, bool, complex64)      \
     CPU_DEVICE_BINARY(name, cfunc, bfloat16, complex64, bool, complex64)      \
     CPU_DEVICE_BINARY(name, cfunc, bfloat16, complex128, bool, complex128)    \
                                                                               \
-    CPU_DEVICE_NOIMPL(name, func, float16, uint8, bool, float16)              \
-    CPU_DEVICE_NOIMPL(name, func, float16, uint16, bool, float32)             \
-    CPU_DEVICE_NOIMPL(name, func, float16, uint32, bool, float64)             \
-    CPU_DEVICE_NOIMPL(name, func, float16, int8, bool, float16)               \
-    CPU_DEVICE_NOIMPL(name, func, float16, int16, bool, float32)              \
-    CPU_DEVICE_NOIMPL(name, func, float16, int32, bool, float64)              \
-    CPU_DEVICE_NOIMPL(name, func, float16, bfloat16, bool, float32)           \
-    CPU_DEVICE_NOIMPL(name, func, float16, float16, bool, float16)            \
-    CPU_DEVICE_NOIMPL(name, func, float16, float32, bool, float32)            \
-    CPU_DEVICE_NOIMPL(name, func, float16, float64, bool, float64)            \
+    CPU_DEVICE_BINARY(name, func, float16, uint8, bool, float16)              \
+    CPU_DEVICE_BINARY(name, func, float16, uint16, bool, float32)             \
+    CPU_DEVICE_BINARY(name, func, float16, uint32, bool, float64)             \
+    CPU_DEVICE_BINARY(name, func, float16, int8, bool, float16)               \
+    CPU_DEVICE_BINARY(name, func, float16, int16, bool, float32)              \
+    CPU_DEVICE_BINARY(name, func, float16, int32, bool, float64)              \
+    CPU_DEVICE_BINARY(name, func, float16, bfloat16, bool, float32)           \
+    CPU_DEVICE_BINARY_SAME(name, func, float16, float16, bool, float16)       \
+    CPU_DEVICE_BINARY(name, func, float16, float32, bool, float32)            \
+    CPU_DEVICE_BINARY(name, func, float16, float64, bool, float64)            \
     CPU_DEVICE_NOIMPL(name, cfunc, float16, complex32, bool, complex32)       \
-    CPU_DEVICE_NOIMPL(name, cfunc, float16, complex64, bool, complex64)       \
-    CPU_DEVICE_NOIMPL(name, cfunc, float16, complex128, bool, complex128)     \
+    CPU_DEVICE_BINARY(name, cfunc, float16, complex64, bool, complex64)       \
+    CPU_DEVICE_BINARY(name, cfunc, float16, complex128, bool, complex128)     \
                                                                               \
     CPU_DEVICE_BINARY(name, func, float32, uint8, bool, float32)              \
     CPU_DEVICE_BINARY(name, func, float32, uint16, bool, float32)             \
@@ -892,8 +1118,8 @@ CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
     CPU_DEVICE_BINARY(name, func, float32, int16, bool, float32)              \
     CPU_DEVICE_BINARY(name, func, float32, int32, bool, float64)              \
     CPU_DEVICE_BINARY(name, func, float32, bfloat16, bool, float32)           \
-    CPU_DEVICE_NOIMPL(name, func, float32, float16, bool, float32)            \
-    CPU_DEVICE_BINARY(name, func, float32, float32, bool, float32)            \
+    CPU_DEVICE_BINARY(name, func, float32, float16, bool, float32)            \
+    CPU_DEVICE_BINARY_SAME(name, func, float32, float32, bool, float32)       \
     CPU_DEVICE_BINARY(name, func, float32, float64, bool, float64)            \
     CPU_DEVICE_NOIMPL(name, cfunc, float32, complex32, bool, complex64)       \
     CPU_DEVICE_BINARYC(name, cfunc, float32, complex64, bool, complex64)      \
@@ -906,9 +1132,9 @@ CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
     CPU_DEVICE_BINARY(name, func, float64, int16, bool, float64)              \
     CPU_DEVICE_BINARY(name, func, float64, int32, bool, float64)              \
     CPU_DEVICE_BINARY(name, func, float64, bfloat16, bool, float64)           \
-    CPU_DEVICE_NOIMPL(name, func, float64, float16, bool, float64)            \
+    CPU_DEVICE_BINARY(name, func, float64, float16, bool, float64)            \
     CPU_DEVICE_BINARY(name, func, float64, float32, bool, float64)            \
-    CPU_DEVICE_BINARY(name, func, float64, float64, bool, float64)            \
+    CPU_DEVICE_BINARY_SAME(name, func, float64, float64, bool, float64)       \
     CPU_DEVICE_NOIMPL(name, cfunc, float64, complex32, bool, complex128)      \
     CPU_DEVICE_BINARYC(name, cfunc, float64, complex64, bool, complex128)     \
     CPU_DEVICE_BINARYC(name, cfunc, float64, complex128, bool, complex128)    \
@@ -934,7 +1160,7 @@ CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
     CPU_DEVICE_BINARYC(name, cfunc, complex64, int16, bool, complex64)        \
     CPU_DEVICE_BINARYC(name, cfunc, complex64, int32, bool, complex128)       \
     CPU_DEVICE_BINARY(name, cfunc, complex64, bfloat16, bool, complex64)      \
-    CPU_DEVICE_NOIMPL(name, cfunc, complex64, float16, bool, complex64)       \
+    CPU_DEVICE_BINARY(name, cfunc, complex64, float16, bool, complex64)       \
     CPU_DEVICE_BINARYC(name, cfunc, complex64, float32, bool, complex64)      \
     CPU_DEVICE_BINARYC(name, cfunc, complex64, float64, bool, complex128)     \
     CPU_DEVICE_NOIMPL(name, cfunc, complex64, complex32, bool, complex64)     \
@@ -948,7 +1174,7 @@ CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
     CPU_DEVICE_BINARYC(name, cfunc, complex128, int16, bool, complex128)      \
     CPU_DEVICE_BINARYC(name, cfunc, complex128, int32, bool, complex128)      \
     CPU_DEVICE_BINARY(name, cfunc, complex128, bfloat16, bool, complex128)    \
-    CPU_DEVICE_NOIMPL(name, cfunc, complex128, float16, bool, complex128)     \
+    CPU_DEVICE_BINARY(name, cfunc, complex128, float16, bool, complex128)     \
     CPU_DEVICE_BINARYC(name, cfunc, complex128, float32, bool, complex128)    \
     CPU_DEVICE_BINARYC(name, cfunc, complex128, float64, bool, complex128)    \
     CPU_DEVICE_NOIMPL(name, cfunc, complex128, complex32, bool, complex128)   \
@@ -956,6 +1182,11 @@ CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
     CPU_DEVICE_BINARYC(name, cfunc, complex128, complex128, bool, complex128) \
 
 
+#undef CPU_DEVICE_BINARY_1D_C
+#undef CPU_DEVICE_BINARY_1D_C_SAME
+#define CPU_DEVICE_BINARY_1D_C CPU_DEVICE_BINARY_1D_C_BASE
+#define CPU_DEVICE_BINARY_1D_C_SAME CPU_DEVICE_BINARY_1D_C_ISA
+
 #define less(x, y) x < y
 CPU_DEVICE_ALL_COMPARISON(less, less, less, lexorder_lt)
 
@@ -983,87 +1214,87 @@ CPU_DEVICE_ALL_COMPARISON(equaln, equaln, equaln, lexorder_eqn)
 /*****************************************************************************/
 
 #define CPU_DEVICE_ALL_BITWISE(name, func) \
-    CPU_DEVICE_BINARY(name, func, bool, bool, bool, bool)  \
-    CPU_DEVICE_BINARY(name, func, bool, uint8, uint8, uint8)      \
-    CPU_DEVICE_BINARY(name, func, bool, uint16, uint16, uint16)   \
-    CPU_DEVICE_BINARY(name, func, bool, uint32, uint32, uint32)   \
-    CPU_DEVICE_BINARY(name, func, bool, uint64, uint64, uint64)   \
-    CPU_DEVICE_BINARY(name, func, bool, int8, int8, int8)         \
-    CPU_DEVICE_BINARY(name, func, bool, int16, int16, int16)      \
-    CPU_DEVICE_BINARY(name, func, bool, int32, int32, int32)      \
-    CPU_DEVICE_BINARY(name, func, bool, int64, int64, int64)      \
-                                                                  \
-    CPU_DEVICE_BINARY(name, func, uint8, bool, uint8, uint8)      \
-    CPU_DEVICE_BINARY(name, func, uint8, uint8, uint8, uint8)     \
-    CPU_DEVICE_BINARY(name, func, uint8, uint16, uint16, uint16)  \
-    CPU_DEVICE_BINARY(name, func, uint8, uint32, uint32, uint32)  \
-    CPU_DEVICE_BINARY(name, func, uint8, uint64, uint64, uint64)  \
-    CPU_DEVICE_BINARY(name, func, uint8, int8, int16, int16)      \
-    CPU_DEVICE_BINARY(name, func, uint8, int16, int16, int16)     \
-    CPU_DEVICE_BINARY(name, func, uint8, int32, int32, int32)     \
-    CPU_DEVICE_BINARY(name, func, uint8, int64, int64, int64)     \
-                                                                  \
-    CPU_DEVICE_BINARY(name, func, uint16, bool, uint16, uint16)   \
-    CPU_DEVICE_BINARY(name, func, uint16, uint8, uint16, uint16)  \
-    CPU_DEVICE_BINARY(name, func, uint16, uint16, uint16, uint16) \
-    CPU_DEVICE_BINARY(name, func, uint16, uint32, uint32, uint32) \
-    CPU_DEVICE_BINARY(name, func, uint16, uint64, uint64, uint64) \
-    CPU_DEVICE_BINARY(name, func, uint16, int8, int32, int32)     \
-    CPU_DEVICE_BINARY(name, func, uint16, int16, int32, int32)    \
-    CPU_DEVICE_BINARY(name, func, uint16, int32, int32, int32)    \
-    CPU_DEVICE_BINARY(name, func, uint16, int64, int64, int64)    \
-                                                                  \
-    CPU_DEVICE_BINARY(name, func, uint32, bool, uint32, uint32)   \
-    CPU_DEVICE_BINARY(name, func, uint32, uint8, uint32, uint32)  \
-    CPU_DEVICE_BINARY(name, func, uint32, uint16, uint32, uint32) \
-    CPU_DEVICE_BINARY(name, func, uint32, uint32, uint32, uint32) \
-    CPU_DEVICE_BINARY(name, func, uint32, uint64, uint64, uint64) \
-    CPU_DEVICE_BINARY(name, func, uint32, int8, int64, int64)     \
-    CPU_DEVICE_BINARY(name, func, uint32, int16, int64, int64)    \
-    CPU_DEVICE_BINARY(name, func, uint32, int32, int64, int64)    \
-    CPU_DEVICE_BINARY(name, func, uint32, int64, int64, int64)    \
-                                                                  \
-    CPU_DEVICE_BINARY(name, func, uint64, bool, uint64, uint64)   \
-    CPU_DEVICE_BINARY(name, func, uint64, uint8, uint64, uint64)  \
-    CPU_DEVICE_BINARY(name, func, uint64, uint16, uint64, uint64) \
-    CPU_DEVICE_BINARY(name, func, uint64, uint32, uint64, uint64) \
-    CPU_DEVICE_BINARY(name, func, uint64, uint64, uint64, uint64) \
-                                                                  \
-    CPU_DEVICE_BINARY(name, func, int8, bool, int8, int8)         \
-    CPU_DEVICE_BINARY(name, func, int8, uint8, int16, int16)      \
-    CPU_DEVICE_BINARY(name, func, int8, uint16, int32, int32)     \
-    CPU_DEVICE_BINARY(name, func, int8, uint32, int64, int64)     \
-    CPU_DEVICE_BINARY(name, func, int8, int8, int8, int8)         \
-    CPU_DEVICE_BINARY(name, func, int8, int16, int16, int16)      \
-    CPU_DEVICE_BINARY(name, func, int8, int32, int32, int32)      \
-    CPU_DEVICE_BINARY(name, func, int8, int64, int64, int64)      \
-                                                                  \
-    CPU_DEVICE_BINARY(name, func, int16, bool, int16, int16)      \
-    CPU_DEVICE_BINARY(name, func, int16, uint8, int16, int16)     \
-    CPU_DEVICE_BINARY(name, func, int16, uint16, int32, int32)    \
-    CPU_DEVICE_BINARY(name, func, int16, uint32, int64, int64)    \
-    CPU_DEVICE_BINARY(name, func, int16, int8, int16, int16)      \
-    CPU_DEVICE_BINARY(name, func, int16, int16, int16, int16)     \
-    CPU_DEVICE_BINARY(name, func, int16, int32, int32, int32)     \
-    CPU_DEVICE_BINARY(name, func, int16, int64, int64, int64)     \
-                                                                  \
-    CPU_DEVICE_BINARY(name, func, int32, bool, int32, int32)      \
-    CPU_DEVICE_BINARY(name, func, int32, uint8, int32, int32)     \
-    CPU_DEVICE_BINARY(name, func, int32, uint16, int32, int32)    \
-    CPU_DEVICE_BINARY(name, func, int32, uint32, int64, int64)    \
-    CPU_DEVICE_BINARY(name, func, int32, int8, int32, int32)      \
-    CPU_DEVICE_BINARY(name, func, int32, int16, int32, int32)     \
-    CPU_DEVICE_BINARY(name, func, int32, int32, int32, int32)     \
-    CPU_DEVICE_BINARY(name, func, int32, int64, int64, int64)     \
-                                                                  \
-    CPU_DEVICE_BINARY(name, func, int64, bool, int64, int64)      \
-    CPU_DEVICE_BINARY(name, func, int64, uint8, int64, int64)     \
-    CPU_DEVICE_BINARY(name, func, int64, uint16, int64, int64)    \
-    CPU_DEVICE_BINARY(name, func, int64, uint32, int64, int64)    \
-    CPU_DEVICE_BINARY(name, func, int64, int8, int64, int64)      \
-    CPU_DEVICE_BINARY(name, func, int64, int16, int64, int64)     \
-    CPU_DEVICE_BINARY(name, func, int64, int32, int64, int64)     \
-    CPU_DEVICE_BINARY(name, func, int64, int64, int64, int64)
+    CPU_DEVICE_BINARY_SAME(name, func, bool, bool, bool, bool)         \
+    CPU_DEVICE_BINARY(name, func, bool, uint8, uint8, uint8)           \
+    CPU_DEVICE_BINARY(name, func, bool, uint16, uint16, uint16)        \
+    CPU_DEVICE_BINARY(name, func, bool, uint32, uint32, uint32)        \
+    CPU_DEVICE_BINARY(name, func, bool, uint64, uint64, uint64)        \
+    CPU_DEVICE_BINARY(name, func, bool, int8, int8, int8)              \
+    CPU_DEVICE_BINARY(name, func, bool, int16, int16, int16)           \
+    CPU_DEVICE_BINARY(name, func, bool, int32, int32, int32)           \
+    CPU_DEVICE_BINARY(name, func, bool, int64, int64, int64)           \
+                                                                       \
+    CPU_DEVICE_BINARY(name, func, uint8, bool, uint8, uint8)           \
+    CPU_DEVICE_BINARY_SAME(name, func, uint8, uint8, uint8, uint8)     \
+    CPU_DEVICE_BINARY(name, func, uint8, uint16, uint16, uint16)       \
+    CPU_DEVICE_BINARY(name, func, uint8, uint32, uint32, uint32)       \
+    CPU_DEVICE_BINARY(name, func, uint8, uint64, uint64, uint64)       \
+    CPU_DEVICE_BINARY(name, func, uint8, int8, int16, int16)           \
+    CPU_DEVICE_BINARY(name, func, uint8, int16, int16, int16)          \
+    CPU_DEVICE_BINARY(name, func, uint8, int32, int32, int32)          \
+    CPU_DEVICE_BINARY(name, func, uint8, int64, int64, int64)          \
+                                                                       \
+    CPU_DEVICE_BINARY(name, func, uint16, bool, uint16, uint16)        \
+    CPU_DEVICE_BINARY(name, func, uint16, uint8, uint16, uint16)       \
+    CPU_DEVICE_BINARY_SAME(name, func, uint16, uint16, uint16, uint16) \
+    CPU_DEVICE_BINARY(name, func, uint16, uint32, uint32, uint32)      \
+    CPU_DEVICE_BINARY(name, func, uint16, uint64, uint64, uint64)      \
+    CPU_DEVICE_BINARY(name, func, uint16, int8, int32, int32)          \
+    CPU_DEVICE_BINARY(name, func, uint16, int16, int32, int32)         \
+    CPU_DEVICE_BINARY(name, func, uint16, int32, int32, int32)         \
+    CPU_DEVICE_BINARY(name, func, uint16, int64, int64, int64)         \
+                                                                       \
+    CPU_DEVICE_BINARY(name, func, uint32, bool, uint32, uint32)        \
+    CPU_DEVICE_BINARY(name, func, uint32, uint8, uint32, uint32)       \
+    CPU_DEVICE_BINARY(name, func, uint32, uint16, uint32, uint32)      \
+    CPU_DEVICE_BINARY_SAME(name, func, uint32, uint32, uint32, uint32) \
+    CPU_DEVICE_BINARY(name, func, uint32, uint64, uint64, uint64)      \
+    CPU_DEVICE_BINARY(name, func, uint32, int8, int64, int64)          \
+    CPU_DEVICE_BINARY(name, func, uint32, int16, int64, int64)         \
+    CPU_DEVICE_BINARY(name, func, uint32, int32, int64, int64)         \
+    CPU_DEVICE_BINARY(name, func, uint32, int64, int64, int64)         \
+                                                                       \
+    CPU_DEVICE_BINARY(name, func, uint64, bool, uint64, uint64)        \
+    CPU_DEVICE_BINARY(name, func, uint64, uint8, uint64, uint64)       \
+    CPU_DEVICE_BINARY(name, func, uint64, uint16, uint64, uint64)      \
+    CPU_DEVICE_BINARY(name, func, uint64, uint32, uint64, uint64)      \
+    CPU_DEVICE_BINARY_SAME(name, func, uint64, uint64, uint64, uint64) \
+                                                                       \
+    CPU_DEVICE_BINARY(name, func, int8, bool, int8, int8)              \
+    CPU_DEVICE_BINARY(name, func, int8, uint8, int16, int16)           \
+    CPU_DEVICE_BINARY(name, func, int8, uint16, int32, int32)          \
+    CPU_DEVICE_BINARY(name, func, int8, uint32, int64, int64)          \
+    CPU_DEVICE_BINARY_SAME(name, func, int8, int8, int8, int8)         \
+    CPU_DEVICE_BINARY(name, func, int8, int16, int16, int16)           \
+    CPU_DEVICE_BINARY(name, func, int8, int32, int32, int32)           \
+    CPU_DEVICE_BINARY(name, func, int8, int64, int64, int64)           \
+                                                                       \
+    CPU_DEVICE_BINARY(name, func, int16, bool, int16, int16)           \
+    CPU_DEVICE_BINARY(name, func, int16, uint8, int16, int16)          \
+    CPU_DEVICE_BINARY(name, func, int16, uint16, int32, int32)         \
+    CPU_DEVICE_BINARY(name, func, int16, uint32, int64, int64)         \
+    CPU_DEVICE_BINARY(name, func, int16, int8, int16, int16)           \
+    CPU_DEVICE_BINARY_SAME(name, func, int16, int16, int16, int16)     \
+    CPU_DEVICE_BINARY(name, func, int16, int32, int32, int32)          \
+    CPU_DEVICE_BINARY(name, func, int16, int64, int64, int64)          \
+                                                                       \
+    CPU_DEVICE_BINARY(name, func, int32, bool, int32, int32)           \
+    CPU_DEVICE_BINARY(name, func, int32, uint8, int32, int32)          \
+    CPU_DEVICE_BINARY(name, func, int32, uint16, int32, int32)         \
+    CPU_DEVICE_BINARY(name, func, int32, uint32, int64, int64)         \
+    CPU_DEVICE_BINARY(name, func, int32, int8, int32, int32)           \
+    CPU_DEVICE_BINARY(name, func, int32, int16, int32, int32)          \
+    CPU_DEVICE_BINARY_SAME(name, func, int32, int32, int32, int32)     \
+    CPU_DEVICE_BINARY(name, func, int32, int64, int64, int64)          \
+                                                                       \
+    CPU_DEVICE_BINARY(name, func, int64, bool, int64, int64)           \
+    CPU_DEVICE_BINARY(name, func, int64, uint8, int64, int64)          \
+    CPU_DEVICE_BINARY(name, func, int64, uint16, int64, int64)         \
+    CPU_DEVICE_BINARY(name, func, int64, uint32, int64, int64)         \
+    CPU_DEVICE_BINARY(name, func, int64, int8, int64, int64)           \
+    CPU_DEVICE_BINARY(name, func, int64, int16, int64, int64)          \
+    CPU_DEVICE_BINARY(name, func, int64, int32, int64, int64)          \
+    CPU_DEVICE_BINARY_SAME(name, func, int64, int64, int64, int64)
 
 #define bitwise_and(x, y) x & y
 CPU_DEVICE_ALL_BITWISE(bitwise_and, bitwise_and)
@@ -1074,6 +1305,11 @@ CPU_DEVICE_ALL_BITWISE(bitwise_or, bitwise_or)
 #define bitwise_xor(x, y) x ^ y
 CPU_DEVICE_ALL_BITWISE(bitwise_xor, bitwise_xor)
 
+#undef CPU_DEVICE_BINARY_1D_C
+#undef CPU_DEVICE_BINARY_1D_C_SAME
+#define CPU_DEVICE_BINARY_1D_C CPU_DEVICE_BINARY_1D_C_SCALAR
+#define CPU_DEVICE_BINARY_1D_C_SAME CPU_DEVICE_BINARY_1D_C_SCALAR
+
 
 /*****************************************************************************/
 /*                              Two return values                            */
@@ -1117,6 +1353,7 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2##_##t3(               \
     CPU_DEVICE_BINARY_MV(name, func, int32, int32, int32, int32)              \
     CPU_DEVICE_BINARY_MV(name, func, int64, int64, int64, int64)              \
     CPU_DEVICE_BINARY_MV(name, func, bfloat16, bfloat16, bfloat16, bfloat16)  \
+    CPU_DEVICE_BINARY_MV(name, func, float16, float16, float16, float16)      \
     CPU_DEVICE_BINARY_MV(name, func, float32, float32, float32, float32)      \
     CPU_DEVICE_BINARY_MV(name, func, float64, float64, float64, float64)
 
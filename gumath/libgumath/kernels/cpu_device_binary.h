@@ -39,8 +39,10 @@
 #include <cinttypes>
 #include <complex>
 #include "contrib/bfloat16.h"
+#include "float16.h"
  
 typedef tf::bfloat16 bfloat16_t;
+typedef gm::float16 float16_t;
 typedef std::complex<float> complex64_t;
 typedef std::complex<double> complex128_t;
 #else
@@ -66,6 +68,10 @@ typedef double float64_t;
                  const char *a0, const char *a1, char *a2,              \
                  const int64_t s0, const int64_t s1, const int64_t s2,  \
                  const int64_t N);                                      \
+  extern "C" void gm_cpu_device_fixed_1D_Z_##name##_##t0##_##t1##_##t2( \
+                 const char *a0, const char *a1, char *a2,              \
+                 const int64_t s0, const int64_t s1,                    \
+                 const int64_t N);                                      \
   extern "C" void gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(         \
                  const char *a0, const char *a1, char *a2);
 
@@ -84,6 +90,10 @@ typedef double float64_t;
       const char *a0, const char *a1, char *a2,              \
       const int64_t s0, const int64_t s1, const int64_t s2,  \
       const int64_t N);                                      \
+  void gm_cpu_device_fixed_1D_Z_##name##_##t0##_##t1##_##t2( \
+      const char *a0, const char *a1, char *a2,              \
+      const int64_t s0, const int64_t s1,                    \
+      const int64_t N);                                      \
   void gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(         \
       const char *a0, const char *a1, char *a2);
 
@@ -113,7 +123,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, uint8, int32, int32)                \
     CPU_DEVICE_BINARY_DECL(name, uint8, int64, int64)                \
     CPU_DEVICE_BINARY_DECL(name, uint8, bfloat16, bfloat16)          \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint8, float16, float16)            \
+    CPU_DEVICE_BINARY_DECL(name, uint8, float16, float16)                   \
     CPU_DEVICE_BINARY_DECL(name, uint8, float32, float32)            \
     CPU_DEVICE_BINARY_DECL(name, uint8, float64, float64)            \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint8, complex32, complex32)        \
@@ -129,7 +139,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, uint16, int32, int32)               \
     CPU_DEVICE_BINARY_DECL(name, uint16, int64, int64)               \
     CPU_DEVICE_BINARY_DECL(name, uint16, bfloat16, float32)          \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint16, float16, float32)           \
+    CPU_DEVICE_BINARY_DECL(name, uint16, float16, float32)                  \
     CPU_DEVICE_BINARY_DECL(name, uint16, float32, float32)           \
     CPU_DEVICE_BINARY_DECL(name, uint16, float64, float64)           \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint16, complex32, complex64)       \
@@ -145,7 +155,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, uint32, int32, int64)               \
     CPU_DEVICE_BINARY_DECL(name, uint32, int64, int64)               \
     CPU_DEVICE_BINARY_DECL(name, uint32, bfloat16, float64)          \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint32, float16, float64)           \
+    CPU_DEVICE_BINARY_DECL(name, uint32, float16, float64)                  \
     CPU_DEVICE_BINARY_DECL(name, uint32, float32, float64)           \
     CPU_DEVICE_BINARY_DECL(name, uint32, float64, float64)           \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint32, complex32, complex128)      \
@@ -165,7 +175,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, int8, int32, int32)                 \
     CPU_DEVICE_BINARY_DECL(name, int8, int64, int64)                 \
     CPU_DEVICE_BINARY_DECL(name, int8, bfloat16, bfloat16)           \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, int8, float16, float16)             \
+    CPU_DEVICE_BINARY_DECL(name, int8, float16, float16)                    \
     CPU_DEVICE_BINARY_DECL(name, int8, float32, float32)             \
     CPU_DEVICE_BINARY_DECL(name, int8, float64, float64)             \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, int8, complex32, complex32)         \
@@ -180,7 +190,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, int16, int32, int32)                \
     CPU_DEVICE_BINARY_DECL(name, int16, int64, int64)                \
     CPU_DEVICE_BINARY_DECL(name, int16, bfloat16, float32)           \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, int16, float16, float32)            \
+    CPU_DEVICE_BINARY_DECL(name, int16, float16, float32)                   \
     CPU_DEVICE_BINARY_DECL(name, int16, float32, float32)            \
     CPU_DEVICE_BINARY_DECL(name, int16, float64, float64)            \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, int16, complex32, complex64)        \
@@ -195,7 +205,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, int32, int32, int32)                \
     CPU_DEVICE_BINARY_DECL(name, int32, int64, int64)                \
     CPU_DEVICE_BINARY_DECL(name, int32, bfloat16, float64)           \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, int32, float16, float64)            \
+    CPU_DEVICE_BINARY_DECL(name, int32, float16, float64)                   \
     CPU_DEVICE_BINARY_DECL(name, int32, float32, float64)            \
     CPU_DEVICE_BINARY_DECL(name, int32, float64, float64)            \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, int32, complex32, complex128)       \
@@ -217,26 +227,26 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, bfloat16, int16, float32)           \
     CPU_DEVICE_BINARY_DECL(name, bfloat16, int32, float64)           \
     CPU_DEVICE_BINARY_DECL(name, bfloat16, bfloat16, bfloat16)       \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, bfloat16, float16, float32)         \
+    CPU_DEVICE_BINARY_DECL(name, bfloat16, float16, float32)                \
     CPU_DEVICE_BINARY_DECL(name, bfloat16, float32, float32)         \
     CPU_DEVICE_BINARY_DECL(name, bfloat16, float64, float64)         \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, bfloat16, complex32, complex64)     \
     CPU_DEVICE_BINARY_DECL(name, bfloat16, complex64, complex64)     \
     CPU_DEVICE_BINARY_DECL(name, bfloat16, complex128, complex128)   \
                                                                      \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, uint8, float16)            \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, uint16, float32)           \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, uint32, float64)           \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, int8, float16)             \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, int16, float32)            \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, int32, float64)            \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, bfloat16, float32)         \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, float16, float16)          \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, float32, float32)          \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, float64, float64)          \
+    CPU_DEVICE_BINARY_DECL(name, float16, uint8, float16)                   \
+    CPU_DEVICE_BINARY_DECL(name, float16, uint16, float32)                  \
+    CPU_DEVICE_BINARY_DECL(name, float16, uint32, float64)                  \
+    CPU_DEVICE_BINARY_DECL(name, float16, int8, float16)                    \
+    CPU_DEVICE_BINARY_DECL(name, float16, int16, float32)                   \
+    CPU_DEVICE_BINARY_DECL(name, float16, int32, float64)                   \
+    CPU_DEVICE_BINARY_DECL(name, float16, bfloat16, float32)                \
+    CPU_DEVICE_BINARY_DECL(name, float16, float16, float16)                 \
+    CPU_DEVICE_BINARY_DECL(name, float16, float32, float32)                 \
+    CPU_DEVICE_BINARY_DECL(name, float16, float64, float64)                 \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, complex32, complex32)      \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, complex64, complex64)      \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, complex128, complex128)    \
+    CPU_DEVICE_BINARY_DECL(name, float16, complex64, complex64)             \
+    CPU_DEVICE_BINARY_DECL(name, float16, complex128, complex128)           \
                                                                      \
     CPU_DEVICE_BINARY_DECL(name, float32, uint8, float32)            \
     CPU_DEVICE_BINARY_DECL(name, float32, uint16, float32)           \
@@ -245,7 +255,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, float32, int16, float32)            \
     CPU_DEVICE_BINARY_DECL(name, float32, int32, float64)            \
     CPU_DEVICE_BINARY_DECL(name, float32, bfloat16, float32)         \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float32, float16, float32)          \
+    CPU_DEVICE_BINARY_DECL(name, float32, float16, float32)                 \
     CPU_DEVICE_BINARY_DECL(name, float32, float32, float32)          \
     CPU_DEVICE_BINARY_DECL(name, float32, float64, float64)          \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, float32, complex32, complex64)      \
@@ -259,7 +269,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, float64, int16, float64)            \
     CPU_DEVICE_BINARY_DECL(name, float64, int32, float64)            \
     CPU_DEVICE_BINARY_DECL(name, float64, bfloat16, float64)         \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float64, float16, float64)          \
+    CPU_DEVICE_BINARY_DECL(name, float64, float16, float64)                 \
     CPU_DEVICE_BINARY_DECL(name, float64, float32, float64)          \
     CPU_DEVICE_BINARY_DECL(name, float64, float64, float64)          \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, float64, complex32, complex128)     \
@@ -287,7 +297,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, complex64, int16, complex64)        \
     CPU_DEVICE_BINARY_DECL(name, complex64, int32, complex128)       \
     CPU_DEVICE_BINARY_DECL(name, complex64, bfloat16, complex64)     \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, complex64, float16, complex64)      \
+    CPU_DEVICE_BINARY_DECL(name, complex64, float16, complex64)             \
     CPU_DEVICE_BINARY_DECL(name, complex64, float32, complex64)      \
     CPU_DEVICE_BINARY_DECL(name, complex64, float64, complex128)     \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, complex64, complex32, complex64)    \
@@ -301,7 +311,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, complex128, int16, complex128)      \
     CPU_DEVICE_BINARY_DECL(name, complex128, int32, complex128)      \
     CPU_DEVICE_BINARY_DECL(name, complex128, bfloat16, complex128)   \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, complex128, float16, complex128)    \
+    CPU_DEVICE_BINARY_DECL(name, complex128, float16, complex128)           \
     CPU_DEVICE_BINARY_DECL(name, complex128, float32, complex128)    \
     CPU_DEVICE_BINARY_DECL(name, complex128, float64, complex128)    \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, complex128, complex32, complex128)  \
@@ -318,7 +328,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, uint8, int32, int32)                \
     CPU_DEVICE_BINARY_DECL(name, uint8, int64, int64)                \
     CPU_DEVICE_BINARY_DECL(name, uint8, bfloat16, bfloat16)          \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint8, float16, float16)            \
+    CPU_DEVICE_BINARY_DECL(name, uint8, float16, float16)                   \
     CPU_DEVICE_BINARY_DECL(name, uint8, float32, float32)            \
     CPU_DEVICE_BINARY_DECL(name, uint8, float64, float64)            \
     CPU_DEVICE_NOKERN_DECL(name, uint8, complex32, complex32)        \
@@ -334,7 +344,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, uint16, int32, int32)               \
     CPU_DEVICE_BINARY_DECL(name, uint16, int64, int64)               \
     CPU_DEVICE_BINARY_DECL(name, uint16, bfloat16, float32)          \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint16, float16, float32)           \
+    CPU_DEVICE_BINARY_DECL(name, uint16, float16, float32)                  \
     CPU_DEVICE_BINARY_DECL(name, uint16, float32, float32)           \
     CPU_DEVICE_BINARY_DECL(name, uint16, float64, float64)           \
     CPU_DEVICE_NOKERN_DECL(name, uint16, complex32, complex64)       \
@@ -350,7 +360,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, uint32, int32, int64)               \
     CPU_DEVICE_BINARY_DECL(name, uint32, int64, int64)               \
     CPU_DEVICE_BINARY_DECL(name, uint32, bfloat16, float64)          \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint32, float16, float64)           \
+    CPU_DEVICE_BINARY_DECL(name, uint32, float16, float64)                  \
     CPU_DEVICE_BINARY_DECL(name, uint32, float32, float64)           \
     CPU_DEVICE_BINARY_DECL(name, uint32, float64, float64)           \
     CPU_DEVICE_NOKERN_DECL(name, uint32, complex32, complex128)      \
@@ -370,7 +380,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, int8, int32, int32)                 \
     CPU_DEVICE_BINARY_DECL(name, int8, int64, int64)                 \
     CPU_DEVICE_BINARY_DECL(name, int8, bfloat16, bfloat16)           \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, int8, float16, float16)             \
+    CPU_DEVICE_BINARY_DECL(name, int8, float16, float16)                    \
     CPU_DEVICE_BINARY_DECL(name, int8, float32, float32)             \
     CPU_DEVICE_BINARY_DECL(name, int8, float64, float64)             \
     CPU_DEVICE_NOKERN_DECL(name, int8, complex32, complex32)         \
@@ -385,7 +395,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, int16, int32, int32)                \
     CPU_DEVICE_BINARY_DECL(name, int16, int64, int64)                \
     CPU_DEVICE_BINARY_DECL(name, int16, bfloat16, float32)           \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, int16, float16, float32)            \
+    CPU_DEVICE_BINARY_DECL(name, int16, float16, float32)                   \
     CPU_DEVICE_BINARY_DECL(name, int16, float32, float32)            \
     CPU_DEVICE_BINARY_DECL(name, int16, float64, float64)            \
     CPU_DEVICE_NOKERN_DECL(name, int16, complex32, complex64)        \
@@ -400,7 +410,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, int32, int32, int32)                \
     CPU_DEVICE_BINARY_DECL(name, int32, int64, int64)                \
     CPU_DEVICE_BINARY_DECL(name, int32, bfloat16, float64)           \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, int32, float16, float64)            \
+    CPU_DEVICE_BINARY_DECL(name, int32, float16, float64)                   \
     CPU_DEVICE_BINARY_DECL(name, int32, float32, float64)            \
     CPU_DEVICE_BINARY_DECL(name, int32, float64, float64)            \
     CPU_DEVICE_NOKERN_DECL(name, int32, complex32, complex128)       \
@@ -422,23 +432,23 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, bfloat16, int16, float32)           \
     CPU_DEVICE_BINARY_DECL(name, bfloat16, int32, float64)           \
     CPU_DEVICE_BINARY_DECL(name, bfloat16, bfloat16, bfloat16)       \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, bfloat16, float16, float32)         \
+    CPU_DEVICE_BINARY_DECL(name, bfloat16, float16, float32)                \
     CPU_DEVICE_BINARY_DECL(name, bfloat16, float32, float32)         \
     CPU_DEVICE_BINARY_DECL(name, bfloat16, float64, float64)         \
     CPU_DEVICE_NOKERN_DECL(name, bfloat16, complex32, complex64)     \
     CPU_DEVICE_NOKERN_DECL(name, bfloat16, complex64, complex64)     \
     CPU_DEVICE_NOKERN_DECL(name, bfloat16, complex128, complex128)   \
                                                                      \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, uint8, float16)            \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, uint16, float32)           \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, uint32, float64)           \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, int8, float16)             \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, int16, float32)            \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, int32, float64)            \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, bfloat16, float32)         \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, float16, float16)          \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, float32, float32)          \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, float64, float64)          \
+    CPU_DEVICE_BINARY_DECL(name, float16, uint8, float16)                   \
+    CPU_DEVICE_BINARY_DECL(name, float16, uint16, float32)                  \
+    CPU_DEVICE_BINARY_DECL(name, float16, uint32, float64)                  \
+    CPU_DEVICE_BINARY_DECL(name, float16, int8, float16)                    \
+    CPU_DEVICE_BINARY_DECL(name, float16, int16, float32)                   \
+    CPU_DEVICE_BINARY_DECL(name, float16, int32, float64)                   \
+    CPU_DEVICE_BINARY_DECL(name, float16, bfloat16, float32)                \
+    CPU_DEVICE_BINARY_DECL(name, float16, float16, float16)                 \
+    CPU_DEVICE_BINARY_DECL(name, float16, float32, float32)                 \
+    CPU_DEVICE_BINARY_DECL(name, float16, float64, float64)                 \
     CPU_DEVICE_NOKERN_DECL(name, float16, complex32, complex32)      \
     CPU_DEVICE_NOKERN_DECL(name, float16, complex64, complex64)      \
     CPU_DEVICE_NOKERN_DECL(name, float16, complex128, complex128)    \
@@ -450,7 +460,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, float32, int16, float32)            \
     CPU_DEVICE_BINARY_DECL(name, float32, int32, float64)            \
     CPU_DEVICE_BINARY_DECL(name, float32, bfloat16, float32)         \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float32, float16, float32)          \
+    CPU_DEVICE_BINARY_DECL(name, float32, float16, float32)                 \
     CPU_DEVICE_BINARY_DECL(name, float32, float32, float32)          \
     CPU_DEVICE_BINARY_DECL(name, float32, float64, float64)          \
     CPU_DEVICE_NOKERN_DECL(name, float32, complex32, complex64)      \
@@ -464,7 +474,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, float64, int16, float64)            \
     CPU_DEVICE_BINARY_DECL(name, float64, int32, float64)            \
     CPU_DEVICE_BINARY_DECL(name, float64, bfloat16, float64)         \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float64, float16, float64)          \
+    CPU_DEVICE_BINARY_DECL(name, float64, float16, float64)                 \
     CPU_DEVICE_BINARY_DECL(name, float64, float32, float64)          \
     CPU_DEVICE_BINARY_DECL(name, float64, float64, float64)          \
     CPU_DEVICE_NOKERN_DECL(name, float64, complex32, complex128)     \
@@ -514,16 +524,16 @@ typedef double float64_t;
     CPU_DEVICE_NOKERN_DECL(name, complex128, complex128, complex128)
 
 #define CPU_DEVICE_BINARY_ARITHMETIC_FLOAT_RETURN_DECL(name) \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint8, uint8, float16)              \
+    CPU_DEVICE_BINARY_DECL(name, uint8, uint8, float16)                     \
     CPU_DEVICE_BINARY_DECL(name, uint8, uint16, float32)             \
     CPU_DEVICE_BINARY_DECL(name, uint8, uint32, float64)             \
     CPU_DEVICE_NOKERN_DECL(name, uint8, uint64, uint64)              \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint8, int8, float16)               \
+    CPU_DEVICE_BINARY_DECL(name, uint8, int8, float16)                      \
     CPU_DEVICE_BINARY_DECL(name, uint8, int16, float32)              \
     CPU_DEVICE_BINARY_DECL(name, uint8, int32, float64)              \
     CPU_DEVICE_NOKERN_DECL(name, uint8, int64, int64)                \
     CPU_DEVICE_BINARY_DECL(name, uint8, bfloat16, bfloat16)          \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint8, float16, float16)            \
+    CPU_DEVICE_BINARY_DECL(name, uint8, float16, float16)                   \
     CPU_DEVICE_BINARY_DECL(name, uint8, float32, float32)            \
     CPU_DEVICE_BINARY_DECL(name, uint8, float64, float64)            \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint8, complex32, complex32)        \
@@ -539,7 +549,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, uint16, int32, float64)             \
     CPU_DEVICE_NOKERN_DECL(name, uint16, int64, int64)               \
     CPU_DEVICE_BINARY_DECL(name, uint16, bfloat16, float32)          \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint16, float16, float32)           \
+    CPU_DEVICE_BINARY_DECL(name, uint16, float16, float32)                  \
     CPU_DEVICE_BINARY_DECL(name, uint16, float32, float32)           \
     CPU_DEVICE_BINARY_DECL(name, uint16, float64, float64)           \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint16, complex32, complex64)       \
@@ -555,7 +565,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, uint32, int32, float64)             \
     CPU_DEVICE_NOKERN_DECL(name, uint32, int64, int64)               \
     CPU_DEVICE_BINARY_DECL(name, uint32, bfloat16, float64)          \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint32, float16, float64)           \
+    CPU_DEVICE_BINARY_DECL(name, uint32, float16, float64)                  \
     CPU_DEVICE_BINARY_DECL(name, uint32, float32, float64)           \
     CPU_DEVICE_BINARY_DECL(name, uint32, float64, float64)           \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint32, complex32, complex128)      \
@@ -567,15 +577,15 @@ typedef double float64_t;
     CPU_DEVICE_NOKERN_DECL(name, uint64, uint32, uint64)             \
     CPU_DEVICE_NOKERN_DECL(name, uint64, uint64, uint64)             \
                                                                      \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, int8, uint8, float16)               \
+    CPU_DEVICE_BINARY_DECL(name, int8, uint8, float16)                      \
     CPU_DEVICE_BINARY_DECL(name, int8, uint16, float32)              \
     CPU_DEVICE_BINARY_DECL(name, int8, uint32, float64)              \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, int8, int8, float16)                \
+    CPU_DEVICE_BINARY_DECL(name, int8, int8, float16)                       \
     CPU_DEVICE_BINARY_DECL(name, int8, int16, float32)               \
     CPU_DEVICE_BINARY_DECL(name, int8, int32, float64)               \
     CPU_DEVICE_NOKERN_DECL(name, int8, int64, int64)                 \
     CPU_DEVICE_BINARY_DECL(name, int8, bfloat16, bfloat16)           \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, int8, float16, float16)             \
+    CPU_DEVICE_BINARY_DECL(name, int8, float16, float16)                    \
     CPU_DEVICE_BINARY_DECL(name, int8, float32, float32)             \
     CPU_DEVICE_BINARY_DECL(name, int8, float64, float64)             \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, int8, complex32, complex32)         \
@@ -590,7 +600,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, int16, int32, float64)              \
     CPU_DEVICE_NOKERN_DECL(name, int16, int64, int64)                \
     CPU_DEVICE_BINARY_DECL(name, int16, bfloat16, float32)           \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, int16, float16, float32)            \
+    CPU_DEVICE_BINARY_DECL(name, int16, float16, float32)                   \
     CPU_DEVICE_BINARY_DECL(name, int16, float32, float32)            \
     CPU_DEVICE_BINARY_DECL(name, int16, float64, float64)            \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, int16, complex32, complex64)        \
@@ -605,7 +615,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, int32, int32, float64)              \
     CPU_DEVICE_NOKERN_DECL(name, int32, int64, int64)                \
     CPU_DEVICE_BINARY_DECL(name, int32, bfloat16, float64)           \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, int32, float16, float64)            \
+    CPU_DEVICE_BINARY_DECL(name, int32, float16, float64)                   \
     CPU_DEVICE_BINARY_DECL(name, int32, float32, float64)            \
     CPU_DEVICE_BINARY_DECL(name, int32, float64, float64)            \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, int32, complex32, complex128)       \
@@ -627,26 +637,26 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, bfloat16, int16, float32)           \
     CPU_DEVICE_BINARY_DECL(name, bfloat16, int32, float64)           \
     CPU_DEVICE_BINARY_DECL(name, bfloat16, bfloat16, bfloat16)       \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, bfloat16, float16, float32)         \
+    CPU_DEVICE_BINARY_DECL(name, bfloat16, float16, float32)                \
     CPU_DEVICE_BINARY_DECL(name, bfloat16, float32, float32)         \
     CPU_DEVICE_BINARY_DECL(name, bfloat16, float64, float64)         \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, bfloat16, complex32, complex64)     \
     CPU_DEVICE_BINARY_DECL(name, bfloat16, complex64, complex64)     \
     CPU_DEVICE_BINARY_DECL(name, bfloat16, complex128, complex128)   \
                                                                      \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, uint8, float16)            \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, uint16, float32)           \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, uint32, float64)           \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, int8, float16)             \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, int16, float32)            \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, int32, float64)            \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, bfloat16, float32)         \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, float16, float16)          \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, float32, float32)          \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, float64, float64)          \
+    CPU_DEVICE_BINARY_DECL(name, float16, uint8, float16)                   \
+    CPU_DEVICE_BINARY_DECL(name, float16, uint16, float32)                  \
+    CPU_DEVICE_BINARY_DECL(name, float16, uint32, float64)                  \
+    CPU_DEVICE_BINARY_DECL(name, float16, int8, float16)                    \
+    CPU_DEVICE_BINARY_DECL(name, float16, int16, float32)                   \
+    CPU_DEVICE_BINARY_DECL(name, float16, int32, float64)                   \
+    CPU_DEVICE_BINARY_DECL(name, float16, bfloat16, float32)                \
+    CPU_DEVICE_BINARY_DECL(name, float16, float16, float16)                 \
+    CPU_DEVICE_BINARY_DECL(name, float16, float32, float32)                 \
+    CPU_DEVICE_BINARY_DECL(name, float16, float64, float64)                 \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, complex32, complex32)      \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, complex64, complex64)      \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, complex128, complex128)    \
+    CPU_DEVICE_BINARY_DECL(name, float16, complex64, complex64)             \
+    CPU_DEVICE_BINARY_DECL(name, float16, complex128, complex128)           \
                                                                      \
     CPU_DEVICE_BINARY_DECL(name, float32, uint8, float32)            \
     CPU_DEVICE_BINARY_DECL(name, float32, uint16, float32)           \
@@ -655,7 +665,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, float32, int16, float32)            \
     CPU_DEVICE_BINARY_DECL(name, float32, int32, float64)            \
     CPU_DEVICE_BINARY_DECL(name, float32, bfloat16, float32)         \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float32, float16, float32)          \
+    CPU_DEVICE_BINARY_DECL(name, float32, float16, float32)                 \
     CPU_DEVICE_BINARY_DECL(name, float32, float32, float32)          \
     CPU_DEVICE_BINARY_DECL(name, float32, float64, float64)          \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, float32, complex32, complex64)      \
@@ -669,7 +679,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, float64, int16, float64)            \
     CPU_DEVICE_BINARY_DECL(name, float64, int32, float64)            \
     CPU_DEVICE_BINARY_DECL(name, float64, bfloat16, float64)         \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float64, float16, float64)          \
+    CPU_DEVICE_BINARY_DECL(name, float64, float16, float64)                 \
     CPU_DEVICE_BINARY_DECL(name, float64, float32, float64)          \
     CPU_DEVICE_BINARY_DECL(name, float64, float64, float64)          \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, float64, complex32, complex128)     \
@@ -697,7 +707,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, complex64, int16, complex64)        \
     CPU_DEVICE_BINARY_DECL(name, complex64, int32, complex128)       \
     CPU_DEVICE_BINARY_DECL(name, complex64, bfloat16, complex64)     \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, complex64, float16, complex64)      \
+    CPU_DEVICE_BINARY_DECL(name, complex64, float16, complex64)             \
     CPU_DEVICE_BINARY_DECL(name, complex64, float32, complex64)      \
     CPU_DEVICE_BINARY_DECL(name, complex64, float64, complex128)     \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, complex64, complex32, complex64)    \
@@ -711,7 +721,7 @@ typedef double float64_t;
     CPU_DEVICE_BINARY_DECL(name, complex128, int16, complex128)      \
     CPU_DEVICE_BINARY_DECL(name, complex128, int32, complex128)      \
     CPU_DEVICE_BINARY_DECL(name, complex128, bfloat16, complex128)   \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, complex128, float16, complex128)    \
+    CPU_DEVICE_BINARY_DECL(name, complex128, float16, complex128)           \
     CPU_DEVICE_BINARY_DECL(name, complex128, float32, complex128)    \
     CPU_DEVICE_BINARY_DECL(name, complex128, float64, complex128)    \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, complex128, complex32, complex128)  \
@@ -742,7 +752,7 @@ CPU_DEVICE_BINARY_ARITHMETIC_DECL(power)
     CPU_DEVICE_BINARY_DECL(name, uint8, int32, bool)                 \
     CPU_DEVICE_BINARY_DECL(name, uint8, int64, bool)                 \
     CPU_DEVICE_BINARY_DECL(name, uint8, bfloat16, bool)              \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint8, float16, bool)        \
+    CPU_DEVICE_BINARY_DECL(name, uint8, float16, bool)               \
     CPU_DEVICE_BINARY_DECL(name, uint8, float32, bool)               \
     CPU_DEVICE_BINARY_DECL(name, uint8, float64, bool)               \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint8, complex32, bool)      \
@@ -758,7 +768,7 @@ CPU_DEVICE_BINARY_ARITHMETIC_DECL(power)
     CPU_DEVICE_BINARY_DECL(name, uint16, int32, bool)                \
     CPU_DEVICE_BINARY_DECL(name, uint16, int64, bool)                \
     CPU_DEVICE_BINARY_DECL(name, uint16, bfloat16, bool)             \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint16, float16, bool)       \
+    CPU_DEVICE_BINARY_DECL(name, uint16, float16, bool)              \
     CPU_DEVICE_BINARY_DECL(name, uint16, float32, bool)              \
     CPU_DEVICE_BINARY_DECL(name, uint16, float64, bool)              \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint16, complex32, bool)     \
@@ -774,7 +784,7 @@ CPU_DEVICE_BINARY_ARITHMETIC_DECL(power)
     CPU_DEVICE_BINARY_DECL(name, uint32, int32, bool)                \
     CPU_DEVICE_BINARY_DECL(name, uint32, int64, bool)                \
     CPU_DEVICE_BINARY_DECL(name, uint32, bfloat16, bool)             \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint32, float16, bool)       \
+    CPU_DEVICE_BINARY_DECL(name, uint32, float16, bool)              \
     CPU_DEVICE_BINARY_DECL(name, uint32, float32, bool)              \
     CPU_DEVICE_BINARY_DECL(name, uint32, float64, bool)              \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, uint32, complex32, bool)     \
@@ -794,7 +804,7 @@ CPU_DEVICE_BINARY_ARITHMETIC_DECL(power)
     CPU_DEVICE_BINARY_DECL(name, int8, int32, bool)                  \
     CPU_DEVICE_BINARY_DECL(name, int8, int64, bool)                  \
     CPU_DEVICE_BINARY_DECL(name, int8, bfloat16, bool)               \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, int8, float16, bool)         \
+    CPU_DEVICE_BINARY_DECL(name, int8, float16, bool)                \
     CPU_DEVICE_BINARY_DECL(name, int8, float32, bool)                \
     CPU_DEVICE_BINARY_DECL(name, int8, float64, bool)                \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, int8, complex32, bool)       \
@@ -809,7 +819,7 @@ CPU_DEVICE_BINARY_ARITHMETIC_DECL(power)
     CPU_DEVICE_BINARY_DECL(name, int16, int32, bool)                 \
     CPU_DEVICE_BINARY_DECL(name, int16, int64, bool)                 \
     CPU_DEVICE_BINARY_DECL(name, int16, bfloat16, bool)              \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, int16, float16, bool)        \
+    CPU_DEVICE_BINARY_DECL(name, int16, float16, bool)               \
     CPU_DEVICE_BINARY_DECL(name, int16, float32, bool)               \
     CPU_DEVICE_BINARY_DECL(name, int16, float64, bool)               \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, int16, complex32, bool)      \
@@ -824,7 +834,7 @@ CPU_DEVICE_BINARY_ARITHMETIC_DECL(power)
     CPU_DEVICE_BINARY_DECL(name, int32, int32, bool)                 \
     CPU_DEVICE_BINARY_DECL(name, int32, int64, bool)                 \
     CPU_DEVICE_BINARY_DECL(name, int32, bfloat16, bool)              \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, int32, float16, bool)        \
+    CPU_DEVICE_BINARY_DECL(name, int32, float16, bool)               \
     CPU_DEVICE_BINARY_DECL(name, int32, float32, bool)               \
     CPU_DEVICE_BINARY_DECL(name, int32, float64, bool)               \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, int32, complex32, bool)      \
@@ -853,19 +863,19 @@ CPU_DEVICE_BINARY_ARITHMETIC_DECL(power)
     CPU_DEVICE_BINARY_DECL(name, bfloat16, complex64, bool)          \
     CPU_DEVICE_BINARY_DECL(name, bfloat16, complex128, bool)         \
                                                                      \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, uint8, bool)        \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, uint16, bool)       \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, uint32, bool)       \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, int8, bool)         \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, int16, bool)        \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, int32, bool)        \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, bfloat16, bool)     \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, float16, bool)      \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, float32, bool)      \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, float64, bool)      \
+    CPU_DEVICE_BINARY_DECL(name, float16, uint8, bool)               \
+    CPU_DEVICE_BINARY_DECL(name, float16, uint16, bool)              \
+    CPU_DEVICE_BINARY_DECL(name, float16, uint32, bool)              \
+    CPU_DEVICE_BINARY_DECL(name, float16, int8, bool)                \
+    CPU_DEVICE_BINARY_DECL(name, float16, int16, bool)               \
+    CPU_DEVICE_BINARY_DECL(name, float16, int32, bool)               \
+    CPU_DEVICE_BINARY_DECL(name, float16, bfloat16, bool)            \
+    CPU_DEVICE_BINARY_DECL(name, float16, float16, bool)             \
+    CPU_DEVICE_BINARY_DECL(name, float16, float32, bool)             \
+    CPU_DEVICE_BINARY_DECL(name, float16, float64, bool)             \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, complex32, bool)    \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, complex64, bool)    \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float16, complex128, bool)   \
+    CPU_DEVICE_BINARY_DECL(name, float16, complex64, bool)           \
+    CPU_DEVICE_BINARY_DECL(name, float16, complex128, bool)          \
                                                                      \
     CPU_DEVICE_BINARY_DECL(name, float32, uint8, bool)               \
     CPU_DEVICE_BINARY_DECL(name, float32, uint16, bool)              \
@@ -874,7 +884,7 @@ CPU_DEVICE_BINARY_ARITHMETIC_DECL(power)
     CPU_DEVICE_BINARY_DECL(name, float32, int16, bool)               \
     CPU_DEVICE_BINARY_DECL(name, float32, int32, bool)               \
     CPU_DEVICE_BINARY_DECL(name, float32, bfloat16, bool)            \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float32, float16, bool)      \
+    CPU_DEVICE_BINARY_DECL(name, float32, float16, bool)             \
     CPU_DEVICE_BINARY_DECL(name, float32, float32, bool)             \
     CPU_DEVICE_BINARY_DECL(name, float32, float64, bool)             \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, float32, complex32, bool)    \
@@ -888,7 +898,7 @@ CPU_DEVICE_BINARY_ARITHMETIC_DECL(power)
     CPU_DEVICE_BINARY_DECL(name, float64, int16, bool)               \
     CPU_DEVICE_BINARY_DECL(name, float64, int32, bool)               \
     CPU_DEVICE_BINARY_DECL(name, float64, bfloat16, bool)            \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, float64, float16, bool)      \
+    CPU_DEVICE_BINARY_DECL(name, float64, float16, bool)             \
     CPU_DEVICE_BINARY_DECL(name, float64, float32, bool)             \
     CPU_DEVICE_BINARY_DECL(name, float64, float64, bool)             \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, float64, complex32, bool)    \
@@ -916,7 +926,7 @@ CPU_DEVICE_BINARY_ARITHMETIC_DECL(power)
     CPU_DEVICE_BINARY_DECL(name, complex64, int16, bool)             \
     CPU_DEVICE_BINARY_DECL(name, complex64, int32, bool)             \
     CPU_DEVICE_BINARY_DECL(name, complex64, bfloat16, bool)          \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, complex64, float16, bool)    \
+    CPU_DEVICE_BINARY_DECL(name, complex64, float16, bool)           \
     CPU_DEVICE_BINARY_DECL(name, complex64, float32, bool)           \
     CPU_DEVICE_BINARY_DECL(name, complex64, float64, bool)           \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, complex64, complex32, bool)  \
@@ -930,7 +940,7 @@ CPU_DEVICE_BINARY_ARITHMETIC_DECL(power)
     CPU_DEVICE_BINARY_DECL(name, complex128, int16, bool)            \
     CPU_DEVICE_BINARY_DECL(name, complex128, int32, bool)            \
     CPU_DEVICE_BINARY_DECL(name, complex128, bfloat16, bool)         \
-    CPU_DEVICE_BINARY_NOIMPL_DECL(name, complex128, float16, bool)   \
+    CPU_DEVICE_BINARY_DECL(name, complex128, float16, bool)          \
     CPU_DEVICE_BINARY_DECL(name, complex128, float32, bool)          \
     CPU_DEVICE_BINARY_DECL(name, complex128, float64, bool)          \
     CPU_DEVICE_BINARY_NOIMPL_DECL(name, complex128, complex32, bool) \
@@ -1053,6 +1063,7 @@ CPU_DEVICE_ALL_BITWISE_DECL(bitwise_xor)
     CPU_DEVICE_BINARY_MV_DECL(name, int32, int32, int32, int32)             \
     CPU_DEVICE_BINARY_MV_DECL(name, int64, int64, int64, int64)             \
     CPU_DEVICE_BINARY_MV_DECL(name, bfloat16, bfloat16, bfloat16, bfloat16) \
+    CPU_DEVICE_BINARY_MV_DECL(name, float16, float16, float16, float16)     \
     CPU_DEVICE_BINARY_MV_DECL(name, float32, float32, float32, float32)     \
     CPU_DEVICE_BINARY_MV_DECL(name, float64, float64, float64, float64)
 
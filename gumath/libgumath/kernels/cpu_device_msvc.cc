@@ -121,8 +121,8 @@ gm_cpu_device_0D_##name##_##t0##_##t1(const char *a0, char *a1)
     CPU_DEVICE_UNARYC(name, func, bfloat16, complex128, complex128)   \
                                                                       \
     CPU_DEVICE_NOIMPL(name, func, float16, complex32, complex32)      \
-    CPU_DEVICE_NOIMPL(name, func, float16, complex64, complex64)      \
-    CPU_DEVICE_NOIMPL(name, func, float16, complex128, complex128)    \
+    CPU_DEVICE_UNARYC(name, func, float16, complex64, complex64)      \
+    CPU_DEVICE_UNARYC(name, func, float16, complex128, complex128)    \
                                                                       \
     CPU_DEVICE_UNARYC(name, func, float32, complex64, complex64)      \
     CPU_DEVICE_UNARYC(name, func, float32, complex128, complex128)    \
@@ -164,9 +164,6 @@ CPU_DEVICE_UNARYC(negative, negative, complex128, complex128, complex128)
     CPU_DEVICE_UNARYC(name, name, complex64, complex64, complex64)    \
     CPU_DEVICE_UNARYC(name, name, complex128, complex128, complex128) \
 
-#define CPU_DEVICE_UNARY_ALL_COMPLEX_MATH_WITH_HALF(name, hfunc) \
-    CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(name)
-
 
 /*****************************************************************************/
 /*                             Exponential functions                         */
@@ -249,6 +246,31 @@ gm_cpu_device_fixed_1D_C_##name##_##t0##_##t1##_##t2(                    \
 }                                                                        \
                                                                          \
 extern "C" void                                                          \
+gm_cpu_device_fixed_1D_Z_##name##_##t0##_##t1##_##t2(                    \
+    const char *a0, const char *a1, char *a2,                            \
+    const int64_t s0, const int64_t s1,                                  \
+    const int64_t N)                                                     \
+{                                                                        \
+    const t0##_t *x0 = (const t0##_t *)a0;                               \
+    const t1##_t *x1 = (const t1##_t *)a1;                               \
+    t2##_t *x2 = (t2##_t *)a2;                                           \
+    (void)s1;                                                            \
+                                                                         \
+    if (s0 == 0) {                                                       \
+        const common##_t c = (common##_t)x0[0];                          \
+        for (int64_t i = 0; i < N; i++) {                                \
+            x2[i] = func(c, (common##_t)x1[i]);                          \
+        }                                                                \
+    }                                                                    \
+    else {                                                               \
+        const common##_t c = (common##_t)x1[0];                          \
+        for (int64_t i = 0; i < N; i++) {                                \
+            x2[i] = func((common##_t)x0[i], c);                          \
+        }                                                                \
+    }                                                                    \
+}                                                                        \
+                                                                         \
+extern "C" void                                                          \
 gm_cpu_device_fixed_1D_S_##name##_##t0##_##t1##_##t2(                    \
     const char *a0, const char *a1, char *a2,                            \
     const int64_t s0, const int64_t s1, const int64_t s2,                \
@@ -311,8 +333,6 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                            \
     CPU_DEVICE_BINARYC(name, func, int32, complex128, complex128, complex128)      \
                                                                                    \
     CPU_DEVICE_NOIMPL(name, func, float16, complex32, complex32, complex32)        \
-    CPU_DEVICE_NOIMPL(name, func, float16, complex64, complex64, complex64)        \
-    CPU_DEVICE_NOIMPL(name, func, float16, complex128, complex128, complex128)     \
                                                                                    \
     CPU_DEVICE_NOIMPL(name, func, float32, complex32, complex64, complex64)        \
     CPU_DEVICE_BINARYC(name, func, float32, complex64, complex64, complex64)       \
@@ -341,7 +361,6 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                            \
     CPU_DEVICE_BINARYC(name, func, complex64, int8, complex64, complex64)          \
     CPU_DEVICE_BINARYC(name, func, complex64, int16, complex64, complex64)         \
     CPU_DEVICE_BINARYC(name, func, complex64, int32, complex128, complex128)       \
-    CPU_DEVICE_NOIMPL(name, func, complex64, float16, complex64, complex64)        \
     CPU_DEVICE_BINARYC(name, func, complex64, float32, complex64, complex64)       \
     CPU_DEVICE_BINARYC(name, func, complex64, float64, complex128, complex128)     \
     CPU_DEVICE_NOIMPL(name, func, complex64, complex32, complex64, complex64)      \
@@ -354,7 +373,6 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                            \
     CPU_DEVICE_BINARYC(name, func, complex128, int8, complex128, complex128)       \
     CPU_DEVICE_BINARYC(name, func, complex128, int16, complex128, complex128)      \
     CPU_DEVICE_BINARYC(name, func, complex128, int32, complex128, complex128)      \
-    CPU_DEVICE_NOIMPL(name, func, complex128, float16, complex128, complex128)     \
     CPU_DEVICE_BINARYC(name, func, complex128, float32, complex128, complex128)    \
     CPU_DEVICE_BINARYC(name, func, complex128, float64, complex128, complex128)    \
     CPU_DEVICE_NOIMPL(name, func, complex128, complex32, complex128, complex128)   \
@@ -387,8 +405,6 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                            \
     CPU_DEVICE_BINARYC(name, func, int32, complex128, complex128, complex128)      \
                                                                                    \
     CPU_DEVICE_NOIMPL(name, func, float16, complex32, complex32, complex32)        \
-    CPU_DEVICE_NOIMPL(name, func, float16, complex64, complex64, complex64)        \
-    CPU_DEVICE_NOIMPL(name, func, float16, complex128, complex128, complex128)     \
                                                                                    \
     CPU_DEVICE_NOIMPL(name, func, float32, complex32, complex64, complex64)        \
     CPU_DEVICE_BINARYC(name, func, float32, complex64, complex64, complex64)       \
@@ -417,7 +433,6 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                            \
     CPU_DEVICE_BINARYC(name, func, complex64, int8, complex64, complex64)          \
     CPU_DEVICE_BINARYC(name, func, complex64, int16, complex64, complex64)         \
     CPU_DEVICE_BINARYC(name, func, complex64, int32, complex128, complex128)       \
-    CPU_DEVICE_NOIMPL(name, func, complex64, float16, complex64, complex64)        \
     CPU_DEVICE_BINARYC(name, func, complex64, float32, complex64, complex64)       \
     CPU_DEVICE_BINARYC(name, func, complex64, float64, complex128, complex128)     \
     CPU_DEVICE_NOIMPL(name, func, complex64, complex32, complex64, complex64)      \
@@ -430,7 +445,6 @@ gm_cpu_device_0D_##name##_##t0##_##t1##_##t2(                            \
     CPU_DEVICE_BINARYC(name, func, complex128, int8, complex128, complex128)       \
     CPU_DEVICE_BINARYC(name, func, complex128, int16, complex128, complex128)      \
     CPU_DEVICE_BINARYC(name, func, complex128, int32, complex128, complex128)      \
-    CPU_DEVICE_NOIMPL(name, func, complex128, float16, complex128, complex128)     \
     CPU_DEVICE_BINARYC(name, func, complex128, float32, complex128, complex128)    \
     CPU_DEVICE_BINARYC(name, func, complex128, float64, complex128, complex128)    \
     CPU_DEVICE_NOIMPL(name, func, complex128, complex32, complex128, complex128)   \
@@ -482,8 +496,6 @@ CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
     CPU_DEVICE_BINARYC(name, cfunc, int32, complex128, bool, complex128)      \
                                                                               \
     CPU_DEVICE_NOIMPL(name, cfunc, float16, complex32, bool, complex32)       \
-    CPU_DEVICE_NOIMPL(name, cfunc, float16, complex64, bool, complex64)       \
-    CPU_DEVICE_NOIMPL(name, cfunc, float16, complex128, bool, complex128)     \
                                                                               \
     CPU_DEVICE_NOIMPL(name, cfunc, float32, complex32, bool, complex64)       \
     CPU_DEVICE_BINARYC(name, cfunc, float32, complex64, bool, complex64)      \
@@ -512,7 +524,6 @@ CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
     CPU_DEVICE_BINARYC(name, cfunc, complex64, int8, bool, complex64)         \
     CPU_DEVICE_BINARYC(name, cfunc, complex64, int16, bool, complex64)        \
     CPU_DEVICE_BINARYC(name, cfunc, complex64, int32, bool, complex128)       \
-    CPU_DEVICE_NOIMPL(name, cfunc, complex64, float16, bool, complex64)       \
     CPU_DEVICE_BINARYC(name, cfunc, complex64, float32, bool, complex64)      \
     CPU_DEVICE_BINARYC(name, cfunc, complex64, float64, bool, complex128)     \
     CPU_DEVICE_NOIMPL(name, cfunc, complex64, complex32, bool, complex64)     \
@@ -525,7 +536,6 @@ CPU_DEVICE_ALL_BINARY(power, _pow, _pow)
     CPU_DEVICE_BINARYC(name, cfunc, complex128, int8, bool, complex128)       \
     CPU_DEVICE_BINARYC(name, cfunc, complex128, int16, bool, complex128)      \
     CPU_DEVICE_BINARYC(name, cfunc, complex128, int32, bool, complex128)      \
-    CPU_DEVICE_NOIMPL(name, cfunc, complex128, float16, bool, complex128)     \
     CPU_DEVICE_BINARYC(name, cfunc, complex128, float32, bool, complex128)    \
     CPU_DEVICE_BINARYC(name, cfunc, complex128, float64, bool, complex128)    \
     CPU_DEVICE_NOIMPL(name, cfunc, complex128, complex32, bool, complex128)   \
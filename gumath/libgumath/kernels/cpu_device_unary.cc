@@ -31,18 +31,22 @@
 */
 
 
+#include <algorithm>
 #include <cinttypes>
 #include <cmath>
 #include <complex>
 #include "cpu_device_unary.h"
 #include "contrib/bfloat16.h"
+#include "float16.h"
+#include "isa.h"
+#include "vmath.h"
 
 
 /*****************************************************************************/
 /*                          CPU device unary kernels                         */
 /*****************************************************************************/
 
-#define CPU_DEVICE_UNARY(name, func, t0, t1, common) \
+#define CPU_DEVICE_UNARY_1D_C_SCALAR(name, func, t0, t1, common) \
 extern "C" void                                                                   \
 gm_cpu_device_fixed_1D_C_##name##_##t0##_##t1(const char *a0, char *a1,           \
                                               const int64_t N)                    \
@@ -53,9 +57,82 @@ gm_cpu_device_fixed_1D_C_##name##_##t0##_##t1(const char *a0, char *a1,
     for (int64_t i = 0; i < N; i++) {                                             \
         x1[i] = func((common##_t)x0[i]);                                          \
     }                                                                             \
-}                                                                                 \
+}
+
+/*
+ * Per-ISA clones of the contiguous loop, selected by GM_ISA_CALL.  Kernels
+ * with float16 or bfloat16 operands are widened to float in blocks, see
+ * CPU_DEVICE_BINARY_LOOP.
+ */
+#define CPU_DEVICE_UNARY_LOOP(name, func, t0, t1, common, isa, target) \
+static target void                                                                \
+unary_1D_C_##name##_##t0##_##t1##_##isa(const t0##_t *x0, t1##_t *x1,             \
+                                        const int64_t N)                          \
+{                                                                                 \
+    typedef gm::half_wide<t0##_t>::type w0_t;                                     \
+    typedef gm::half_wide<t1##_t>::type w1_t;                                     \
+    typedef gm::half_wide<common##_t>::type wc_t;                                 \
+                                                                                  \
+    if (gm::half_wide<t0##_t>::value || gm::half_wide<t1##_t>::value) {           \
+        w0_t b0[GM_HALF_BLOCKSIZE];                                               \
+        w1_t b1[GM_HALF_BLOCKSIZE];                                               \
+                                                                                  \
+        for (int64_t i = 0; i < N; i += GM_HALF_BLOCKSIZE) {                      \
+            const int64_t n = std::min<int64_t>(N-i, GM_HALF_BLOCKSIZE);          \
+            const w0_t *y0 = gm::half_widen_##isa(x0+i, b0, n);                   \
+            w1_t *y1 = gm::half_out(x1+i, b1);                                    \
+                                                                                  \
+            for (int64_t k = 0; k < n; k++) {                                     \
+                y1[k] = func((wc_t)y0[k]);                                        \
+            }                                                                     \
+                                                                                  \
+            gm::half_narrow_##isa(x1+i, y1, n);                                   \
+        }                                                                         \
+    }                                                                             \
+    else {                                                                        \
+        for (int64_t i = 0; i < N; i++) {                                         \
+            x1[i] = func((common##_t)x0[i]);                                      \
+        }                                                                         \
+    }                                                                             \
+}
+
+/* As in the binary kernels, only same-type kernels are cloned per ISA. */
+#ifdef GM_ISA_DISPATCH
+  #define CPU_DEVICE_UNARY_CLONES(name, func, t0, t1, common) \
+    CPU_DEVICE_UNARY_LOOP(name, func, t0, t1, common, base, )                  \
+    CPU_DEVICE_UNARY_LOOP(name, func, t0, t1, common, avx2, GM_TARGET_AVX2)     \
+    CPU_DEVICE_UNARY_LOOP(name, func, t0, t1, common, avx512, GM_TARGET_AVX512)
+#else
+  #define CPU_DEVICE_UNARY_CLONES(name, func, t0, t1, common) \
+    CPU_DEVICE_UNARY_LOOP(name, func, t0, t1, common, base, )
+#endif
+
+#define CPU_DEVICE_UNARY_BASE(name, func, t0, t1, common) \
+    CPU_DEVICE_UNARY_LOOP(name, func, t0, t1, common, base, )
+
+#define CPU_DEVICE_UNARY_1D_C_LOOP(name, func, t0, t1, common, clones, call) \
+clones(name, func, t0, t1, common)                                                \
                                                                                   \
 extern "C" void                                                                   \
+gm_cpu_device_fixed_1D_C_##name##_##t0##_##t1(const char *a0, char *a1,           \
+                                              const int64_t N)                    \
+{                                                                                 \
+    const t0##_t *x0 = (const t0##_t *)a0;                                        \
+    t1##_t *x1 = (t1##_t *)a1;                                                    \
+                                                                                  \
+    call(unary_1D_C_##name##_##t0##_##t1, (x0, x1, N))                            \
+}
+
+#define CPU_DEVICE_UNARY_1D_C_ISA(name, func, t0, t1, common) \
+    CPU_DEVICE_UNARY_1D_C_LOOP(name, func, t0, t1, common,     \
+                               CPU_DEVICE_UNARY_CLONES, GM_ISA_CALL)
+
+#define CPU_DEVICE_UNARY_1D_C_BASE(name, func, t0, t1, common) \
+    CPU_DEVICE_UNARY_1D_C_LOOP(name, func, t0, t1, common,      \
+                               CPU_DEVICE_UNARY_BASE, GM_ISA_CALL_BASE)
+
+#define CPU_DEVICE_UNARY_1D_S_0D(name, func, t0, t1, common) \
+extern "C" void                                                                   \
 gm_cpu_device_fixed_1D_S_##name##_##t0##_##t1(const char *a0, char *a1,           \
                                               const int64_t s0, const int64_t s1, \
                                               const int64_t N)                    \
@@ -77,18 +154,36 @@ gm_cpu_device_0D_##name##_##t0##_##t1(const char *a0, char *a1)
     *x1 = func((common##_t)x0);                                                   \
 }
 
+/*
+ * For the function families that benefit from vectorization, the contiguous
+ * kernels are redefined to CPU_DEVICE_UNARY_1D_C_BASE and, for kernels whose
+ * input and output have the same type, to CPU_DEVICE_UNARY_1D_C_ISA.
+ */
+#define CPU_DEVICE_UNARY_1D_C CPU_DEVICE_UNARY_1D_C_SCALAR
+#define CPU_DEVICE_UNARY_1D_C_SAME CPU_DEVICE_UNARY_1D_C_SCALAR
+
+#define CPU_DEVICE_UNARY(name, func, t0, t1, common) \
+    CPU_DEVICE_UNARY_1D_C(name, func, t0, t1, common) \
+    CPU_DEVICE_UNARY_1D_S_0D(name, func, t0, t1, common)
+
+#define CPU_DEVICE_UNARY_SAME(name, func, t0, t1, common) \
+    CPU_DEVICE_UNARY_1D_C_SAME(name, func, t0, t1, common) \
+    CPU_DEVICE_UNARY_1D_S_0D(name, func, t0, t1, common)
+
+/* Complex kernels do not vectorize, they are always scalar. */
 #ifdef _MSC_VER
   #define CPU_DEVICE_UNARYC(name, func, t0, t1, common)
 #else
   #define CPU_DEVICE_UNARYC(name, func, t0, t1, common) \
-    CPU_DEVICE_UNARY(name, func, t0, t1, common)
+    CPU_DEVICE_UNARY_1D_C_SCALAR(name, func, t0, t1, common) \
+    CPU_DEVICE_UNARY_1D_S_0D(name, func, t0, t1, common)
 #endif
 
 #define CPU_DEVICE_NOIMPL(name, func, t0, t1, common)
 
 
 #define CPU_DEVICE_ALL_UNARY(name, func, ufunc, tfunc, hfunc) \
-    CPU_DEVICE_UNARY(name, func, bool, bool, bool)                    \
+    CPU_DEVICE_UNARY_SAME(name, func, bool, bool, bool)               \
     CPU_DEVICE_UNARY(name, ufunc, bool, uint8, uint8)                 \
     CPU_DEVICE_UNARY(name, ufunc, bool, uint16, uint16)               \
     CPU_DEVICE_UNARY(name, ufunc, bool, uint32, uint32)               \
@@ -98,14 +193,14 @@ gm_cpu_device_0D_##name##_##t0##_##t1(const char *a0, char *a1)
     CPU_DEVICE_UNARY(name, func, bool, int32, int32)                  \
     CPU_DEVICE_UNARY(name, func, bool, int64, int64)                  \
     CPU_DEVICE_UNARY(name, tfunc, bool, bfloat16, bfloat16)           \
-    CPU_DEVICE_NOIMPL(name, hfunc, bool, float16, float16)            \
+    CPU_DEVICE_UNARY(name, hfunc, bool, float16, float16)             \
     CPU_DEVICE_UNARY(name, func, bool, float32, float32)              \
     CPU_DEVICE_UNARY(name, func, bool, float64, float64)              \
     CPU_DEVICE_NOIMPL(name, func, bool, complex32, complex32)         \
     CPU_DEVICE_UNARYC(name, func, bool, complex64, complex64)         \
     CPU_DEVICE_UNARYC(name, func, bool, complex128, complex128)       \
                                                                       \
-    CPU_DEVICE_UNARY(name, ufunc, uint8, uint8, uint8)                \
+    CPU_DEVICE_UNARY_SAME(name, ufunc, uint8, uint8, uint8)           \
     CPU_DEVICE_UNARY(name, ufunc, uint8, uint16, uint16)              \
     CPU_DEVICE_UNARY(name, ufunc, uint8, uint32, uint32)              \
     CPU_DEVICE_UNARY(name, ufunc, uint8, uint64, uint64)              \
@@ -113,14 +208,14 @@ gm_cpu_device_0D_##name##_##t0##_##t1(const char *a0, char *a1)
     CPU_DEVICE_UNARY(name, func, uint8, int32, int32)                 \
     CPU_DEVICE_UNARY(name, func, uint8, int64, int64)                 \
     CPU_DEVICE_UNARY(name, tfunc, uint8, bfloat16, bfloat16)          \
-    CPU_DEVICE_NOIMPL(name, hfunc, uint8, float16, float16)           \
+    CPU_DEVICE_UNARY(name, hfunc, uint8, float16, float16)            \
     CPU_DEVICE_UNARY(name, func, uint8, float32, float32)             \
     CPU_DEVICE_UNARY(name, func, uint8, float64, float64)             \
     CPU_DEVICE_NOIMPL(name, func, uint8, complex32, complex32)        \
     CPU_DEVICE_UNARYC(name, func, uint8, complex64, complex64)        \
     CPU_DEVICE_UNARYC(name, func, uint8, complex128, complex128)      \
                                                                       \
-    CPU_DEVICE_UNARY(name, ufunc, uint16, uint16, uint16)             \
+    CPU_DEVICE_UNARY_SAME(name, ufunc, uint16, uint16, uint16)        \
     CPU_DEVICE_UNARY(name, ufunc, uint16, uint32, uint32)             \
     CPU_DEVICE_UNARY(name, ufunc, uint16, uint64, uint64)             \
     CPU_DEVICE_UNARY(name, func, uint16, int32, int32)                \
@@ -130,27 +225,27 @@ gm_cpu_device_0D_##name##_##t0##_##t1(const char *a0, char *a1)
     CPU_DEVICE_UNARYC(name, func, uint16, complex64, complex64)       \
     CPU_DEVICE_UNARYC(name, func, uint16, complex128, complex128)     \
                                                                       \
-    CPU_DEVICE_UNARY(name, ufunc, uint32, uint32, uint32)             \
+    CPU_DEVICE_UNARY_SAME(name, ufunc, uint32, uint32, uint32)        \
     CPU_DEVICE_UNARY(name, ufunc, uint32, uint64, uint64)             \
     CPU_DEVICE_UNARY(name, func, uint32, int64, int64)                \
     CPU_DEVICE_UNARY(name, func, uint32, float64, float64)            \
     CPU_DEVICE_UNARYC(name, func, uint32, complex128, complex128)     \
                                                                       \
-    CPU_DEVICE_UNARY(name, ufunc, uint64, uint64, uint64)             \
+    CPU_DEVICE_UNARY_SAME(name, ufunc, uint64, uint64, uint64)        \
                                                                       \
-    CPU_DEVICE_UNARY(name, func, int8, int8, int8)                    \
+    CPU_DEVICE_UNARY_SAME(name, func, int8, int8, int8)               \
     CPU_DEVICE_UNARY(name, func, int8, int16, int16)                  \
     CPU_DEVICE_UNARY(name, func, int8, int32, int32)                  \
     CPU_DEVICE_UNARY(name, func, int8, int64, int64)                  \
     CPU_DEVICE_UNARY(name, tfunc, int8, bfloat16, bfloat16)           \
-    CPU_DEVICE_NOIMPL(name, hfunc, int8, float16, float16)            \
+    CPU_DEVICE_UNARY(name, hfunc, int8, float16, float16)             \
     CPU_DEVICE_UNARY(name, func, int8, float32, float32)              \
     CPU_DEVICE_UNARY(name, func, int8, float64, float64)              \
     CPU_DEVICE_NOIMPL(name, func, int8, complex32, complex32)         \
     CPU_DEVICE_UNARYC(name, func, int8, complex64, complex64)         \
     CPU_DEVICE_UNARYC(name, func, int8, complex128, complex128)       \
                                                                       \
-    CPU_DEVICE_UNARY(name, func, int16, int16, int16)                 \
+    CPU_DEVICE_UNARY_SAME(name, func, int16, int16, int16)            \
     CPU_DEVICE_UNARY(name, func, int16, int32, int32)                 \
     CPU_DEVICE_UNARY(name, func, int16, int64, int64)                 \
     CPU_DEVICE_UNARY(name, func, int16, float32, float32)             \
@@ -158,32 +253,32 @@ gm_cpu_device_0D_##name##_##t0##_##t1(const char *a0, char *a1)
     CPU_DEVICE_UNARYC(name, func, int16, complex64, complex64)        \
     CPU_DEVICE_UNARYC(name, func, int16, complex128, complex128)      \
                                                                       \
-    CPU_DEVICE_UNARY(name, func, int32, int32, int32)                 \
+    CPU_DEVICE_UNARY_SAME(name, func, int32, int32, int32)            \
     CPU_DEVICE_UNARY(name, func, int32, int64, int64)                 \
     CPU_DEVICE_UNARY(name, func, int32, float64, float64)             \
     CPU_DEVICE_UNARYC(name, func, int32, complex128, complex128)      \
                                                                       \
-    CPU_DEVICE_UNARY(name, func, int64, int64, int64)                 \
+    CPU_DEVICE_UNARY_SAME(name, func, int64, int64, int64)            \
                                                                       \
-    CPU_DEVICE_UNARY(name, tfunc, bfloat16, bfloat16, bfloat16)       \
+    CPU_DEVICE_UNARY_SAME(name, tfunc, bfloat16, bfloat16, bfloat16)  \
     CPU_DEVICE_UNARY(name, func, bfloat16, float32, float32)          \
     CPU_DEVICE_UNARY(name, func, bfloat16, float64, float64)          \
     CPU_DEVICE_UNARYC(name, func, bfloat16, complex64, complex64)     \
     CPU_DEVICE_UNARYC(name, func, bfloat16, complex128, complex128)   \
                                                                       \
-    CPU_DEVICE_NOIMPL(name, hfunc, float16, float16, float16)         \
-    CPU_DEVICE_NOIMPL(name, func, float16, float32, float32)          \
-    CPU_DEVICE_NOIMPL(name, func, float16, float64, float64)          \
+    CPU_DEVICE_UNARY_SAME(name, hfunc, float16, float16, float16)     \
+    CPU_DEVICE_UNARY(name, func, float16, float32, float32)           \
+    CPU_DEVICE_UNARY(name, func, float16, float64, float64)           \
     CPU_DEVICE_NOIMPL(name, func, float16, complex32, complex32)      \
-    CPU_DEVICE_NOIMPL(name, func, float16, complex64, complex64)      \
-    CPU_DEVICE_NOIMPL(name, func, float16, complex128, complex128)    \
+    CPU_DEVICE_UNARYC(name, func, float16, complex64, complex64)      \
+    CPU_DEVICE_UNARYC(name, func, float16, complex128, complex128)    \
                                                                       \
-    CPU_DEVICE_UNARY(name, func, float32, float32, float32)           \
+    CPU_DEVICE_UNARY_SAME(name, func, float32, float32, float32)      \
     CPU_DEVICE_UNARY(name, func, float32, float64, float64)           \
     CPU_DEVICE_UNARYC(name, func, float32, complex64, complex64)      \
     CPU_DEVICE_UNARYC(name, func, float32, complex128, complex128)    \
                                                                       \
-    CPU_DEVICE_UNARY(name, func, float64, float64, float64)           \
+    CPU_DEVICE_UNARY_SAME(name, func, float64, float64, float64)      \
     CPU_DEVICE_UNARYC(name, func, float64, complex128, complex128)    \
                                                                       \
     CPU_DEVICE_NOIMPL(name, func, complex32, complex32, complex32)    \
@@ -200,6 +295,11 @@ gm_cpu_device_0D_##name##_##t0##_##t1(const char *a0, char *a1)
 /*                                   Copy                                    */
 /*****************************************************************************/
 
+#undef CPU_DEVICE_UNARY_1D_C
+#undef CPU_DEVICE_UNARY_1D_C_SAME
+#define CPU_DEVICE_UNARY_1D_C CPU_DEVICE_UNARY_1D_C_BASE
+#define CPU_DEVICE_UNARY_1D_C_SAME CPU_DEVICE_UNARY_1D_C_ISA
+
 #define copy(x) x
 CPU_DEVICE_ALL_UNARY(copy, copy, copy, copy, copy)
 
@@ -208,7 +308,7 @@ CPU_DEVICE_ALL_UNARY(copy, copy, copy, copy, copy)
 /*                                    Abs                                    */
 /*****************************************************************************/
 
-CPU_DEVICE_ALL_UNARY(abs, std::abs, copy, tf::fabs, std::abs)
+CPU_DEVICE_ALL_UNARY(abs, std::abs, copy, gm::fabs, gm::fabs)
 
 
 /*****************************************************************************/
@@ -216,19 +316,19 @@ CPU_DEVICE_ALL_UNARY(abs, std::abs, copy, tf::fabs, std::abs)
 /*****************************************************************************/
 
 #define invert(x) !x
-CPU_DEVICE_UNARY(invert, invert, bool, bool, bool)
+CPU_DEVICE_UNARY_SAME(invert, invert, bool, bool, bool)
 #undef invert
 
 #define invert(x) ~x
-CPU_DEVICE_UNARY(invert, invert, uint8, uint8, uint8)
-CPU_DEVICE_UNARY(invert, invert, uint16, uint16, uint16)
-CPU_DEVICE_UNARY(invert, invert, uint32, uint32, uint32)
-CPU_DEVICE_UNARY(invert, invert, uint64, uint64, uint64)
+CPU_DEVICE_UNARY_SAME(invert, invert, uint8, uint8, uint8)
+CPU_DEVICE_UNARY_SAME(invert, invert, uint16, uint16, uint16)
+CPU_DEVICE_UNARY_SAME(invert, invert, uint32, uint32, uint32)
+CPU_DEVICE_UNARY_SAME(invert, invert, uint64, uint64, uint64)
 
-CPU_DEVICE_UNARY(invert, invert, int8, int8, int8)
-CPU_DEVICE_UNARY(invert, invert, int16, int16, int16)
-CPU_DEVICE_UNARY(invert, invert, int32, int32, int32)
-CPU_DEVICE_UNARY(invert, invert, int64, int64, int64)
+CPU_DEVICE_UNARY_SAME(invert, invert, int8, int8, int8)
+CPU_DEVICE_UNARY_SAME(invert, invert, int16, int16, int16)
+CPU_DEVICE_UNARY_SAME(invert, invert, int32, int32, int32)
+CPU_DEVICE_UNARY_SAME(invert, invert, int64, int64, int64)
 
 
 /*****************************************************************************/
@@ -240,15 +340,15 @@ CPU_DEVICE_UNARY(negative, negative, uint8, int16, int16)
 CPU_DEVICE_UNARY(negative, negative, uint16, int32, int32)
 CPU_DEVICE_UNARY(negative, negative, uint32, int64, int64)
 
-CPU_DEVICE_UNARY(negative, negative, int8, int8, int8)
-CPU_DEVICE_UNARY(negative, negative, int16, int16, int16)
-CPU_DEVICE_UNARY(negative, negative, int32, int32, int32)
-CPU_DEVICE_UNARY(negative, negative, int64, int64, int64)
+CPU_DEVICE_UNARY_SAME(negative, negative, int8, int8, int8)
+CPU_DEVICE_UNARY_SAME(negative, negative, int16, int16, int16)
+CPU_DEVICE_UNARY_SAME(negative, negative, int32, int32, int32)
+CPU_DEVICE_UNARY_SAME(negative, negative, int64, int64, int64)
 
-CPU_DEVICE_UNARY(negative, negative, bfloat16, bfloat16, bfloat16)
-CPU_DEVICE_NOIMPL(negative, negative, float16, float16, float16)
-CPU_DEVICE_UNARY(negative, negative, float32, float32, float32)
-CPU_DEVICE_UNARY(negative, negative, float64, float64, float64)
+CPU_DEVICE_UNARY_SAME(negative, negative, bfloat16, bfloat16, bfloat16)
+CPU_DEVICE_UNARY_SAME(negative, negative, float16, float16, float16)
+CPU_DEVICE_UNARY_SAME(negative, negative, float32, float32, float32)
+CPU_DEVICE_UNARY_SAME(negative, negative, float64, float64, float64)
 
 CPU_DEVICE_NOIMPL(negative, negative, complex32, complex32, complex32)
 CPU_DEVICE_UNARYC(negative, negative, complex64, complex64, complex64)
@@ -259,14 +359,25 @@ CPU_DEVICE_UNARYC(negative, negative, complex128, complex128, complex128)
 /*                                   Math                                    */
 /*****************************************************************************/
 
+#undef CPU_DEVICE_UNARY_1D_C
+#undef CPU_DEVICE_UNARY_1D_C_SAME
+#define CPU_DEVICE_UNARY_1D_C CPU_DEVICE_UNARY_1D_C_SCALAR
+#define CPU_DEVICE_UNARY_1D_C_SAME CPU_DEVICE_UNARY_1D_C_SCALAR
+
+#define CPU_DEVICE_UNARY_ALL_HALF_MATH(name) \
+    CPU_DEVICE_UNARY(name##f16, gm::name, uint8, float16, float16)      \
+    CPU_DEVICE_UNARY(name##f16, gm::name, int8, float16, float16)       \
+    CPU_DEVICE_UNARY_SAME(name##f16, gm::name, float16, float16, float16)
+
 #define CPU_DEVICE_UNARY_ALL_REAL_MATH(name) \
-    CPU_DEVICE_UNARY(name##f, name##f, uint16, float32, float32)        \
-    CPU_DEVICE_UNARY(name##f, name##f, int16, float32, float32)         \
-    CPU_DEVICE_UNARY(name##b16, tf::name, bfloat16, bfloat16, bfloat16) \
-    CPU_DEVICE_UNARY(name##f, name##f, float32, float32, float32)       \
-    CPU_DEVICE_UNARY(name, name, uint32, float64, float64)              \
-    CPU_DEVICE_UNARY(name, name, int32, float64, float64)               \
-    CPU_DEVICE_UNARY(name, name, float64, float64, float64)
+    CPU_DEVICE_UNARY_ALL_HALF_MATH(name)                                     \
+    CPU_DEVICE_UNARY(name##f, name##f, uint16, float32, float32)             \
+    CPU_DEVICE_UNARY(name##f, name##f, int16, float32, float32)              \
+    CPU_DEVICE_UNARY_SAME(name##b16, gm::name, bfloat16, bfloat16, bfloat16) \
+    CPU_DEVICE_UNARY_SAME(name##f, name##f, float32, float32, float32)       \
+    CPU_DEVICE_UNARY(name, name, uint32, float64, float64)                   \
+    CPU_DEVICE_UNARY(name, name, int32, float64, float64)                    \
+    CPU_DEVICE_UNARY_SAME(name, name, float64, float64, float64)
 
 #define CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(name) \
     CPU_DEVICE_UNARY_ALL_REAL_MATH(name)                              \
@@ -274,44 +385,155 @@ CPU_DEVICE_UNARYC(negative, negative, complex128, complex128, complex128)
     CPU_DEVICE_UNARYC(name, name, complex64, complex64, complex64)    \
     CPU_DEVICE_UNARYC(name, name, complex128, complex128, complex128) \
 
-#define CPU_DEVICE_UNARY_ALL_HALF_MATH(name, hfunc) \
-    CPU_DEVICE_UNARY(name##f16, hfunc, uint8, float16, float16)   \
-    CPU_DEVICE_UNARY(name##f16, hfunc, int8, float16, float16)    \
-    CPU_DEVICE_UNARY(name##f16, hfunc, float16, float16, float16)
+/*
+ * Functions with a vectorized implementation in vmath.h.  Unless strict math
+ * is selected, the float32 and float64 kernels use vmath for arguments in the
+ * fast range of the function and libm for all others.  The contiguous loop
+ * runs in blocks, and blocks that are entirely in the fast range use the
+ * vectorized per-ISA clone.
+ */
+#define VMATH_BLOCKSIZE 256
+
+#define CPU_DEVICE_VMATH_LOOP(name, func, t0, t1, common, isa, target) \
+static target VMATH_LOOP void                                                     \
+vmath_1D_C_##name##_##t0##_##t1##_##isa(const t0##_t *x0, t1##_t *x1,             \
+                                        const int64_t N)                          \
+{                                                                                 \
+    for (int64_t i = 0; i < N; i += VMATH_BLOCKSIZE) {                            \
+        const int64_t n = N-i < VMATH_BLOCKSIZE ? N-i : VMATH_BLOCKSIZE;          \
+        const t0##_t *y0 = x0 + i;                                                \
+        t1##_t *y1 = x1 + i;                                                      \
+        int slow = 0;                                                             \
+                                                                                  \
+        for (int64_t k = 0; k < n; k++) {                                         \
+            slow |= !vmath::func##_f::fast((common##_t)y0[k]);                    \
+        }                                                                         \
+                                                                                  \
+        if (slow) {                                                               \
+            for (int64_t k = 0; k < n; k++) {                                     \
+                y1[k] = vmath::func##_f::call((common##_t)y0[k]);                 \
+            }                                                                     \
+        }                                                                         \
+        else {                                                                    \
+            for (int64_t k = 0; k < n; k++) {                                     \
+                y1[k] = vmath::func##_f::eval((common##_t)y0[k]);                 \
+            }                                                                     \
+        }                                                                         \
+    }                                                                             \
+}
 
-#define CPU_DEVICE_UNARY_ALL_REAL_MATH_WITH_HALF(name, hfunc) \
-    CPU_DEVICE_UNARY_ALL_HALF_MATH(name, hfunc)               \
-    CPU_DEVICE_UNARY_ALL_REAL_MATH(name)
+#ifdef GM_ISA_DISPATCH
+  #define CPU_DEVICE_VMATH_CLONES(name, func, t0, t1, common) \
+    CPU_DEVICE_VMATH_LOOP(name, func, t0, t1, common, base, )                  \
+    CPU_DEVICE_VMATH_LOOP(name, func, t0, t1, common, avx2, GM_TARGET_AVX2)     \
+    CPU_DEVICE_VMATH_LOOP(name, func, t0, t1, common, avx512, GM_TARGET_AVX512)
+#else
+  #define CPU_DEVICE_VMATH_CLONES(name, func, t0, t1, common) \
+    CPU_DEVICE_VMATH_LOOP(name, func, t0, t1, common, base, )
+#endif
 
-#define CPU_DEVICE_UNARY_ALL_COMPLEX_MATH_WITH_HALF(name, hfunc) \
-    CPU_DEVICE_UNARY_ALL_HALF_MATH(name, hfunc)                  \
-    CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(name)
+#define CPU_DEVICE_VMATH(name, func, t0, t1, common) \
+CPU_DEVICE_VMATH_CLONES(name, func, t0, t1, common)                               \
+                                                                                  \
+extern "C" void                                                                   \
+gm_cpu_device_fixed_1D_C_##name##_##t0##_##t1(const char *a0, char *a1,           \
+                                              const int64_t N)                    \
+{                                                                                 \
+    const t0##_t *x0 = (const t0##_t *)a0;                                        \
+    t1##_t *x1 = (t1##_t *)a1;                                                    \
+                                                                                  \
+    if (gm_strict_math) {                                                         \
+        for (int64_t i = 0; i < N; i++) {                                         \
+            x1[i] = vmath::func##_f::libm((common##_t)x0[i]);                     \
+        }                                                                         \
+    }                                                                             \
+    else {                                                                        \
+        GM_ISA_CALL(vmath_1D_C_##name##_##t0##_##t1, (x0, x1, N))                 \
+    }                                                                             \
+}                                                                                 \
+                                                                                  \
+extern "C" VMATH_LOOP void                                                        \
+gm_cpu_device_fixed_1D_S_##name##_##t0##_##t1(const char *a0, char *a1,           \
+                                              const int64_t s0, const int64_t s1, \
+                                              const int64_t N)                    \
+{                                                                                 \
+    const t0##_t *x0 = (const t0##_t *)a0;                                        \
+    t1##_t *x1 = (t1##_t *)a1;                                                    \
+    int64_t i, k0, k1;                                                            \
+                                                                                  \
+    if (gm_strict_math) {                                                         \
+        for (i=0, k0=0, k1=0; i < N; i++, k0+=s0, k1+=s1) {                       \
+            x1[k1] = vmath::func##_f::libm((common##_t)x0[k0]);                   \
+        }                                                                         \
+    }                                                                             \
+    else {                                                                        \
+        for (i=0, k0=0, k1=0; i < N; i++, k0+=s0, k1+=s1) {                       \
+            x1[k1] = vmath::func##_f::call((common##_t)x0[k0]);                   \
+        }                                                                         \
+    }                                                                             \
+}                                                                                 \
+                                                                                  \
+extern "C" VMATH_LOOP void                                                        \
+gm_cpu_device_0D_##name##_##t0##_##t1(const char *a0, char *a1)                   \
+{                                                                                 \
+    const t0##_t x0 = *((const t0##_t *)a0);                                      \
+    t1##_t *x1 = (t1##_t *)a1;                                                    \
+                                                                                  \
+    *x1 = gm_strict_math ? vmath::func##_f::libm((common##_t)x0)                  \
+                         : vmath::func##_f::call((common##_t)x0);                 \
+}
+
+#define CPU_DEVICE_VMATH_ALL_REAL_MATH(name) \
+    CPU_DEVICE_UNARY_ALL_HALF_MATH(name)                                     \
+    CPU_DEVICE_VMATH(name##f, name, uint16, float32, float32)                \
+    CPU_DEVICE_VMATH(name##f, name, int16, float32, float32)                 \
+    CPU_DEVICE_UNARY_SAME(name##b16, gm::name, bfloat16, bfloat16, bfloat16) \
+    CPU_DEVICE_VMATH(name##f, name, float32, float32, float32)               \
+    CPU_DEVICE_VMATH(name, name, uint32, float64, float64)                   \
+    CPU_DEVICE_VMATH(name, name, int32, float64, float64)                    \
+    CPU_DEVICE_VMATH(name, name, float64, float64, float64)
+
+#define CPU_DEVICE_VMATH_ALL_COMPLEX_MATH(name) \
+    CPU_DEVICE_VMATH_ALL_REAL_MATH(name)                              \
+    CPU_DEVICE_NOIMPL(name, name, complex32, complex32, complex32)    \
+    CPU_DEVICE_UNARYC(name, name, complex64, complex64, complex64)    \
+    CPU_DEVICE_UNARYC(name, name, complex128, complex128, complex128)
 
 
 /*****************************************************************************/
 /*                                Abs functions                              */
 /*****************************************************************************/
 
+#undef CPU_DEVICE_UNARY_1D_C
+#undef CPU_DEVICE_UNARY_1D_C_SAME
+#define CPU_DEVICE_UNARY_1D_C CPU_DEVICE_UNARY_1D_C_BASE
+#define CPU_DEVICE_UNARY_1D_C_SAME CPU_DEVICE_UNARY_1D_C_ISA
+
 CPU_DEVICE_UNARY_ALL_REAL_MATH(fabs)
 
+#undef CPU_DEVICE_UNARY_1D_C
+#undef CPU_DEVICE_UNARY_1D_C_SAME
+#define CPU_DEVICE_UNARY_1D_C CPU_DEVICE_UNARY_1D_C_SCALAR
+#define CPU_DEVICE_UNARY_1D_C_SAME CPU_DEVICE_UNARY_1D_C_SCALAR
+
 
 /*****************************************************************************/
 /*                             Exponential functions                         */
 /*****************************************************************************/
 
-CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(exp)
-CPU_DEVICE_UNARY_ALL_REAL_MATH(exp2)
-CPU_DEVICE_UNARY_ALL_REAL_MATH(expm1)
+CPU_DEVICE_VMATH_ALL_COMPLEX_MATH(exp)
+CPU_DEVICE_VMATH_ALL_REAL_MATH(exp2)
+CPU_DEVICE_VMATH_ALL_REAL_MATH(expm1)
 
 
 /*****************************************************************************/
 /*                              Logarithm functions                          */
 /*****************************************************************************/
 
-CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(log)
-CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(log10)
-CPU_DEVICE_UNARY_ALL_REAL_MATH(log2)
-CPU_DEVICE_UNARY_ALL_REAL_MATH(log1p)
+CPU_DEVICE_VMATH_ALL_COMPLEX_MATH(log)
+CPU_DEVICE_VMATH_ALL_COMPLEX_MATH(log10)
+CPU_DEVICE_VMATH_ALL_REAL_MATH(log2)
+CPU_DEVICE_VMATH_ALL_REAL_MATH(log1p)
 CPU_DEVICE_UNARY_ALL_REAL_MATH(logb)
 
 
@@ -319,7 +541,7 @@ CPU_DEVICE_UNARY_ALL_REAL_MATH(logb)
 /*                              Power functions                              */
 /*****************************************************************************/
 
-CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(sqrt)
+CPU_DEVICE_VMATH_ALL_COMPLEX_MATH(sqrt)
 CPU_DEVICE_UNARY_ALL_REAL_MATH(cbrt)
 
 
@@ -327,8 +549,8 @@ CPU_DEVICE_UNARY_ALL_REAL_MATH(cbrt)
 /*                           Trigonometric functions                         */
 /*****************************************************************************/
 
-CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(sin)
-CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(cos)
+CPU_DEVICE_VMATH_ALL_COMPLEX_MATH(sin)
+CPU_DEVICE_VMATH_ALL_COMPLEX_MATH(cos)
 CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(tan)
 CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(asin)
 CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(acos)
@@ -341,7 +563,7 @@ CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(atan)
 
 CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(sinh)
 CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(cosh)
-CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(tanh)
+CPU_DEVICE_VMATH_ALL_COMPLEX_MATH(tanh)
 CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(asinh)
 CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(acosh)
 CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(atanh)
@@ -351,7 +573,7 @@ CPU_DEVICE_UNARY_ALL_COMPLEX_MATH(atanh)
 /*                            Error and gamma functions                      */
 /*****************************************************************************/
 
-CPU_DEVICE_UNARY_ALL_REAL_MATH(erf)
+CPU_DEVICE_VMATH_ALL_REAL_MATH(erf)
 CPU_DEVICE_UNARY_ALL_REAL_MATH(erfc)
 CPU_DEVICE_UNARY_ALL_REAL_MATH(lgamma)
 CPU_DEVICE_UNARY_ALL_REAL_MATH(tgamma)
@@ -361,8 +583,327 @@ CPU_DEVICE_UNARY_ALL_REAL_MATH(tgamma)
 /*                              Ceiling, floor, trunc                        */
 /*****************************************************************************/
 
+#undef CPU_DEVICE_UNARY_1D_C
+#undef CPU_DEVICE_UNARY_1D_C_SAME
+#define CPU_DEVICE_UNARY_1D_C CPU_DEVICE_UNARY_1D_C_BASE
+#define CPU_DEVICE_UNARY_1D_C_SAME CPU_DEVICE_UNARY_1D_C_ISA
+
 CPU_DEVICE_UNARY_ALL_REAL_MATH(ceil)
 CPU_DEVICE_UNARY_ALL_REAL_MATH(floor)
 CPU_DEVICE_UNARY_ALL_REAL_MATH(trunc)
 CPU_DEVICE_UNARY_ALL_REAL_MATH(round)
 CPU_DEVICE_UNARY_ALL_REAL_MATH(nearbyint)
+
+#undef CPU_DEVICE_UNARY_1D_C
+#undef CPU_DEVICE_UNARY_1D_C_SAME
+#define CPU_DEVICE_UNARY_1D_C CPU_DEVICE_UNARY_1D_C_SCALAR
+#define CPU_DEVICE_UNARY_1D_C_SAME CPU_DEVICE_UNARY_1D_C_SCALAR
+
+
+/*****************************************************************************/
+/*                                 Reductions                                */
+/*****************************************************************************/
+
+/*
+ * The inner loops keep REDUCE_LANES independent accumulators.  This breaks
+ * the dependency chain of the naive loop and allows the compiler to keep the
+ * lanes in vector registers.  Floating point sums use pairwise summation with
+ * a base case of PAIRWISE_BLOCKSIZE elements, which bounds the rounding error
+ * by O(log N) instead of O(N).
+ */
+#define REDUCE_LANES 8
+#define PAIRWISE_BLOCKSIZE 128
+
+struct contiguous {
+    int64_t operator()(const int64_t i) const { return i; }
+};
+
+struct strided {
+    const int64_t s;
+    explicit strided(const int64_t s) : s(s) {}
+    int64_t operator()(const int64_t i) const { return i * s; }
+};
+
+template <class A>
+static inline bool
+is_nan(const A)
+{
+    return false;
+}
+
+static inline bool
+is_nan(const float x)
+{
+    return std::isnan(x);
+}
+
+static inline bool
+is_nan(const double x)
+{
+    return std::isnan(x);
+}
+
+struct add_op {
+    template <class A> A operator()(const A a, const A b) const { return a + b; }
+};
+
+struct multiply_op {
+    template <class A> A operator()(const A a, const A b) const { return a * b; }
+};
+
+/* NaN propagates: once the accumulator is NaN it stays NaN. */
+struct min_op {
+    template <class A> A operator()(const A a, const A b) const
+    {
+        return (b < a || is_nan(b)) ? b : a;
+    }
+};
+
+struct max_op {
+    template <class A> A operator()(const A a, const A b) const
+    {
+        return (b > a || is_nan(b)) ? b : a;
+    }
+};
+
+template <class A, class T, class I, class Op>
+static inline A
+reduce_lanes(const T *x, const I idx, const int64_t N, const A init, const Op op)
+{
+    const int64_t M = N - N % REDUCE_LANES;
+    A r[REDUCE_LANES];
+    int64_t i = 0;
+
+    for (int j = 0; j < REDUCE_LANES; j++) {
+        r[j] = init;
+    }
+
+    for (; i < M; i += REDUCE_LANES) {
+        for (int j = 0; j < REDUCE_LANES; j++) {
+            r[j] = op(r[j], (A)x[idx(i+j)]);
+        }
+    }
+
+    A res = op(op(op(r[0], r[1]), op(r[2], r[3])),
+               op(op(r[4], r[5]), op(r[6], r[7])));
+
+    for (; i < N; i++) {
+        res = op(res, (A)x[idx(i)]);
+    }
+
+    return res;
+}
+
+template <class A, class T, class I>
+static inline A
+reduce_sum(const T *x, const I idx, const int64_t N)
+{
+    return reduce_lanes(x, idx, N, A(0), add_op());
+}
+
+/*
+ * Pairwise summation over blocks of PAIRWISE_BLOCKSIZE.  The partial sums
+ * are merged like a binary counter, so the recursion tree is kept on a small
+ * stack and the function inlines into the per-ISA kernels.
+ */
+template <class A, class T, class I>
+static inline A
+pairwise_sum(const T *x, const I idx, const int64_t N)
+{
+    const int64_t nblocks = N / PAIRWISE_BLOCKSIZE;
+    A stack[64];
+    int k = 0;
+
+    for (int64_t n = 0; n < nblocks; n++) {
+        A s = reduce_sum<A>(x + idx(n * PAIRWISE_BLOCKSIZE), idx, PAIRWISE_BLOCKSIZE);
+        for (int64_t c = n; c & 1; c >>= 1) {
+            s = stack[--k] + s;
+        }
+        stack[k++] = s;
+    }
+
+    const int64_t i = nblocks * PAIRWISE_BLOCKSIZE;
+    A res = reduce_sum<A>(x + idx(i), idx, N-i);
+    while (k > 0) {
+        res = stack[--k] + res;
+    }
+
+    return res;
+}
+
+template <class A, class T, class I>
+static inline A
+reduce_prod(const T *x, const I idx, const int64_t N)
+{
+    return reduce_lanes(x, idx, N, A(1), multiply_op());
+}
+
+/* The caller guarantees N > 0 for reductions without an identity element. */
+template <class A, class T, class I>
+static inline A
+reduce_min(const T *x, const I idx, const int64_t N)
+{
+    return reduce_lanes(x, idx, N, (A)x[0], min_op());
+}
+
+template <class A, class T, class I>
+static inline A
+reduce_max(const T *x, const I idx, const int64_t N)
+{
+    return reduce_lanes(x, idx, N, (A)x[0], max_op());
+}
+
+/* Index of the first occurrence of m (or of the first NaN if m is NaN). */
+template <class A, class T, class I>
+static inline int64_t
+find_first(const T *x, const I idx, const int64_t N, const A m)
+{
+    const bool nan = is_nan(m);
+
+    for (int64_t i = 0; i < N; i++) {
+        const A v = (A)x[idx(i)];
+        if (nan ? is_nan(v) : v == m) {
+            return i;
+        }
+    }
+
+    return 0;
+}
+
+template <class A, class T, class I>
+static inline int64_t
+reduce_argmin(const T *x, const I idx, const int64_t N)
+{
+    return find_first(x, idx, N, reduce_min<A>(x, idx, N));
+}
+
+template <class A, class T, class I>
+static inline int64_t
+reduce_argmax(const T *x, const I idx, const int64_t N)
+{
+    return find_first(x, idx, N, reduce_max<A>(x, idx, N));
+}
+
+template <class A, class T, class I>
+static inline A
+reduce_mean(const T *x, const I idx, const int64_t N)
+{
+    return pairwise_sum<A>(x, idx, N) / (A)N;
+}
+
+
+#define CPU_DEVICE_REDUCE_LOOP(name, func, t0, t1, acc, isa, target) \
+static target void                                                                \
+reduce_1D_C_##name##_##t0##_##t1##_##isa(const t0##_t *x0, t1##_t *x1,            \
+                                         const int64_t N)                         \
+{                                                                                 \
+    *x1 = (t1##_t)func<acc##_t>(x0, contiguous(), N);                             \
+}
+
+#ifdef GM_ISA_DISPATCH
+  #define CPU_DEVICE_REDUCE_CLONES(name, func, t0, t1, acc) \
+    CPU_DEVICE_REDUCE_LOOP(name, func, t0, t1, acc, base, )                  \
+    CPU_DEVICE_REDUCE_LOOP(name, func, t0, t1, acc, avx2, GM_TARGET_AVX2)     \
+    CPU_DEVICE_REDUCE_LOOP(name, func, t0, t1, acc, avx512, GM_TARGET_AVX512)
+#else
+  #define CPU_DEVICE_REDUCE_CLONES(name, func, t0, t1, acc) \
+    CPU_DEVICE_REDUCE_LOOP(name, func, t0, t1, acc, base, )
+#endif
+
+/* Contiguous reductions are dispatched on the instruction set, see isa.h. */
+#define CPU_DEVICE_REDUCE(name, func, t0, t1, acc) \
+CPU_DEVICE_REDUCE_CLONES(name, func, t0, t1, acc)                                 \
+                                                                                  \
+extern "C" void                                                                   \
+gm_cpu_device_1D_C_reduce_##name##_##t0##_##t1(const char *a0, char *a1,          \
+                                               const int64_t N)                   \
+{                                                                                 \
+    const t0##_t *x0 = (const t0##_t *)a0;                                        \
+    t1##_t *x1 = (t1##_t *)a1;                                                    \
+                                                                                  \
+    GM_ISA_CALL(reduce_1D_C_##name##_##t0##_##t1, (x0, x1, N))                    \
+}                                                                                 \
+                                                                                  \
+extern "C" void                                                                   \
+gm_cpu_device_1D_S_reduce_##name##_##t0##_##t1(const char *a0, char *a1,          \
+                                               const int64_t s0, const int64_t N) \
+{                                                                                 \
+    const t0##_t *x0 = (const t0##_t *)a0;                                        \
+    t1##_t *x1 = (t1##_t *)a1;                                                    \
+                                                                                  \
+    *x1 = (t1##_t)func<acc##_t>(x0, strided(s0), N);                              \
+}
+
+/* Integer sums and products wrap around like the binary kernels. */
+#define CPU_DEVICE_REDUCE_ALL_SUM(name, ifunc, ffunc) \
+    CPU_DEVICE_REDUCE(name, ifunc, uint8, uint64, uint64)              \
+    CPU_DEVICE_REDUCE(name, ifunc, uint8, uint8, uint64)               \
+    CPU_DEVICE_REDUCE(name, ifunc, uint16, uint64, uint64)             \
+    CPU_DEVICE_REDUCE(name, ifunc, uint16, uint16, uint64)             \
+    CPU_DEVICE_REDUCE(name, ifunc, uint32, uint64, uint64)             \
+    CPU_DEVICE_REDUCE(name, ifunc, uint32, uint32, uint64)             \
+    CPU_DEVICE_REDUCE(name, ifunc, uint64, uint64, uint64)             \
+    CPU_DEVICE_REDUCE(name, ifunc, int8, int64, uint64)                \
+    CPU_DEVICE_REDUCE(name, ifunc, int8, int8, uint64)                 \
+    CPU_DEVICE_REDUCE(name, ifunc, int16, int64, uint64)               \
+    CPU_DEVICE_REDUCE(name, ifunc, int16, int16, uint64)               \
+    CPU_DEVICE_REDUCE(name, ifunc, int32, int64, uint64)               \
+    CPU_DEVICE_REDUCE(name, ifunc, int32, int32, uint64)               \
+    CPU_DEVICE_REDUCE(name, ifunc, int64, int64, uint64)               \
+    CPU_DEVICE_REDUCE(name, ffunc, bfloat16, float64, float64)         \
+    CPU_DEVICE_REDUCE(name, ffunc, bfloat16, bfloat16, float32)        \
+    CPU_DEVICE_REDUCE(name, ffunc, float32, float64, float64)          \
+    CPU_DEVICE_REDUCE(name, ffunc, float32, float32, float32)          \
+    CPU_DEVICE_REDUCE(name, ffunc, float64, float64, float64)          \
+    CPU_DEVICE_REDUCE(name, ffunc, complex64, complex128, complex128)  \
+    CPU_DEVICE_REDUCE(name, ffunc, complex64, complex64, complex64)    \
+    CPU_DEVICE_REDUCE(name, ffunc, complex128, complex128, complex128)
+
+#define CPU_DEVICE_REDUCE_ALL_MINMAX(name, func) \
+    CPU_DEVICE_REDUCE(name, func, uint8, uint8, uint8)           \
+    CPU_DEVICE_REDUCE(name, func, uint16, uint16, uint16)        \
+    CPU_DEVICE_REDUCE(name, func, uint32, uint32, uint32)        \
+    CPU_DEVICE_REDUCE(name, func, uint64, uint64, uint64)        \
+    CPU_DEVICE_REDUCE(name, func, int8, int8, int8)              \
+    CPU_DEVICE_REDUCE(name, func, int16, int16, int16)           \
+    CPU_DEVICE_REDUCE(name, func, int32, int32, int32)           \
+    CPU_DEVICE_REDUCE(name, func, int64, int64, int64)           \
+    CPU_DEVICE_REDUCE(name, func, bfloat16, bfloat16, float32)   \
+    CPU_DEVICE_REDUCE(name, func, float32, float32, float32)     \
+    CPU_DEVICE_REDUCE(name, func, float64, float64, float64)
+
+#define CPU_DEVICE_REDUCE_ALL_ARG(name, func) \
+    CPU_DEVICE_REDUCE(name, func, uint8, int64, uint8)         \
+    CPU_DEVICE_REDUCE(name, func, uint16, int64, uint16)       \
+    CPU_DEVICE_REDUCE(name, func, uint32, int64, uint32)       \
+    CPU_DEVICE_REDUCE(name, func, uint64, int64, uint64)       \
+    CPU_DEVICE_REDUCE(name, func, int8, int64, int8)           \
+    CPU_DEVICE_REDUCE(name, func, int16, int64, int16)         \
+    CPU_DEVICE_REDUCE(name, func, int32, int64, int32)         \
+    CPU_DEVICE_REDUCE(name, func, int64, int64, int64)         \
+    CPU_DEVICE_REDUCE(name, func, bfloat16, int64, float32)    \
+    CPU_DEVICE_REDUCE(name, func, float32, int64, float32)     \
+    CPU_DEVICE_REDUCE(name, func, float64, int64, float64)
+
+#define CPU_DEVICE_REDUCE_ALL_MEAN(name, func) \
+    CPU_DEVICE_REDUCE(name, func, uint8, float64, float64)            \
+    CPU_DEVICE_REDUCE(name, func, uint16, float64, float64)           \
+    CPU_DEVICE_REDUCE(name, func, uint32, float64, float64)           \
+    CPU_DEVICE_REDUCE(name, func, uint64, float64, float64)           \
+    CPU_DEVICE_REDUCE(name, func, int8, float64, float64)             \
+    CPU_DEVICE_REDUCE(name, func, int16, float64, float64)            \
+    CPU_DEVICE_REDUCE(name, func, int32, float64, float64)            \
+    CPU_DEVICE_REDUCE(name, func, int64, float64, float64)            \
+    CPU_DEVICE_REDUCE(name, func, bfloat16, bfloat16, float32)        \
+    CPU_DEVICE_REDUCE(name, func, float32, float32, float32)          \
+    CPU_DEVICE_REDUCE(name, func, float64, float64, float64)          \
+    CPU_DEVICE_REDUCE(name, func, complex64, complex64, complex64)    \
+    CPU_DEVICE_REDUCE(name, func, complex128, complex128, complex128)
+
+CPU_DEVICE_REDUCE_ALL_SUM(add, reduce_sum, pairwise_sum)
+CPU_DEVICE_REDUCE_ALL_SUM(multiply, reduce_prod, reduce_prod)
+CPU_DEVICE_REDUCE_ALL_MINMAX(min, reduce_min)
+CPU_DEVICE_REDUCE_ALL_MINMAX(max, reduce_max)
+CPU_DEVICE_REDUCE_ALL_ARG(argmin, reduce_argmin)
+CPU_DEVICE_REDUCE_ALL_ARG(argmax, reduce_argmax)
+CPU_DEVICE_REDUCE_ALL_MEAN(mean, reduce_mean)
@@ -39,7 +39,9 @@
 #include <cinttypes>
 #include <complex>
 #include "contrib/bfloat16.h"
+#include "float16.h"
 typedef tf::bfloat16 bfloat16_t;
+typedef gm::float16 float16_t;
 typedef std::complex<float> complex64_t;
 typedef std::complex<double> complex128_t;
 #else
@@ -76,6 +78,20 @@ typedef double float64_t;
 
 #define CPU_DEVICE_UNARY_NOIMPL_DECL(name, t0, t1)
 
+#ifdef __cplusplus
+  #define CPU_DEVICE_REDUCE_DECL(name, t0, t1) \
+  extern "C" void gm_cpu_device_1D_C_reduce_##name##_##t0##_##t1(const char *a0, char *a1,          \
+                                                                 const int64_t N);                  \
+  extern "C" void gm_cpu_device_1D_S_reduce_##name##_##t0##_##t1(const char *a0, char *a1,          \
+                                                                 const int64_t s0, const int64_t N);
+#else
+  #define CPU_DEVICE_REDUCE_DECL(name, t0, t1) \
+  void gm_cpu_device_1D_C_reduce_##name##_##t0##_##t1(const char *a0, char *a1,          \
+                                                      const int64_t N);                  \
+  void gm_cpu_device_1D_S_reduce_##name##_##t0##_##t1(const char *a0, char *a1,          \
+                                                      const int64_t s0, const int64_t N);
+#endif
+
 
 /*****************************************************************************/
 /*                                   Copy                                    */
@@ -92,7 +108,7 @@ typedef double float64_t;
     CPU_DEVICE_UNARY_DECL(name, bool, int32)                  \
     CPU_DEVICE_UNARY_DECL(name, bool, int64)                  \
     CPU_DEVICE_UNARY_DECL(name, bool, bfloat16)               \
-    CPU_DEVICE_UNARY_NOIMPL_DECL(name, bool, float16)         \
+    CPU_DEVICE_UNARY_DECL(name, bool, float16)                \
     CPU_DEVICE_UNARY_DECL(name, bool, float32)                \
     CPU_DEVICE_UNARY_DECL(name, bool, float64)                \
     CPU_DEVICE_UNARY_NOIMPL_DECL(name, bool, complex32)       \
@@ -106,7 +122,7 @@ typedef double float64_t;
     CPU_DEVICE_UNARY_DECL(name, uint8, int32)                 \
     CPU_DEVICE_UNARY_DECL(name, uint8, int64)                 \
     CPU_DEVICE_UNARY_DECL(name, uint8, bfloat16)              \
-    CPU_DEVICE_UNARY_NOIMPL_DECL(name, uint8, float16)        \
+    CPU_DEVICE_UNARY_DECL(name, uint8, float16)               \
     CPU_DEVICE_UNARY_DECL(name, uint8, float32)               \
     CPU_DEVICE_UNARY_DECL(name, uint8, float64)               \
     CPU_DEVICE_UNARY_NOIMPL_DECL(name, uint8, complex32)      \
@@ -132,7 +148,7 @@ typedef double float64_t;
     CPU_DEVICE_UNARY_DECL(name, int8, int32)                  \
     CPU_DEVICE_UNARY_DECL(name, int8, int64)                  \
     CPU_DEVICE_UNARY_DECL(name, int8, bfloat16)               \
-    CPU_DEVICE_UNARY_NOIMPL_DECL(name, int8, float16)         \
+    CPU_DEVICE_UNARY_DECL(name, int8, float16)                \
     CPU_DEVICE_UNARY_DECL(name, int8, float32)                \
     CPU_DEVICE_UNARY_DECL(name, int8, float64)                \
     CPU_DEVICE_UNARY_NOIMPL_DECL(name, int8, complex32)       \
@@ -155,12 +171,12 @@ typedef double float64_t;
     CPU_DEVICE_UNARY_DECL(name, bfloat16, float64)            \
     CPU_DEVICE_UNARY_DECL(name, bfloat16, complex64)          \
     CPU_DEVICE_UNARY_DECL(name, bfloat16, complex128)         \
-    CPU_DEVICE_UNARY_NOIMPL_DECL(name, float16, float16)      \
-    CPU_DEVICE_UNARY_NOIMPL_DECL(name, float16, float32)      \
-    CPU_DEVICE_UNARY_NOIMPL_DECL(name, float16, float64)      \
+    CPU_DEVICE_UNARY_DECL(name, float16, float16)             \
+    CPU_DEVICE_UNARY_DECL(name, float16, float32)             \
+    CPU_DEVICE_UNARY_DECL(name, float16, float64)             \
     CPU_DEVICE_UNARY_NOIMPL_DECL(name, float16, complex32)    \
-    CPU_DEVICE_UNARY_NOIMPL_DECL(name, float16, complex64)    \
-    CPU_DEVICE_UNARY_NOIMPL_DECL(name, float16, complex128)   \
+    CPU_DEVICE_UNARY_DECL(name, float16, complex64)           \
+    CPU_DEVICE_UNARY_DECL(name, float16, complex128)          \
     CPU_DEVICE_UNARY_DECL(name, float32, float32)             \
     CPU_DEVICE_UNARY_DECL(name, float32, float64)             \
     CPU_DEVICE_UNARY_DECL(name, float32, complex64)           \
@@ -210,7 +226,7 @@ CPU_DEVICE_UNARY_DECL(negative, int32, int32)
 CPU_DEVICE_UNARY_DECL(negative, int64, int64)
 
 CPU_DEVICE_UNARY_DECL(negative, bfloat16, bfloat16)
-CPU_DEVICE_UNARY_NOIMPL_DECL(negative, float16, float16)
+CPU_DEVICE_UNARY_DECL(negative, float16, float16)
 CPU_DEVICE_UNARY_DECL(negative, float32, float32)
 CPU_DEVICE_UNARY_DECL(negative, float64, float64)
 
@@ -223,7 +239,13 @@ CPU_DEVICE_UNARY_DECL(negative, complex128, complex128)
 /*                                    Math                                   */
 /*****************************************************************************/
 
+#define CPU_DEVICE_UNARY_ALL_HALF_MATH_DECL(name) \
+    CPU_DEVICE_UNARY_DECL(name##f16, uint8, float16)   \
+    CPU_DEVICE_UNARY_DECL(name##f16, int8, float16)    \
+    CPU_DEVICE_UNARY_DECL(name##f16, float16, float16)
+
 #define CPU_DEVICE_UNARY_ALL_REAL_MATH_DECL(name) \
+    CPU_DEVICE_UNARY_ALL_HALF_MATH_DECL(name)            \
     CPU_DEVICE_UNARY_DECL(name##f, uint16, float32)      \
     CPU_DEVICE_UNARY_DECL(name##f, int16, float32)       \
     CPU_DEVICE_UNARY_DECL(name##b16, bfloat16, bfloat16) \
@@ -238,19 +260,6 @@ CPU_DEVICE_UNARY_DECL(negative, complex128, complex128)
     CPU_DEVICE_UNARY_DECL(name, complex64, complex64)   \
     CPU_DEVICE_UNARY_DECL(name, complex128, complex128)
 
-#define CPU_DEVICE_UNARY_ALL_HALF_MATH_DECL(name) \
-    CPU_DEVICE_UNARY_DECL(name##f16, uint8, float16)   \
-    CPU_DEVICE_UNARY_DECL(name##f16, int8, float16)    \
-    CPU_DEVICE_UNARY_DECL(name##f16, float16, float16)
-
-#define CPU_DEVICE_UNARY_ALL_REAL_MATH_WITH_HALF_DECL(name) \
-    CPU_DEVICE_UNARY_ALL_HALF_MATH_DECL(name)               \
-    CPU_DEVICE_UNARY_ALL_REAL_MATH_DECL(name)               \
-
-#define CPU_DEVICE_UNARY_ALL_COMPLEX_MATH_WITH_HALF_DECL(name) \
-    CPU_DEVICE_UNARY_ALL_HALF_MATH_DECL(name)                  \
-    CPU_DEVICE_UNARY_ALL_COMPLEX_MATH_DECL(name)               \
-
 
 /*****************************************************************************/
 /*                                Abs functions                              */
@@ -332,4 +341,82 @@ CPU_DEVICE_UNARY_ALL_REAL_MATH_DECL(round)
 CPU_DEVICE_UNARY_ALL_REAL_MATH_DECL(nearbyint)
 
 
+/*****************************************************************************/
+/*                                 Reductions                                */
+/*****************************************************************************/
+
+#define CPU_DEVICE_REDUCE_ALL_SUM_DECL(name) \
+    CPU_DEVICE_REDUCE_DECL(name, uint8, uint64)         \
+    CPU_DEVICE_REDUCE_DECL(name, uint8, uint8)          \
+    CPU_DEVICE_REDUCE_DECL(name, uint16, uint64)        \
+    CPU_DEVICE_REDUCE_DECL(name, uint16, uint16)        \
+    CPU_DEVICE_REDUCE_DECL(name, uint32, uint64)        \
+    CPU_DEVICE_REDUCE_DECL(name, uint32, uint32)        \
+    CPU_DEVICE_REDUCE_DECL(name, uint64, uint64)        \
+    CPU_DEVICE_REDUCE_DECL(name, int8, int64)           \
+    CPU_DEVICE_REDUCE_DECL(name, int8, int8)            \
+    CPU_DEVICE_REDUCE_DECL(name, int16, int64)          \
+    CPU_DEVICE_REDUCE_DECL(name, int16, int16)          \
+    CPU_DEVICE_REDUCE_DECL(name, int32, int64)          \
+    CPU_DEVICE_REDUCE_DECL(name, int32, int32)          \
+    CPU_DEVICE_REDUCE_DECL(name, int64, int64)          \
+    CPU_DEVICE_REDUCE_DECL(name, bfloat16, float64)     \
+    CPU_DEVICE_REDUCE_DECL(name, bfloat16, bfloat16)    \
+    CPU_DEVICE_REDUCE_DECL(name, float32, float64)      \
+    CPU_DEVICE_REDUCE_DECL(name, float32, float32)      \
+    CPU_DEVICE_REDUCE_DECL(name, float64, float64)      \
+    CPU_DEVICE_REDUCE_DECL(name, complex64, complex128) \
+    CPU_DEVICE_REDUCE_DECL(name, complex64, complex64)  \
+    CPU_DEVICE_REDUCE_DECL(name, complex128, complex128)
+
+#define CPU_DEVICE_REDUCE_ALL_MINMAX_DECL(name) \
+    CPU_DEVICE_REDUCE_DECL(name, uint8, uint8)       \
+    CPU_DEVICE_REDUCE_DECL(name, uint16, uint16)     \
+    CPU_DEVICE_REDUCE_DECL(name, uint32, uint32)     \
+    CPU_DEVICE_REDUCE_DECL(name, uint64, uint64)     \
+    CPU_DEVICE_REDUCE_DECL(name, int8, int8)         \
+    CPU_DEVICE_REDUCE_DECL(name, int16, int16)       \
+    CPU_DEVICE_REDUCE_DECL(name, int32, int32)       \
+    CPU_DEVICE_REDUCE_DECL(name, int64, int64)       \
+    CPU_DEVICE_REDUCE_DECL(name, bfloat16, bfloat16) \
+    CPU_DEVICE_REDUCE_DECL(name, float32, float32)   \
+    CPU_DEVICE_REDUCE_DECL(name, float64, float64)
+
+#define CPU_DEVICE_REDUCE_ALL_ARG_DECL(name) \
+    CPU_DEVICE_REDUCE_DECL(name, uint8, int64)    \
+    CPU_DEVICE_REDUCE_DECL(name, uint16, int64)   \
+    CPU_DEVICE_REDUCE_DECL(name, uint32, int64)   \
+    CPU_DEVICE_REDUCE_DECL(name, uint64, int64)   \
+    CPU_DEVICE_REDUCE_DECL(name, int8, int64)     \
+    CPU_DEVICE_REDUCE_DECL(name, int16, int64)    \
+    CPU_DEVICE_REDUCE_DECL(name, int32, int64)    \
+    CPU_DEVICE_REDUCE_DECL(name, int64, int64)    \
+    CPU_DEVICE_REDUCE_DECL(name, bfloat16, int64) \
+    CPU_DEVICE_REDUCE_DECL(name, float32, int64)  \
+    CPU_DEVICE_REDUCE_DECL(name, float64, int64)
+
+#define CPU_DEVICE_REDUCE_ALL_MEAN_DECL(name) \
+    CPU_DEVICE_REDUCE_DECL(name, uint8, float64)        \
+    CPU_DEVICE_REDUCE_DECL(name, uint16, float64)       \
+    CPU_DEVICE_REDUCE_DECL(name, uint32, float64)       \
+    CPU_DEVICE_REDUCE_DECL(name, uint64, float64)       \
+    CPU_DEVICE_REDUCE_DECL(name, int8, float64)         \
+    CPU_DEVICE_REDUCE_DECL(name, int16, float64)        \
+    CPU_DEVICE_REDUCE_DECL(name, int32, float64)        \
+    CPU_DEVICE_REDUCE_DECL(name, int64, float64)        \
+    CPU_DEVICE_REDUCE_DECL(name, bfloat16, bfloat16)    \
+    CPU_DEVICE_REDUCE_DECL(name, float32, float32)      \
+    CPU_DEVICE_REDUCE_DECL(name, float64, float64)      \
+    CPU_DEVICE_REDUCE_DECL(name, complex64, complex64)  \
+    CPU_DEVICE_REDUCE_DECL(name, complex128, complex128)
+
+CPU_DEVICE_REDUCE_ALL_SUM_DECL(add)
+CPU_DEVICE_REDUCE_ALL_SUM_DECL(multiply)
+CPU_DEVICE_REDUCE_ALL_MINMAX_DECL(min)
+CPU_DEVICE_REDUCE_ALL_MINMAX_DECL(max)
+CPU_DEVICE_REDUCE_ALL_ARG_DECL(argmin)
+CPU_DEVICE_REDUCE_ALL_ARG_DECL(argmax)
+CPU_DEVICE_REDUCE_ALL_MEAN_DECL(mean)
+
+
 #endif /* CPU_DEVICE_UNARY_H */
@@ -599,6 +599,7 @@ CPU_CHECK_POWER_EXP_SUCCESS(uint32)
 CPU_CHECK_POWER_EXP_SUCCESS(uint64)
 
 CPU_CHECK_POWER_EXP_SUCCESS(bfloat16)
+CPU_CHECK_POWER_EXP_SUCCESS(float16)
 CPU_CHECK_POWER_EXP_SUCCESS(float32)
 CPU_CHECK_POWER_EXP_SUCCESS(float64)
 
@@ -665,6 +666,41 @@ gm_cpu_host_fixed_1D_S_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t
 }                                                                                      \
                                                                                        \
 static int                                                                             \
+gm_cpu_host_fixed_1D_Z_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)  \
+{                                                                                      \
+    const char *a0 = apply_index(&stack[0]);                                           \
+    const char *a1 = apply_index(&stack[1]);                                           \
+    char *a2 = apply_index(&stack[2]);                                                 \
+    const int64_t N = xnd_fixed_shape(&stack[0]);                                      \
+    const int64_t s0 = xnd_fixed_step(&stack[0]);                                      \
+    const int64_t s1 = xnd_fixed_step(&stack[1]);                                      \
+    const int64_t s2 = xnd_fixed_step(&stack[2]);                                      \
+    (void)ctx;                                                                         \
+                                                                                       \
+    if (strcmp(STRINGIZE(name), "power") == 0) {                                       \
+        if (check_power_exp_##t1(a1, ctx) < 0) {                                       \
+            return -1;                                                                 \
+        }                                                                              \
+    }                                                                                  \
+                                                                                       \
+    if (N > 1 && s2 == 1 && (s0 == 0) != (s1 == 0)) {                                  \
+        gm_cpu_device_fixed_1D_Z_##name##_##t0##_##t1##_##t2(a0, a1, a2, s0, s1, N);   \
+    }                                                                                  \
+    else {                                                                             \
+        gm_cpu_device_fixed_1D_S_##name##_##t0##_##t1##_##t2(a0, a1, a2, s0, s1, s2, N);\
+    }                                                                                  \
+                                                                                       \
+    if (ndt_is_optional(ndt_dtype(stack[2].type))) {                                   \
+        binary_update_bitmap_1D_S(stack);                                              \
+    }                                                                                  \
+    else if (strcmp(STRINGIZE(name), "equaln") == 0) {                                 \
+        binary_update_bitmap_1D_S_bool(stack);                                         \
+    }                                                                                  \
+                                                                                       \
+    return 0;                                                                          \
+}                                                                                      \
+                                                                                       \
+static int                                                                             \
 gm_cpu_host_array_1D_C_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)  \
 {                                                                                      \
     const char *a0 = XND_ARRAY_DATA(stack[0].ptr);                                     \
@@ -754,6 +790,19 @@ gm_cpu_host_fixed_1D_S_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t
 }                                                                                     \
                                                                                       \
 static int                                                                            \
+gm_cpu_host_fixed_1D_Z_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx) \
+{                                                                                     \
+    (void)stack;                                                                      \
+                                                                                      \
+    ndt_err_format(ctx, NDT_NotImplementedError,                                      \
+        "implementation for " STRINGIZE(name) " : "                                   \
+        STRINGIZE(t0) ", " STRINGIZE(t1) " -> " STRINGIZE(t2)                         \
+        " currently requires double rounding");                                       \
+                                                                                      \
+    return -1;                                                                        \
+}                                                                                     \
+                                                                                      \
+static int                                                                            \
 gm_cpu_host_array_1D_C_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx) \
 {                                                                                     \
     (void)stack;                                                                      \
@@ -805,6 +854,18 @@ gm_cpu_host_fixed_1D_S_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t
 }                                                                                     \
                                                                                       \
 static int                                                                            \
+gm_cpu_host_fixed_1D_Z_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx) \
+{                                                                                     \
+    (void)stack;                                                                      \
+                                                                                      \
+    ndt_err_format(ctx, NDT_TypeError,                                                \
+        "no kernel for " STRINGIZE(name) " : "                                        \
+        STRINGIZE(t0) ", " STRINGIZE(t1) " -> " STRINGIZE(t2));                       \
+                                                                                      \
+    return -1;                                                                        \
+}                                                                                     \
+                                                                                      \
+static int                                                                            \
 gm_cpu_host_array_1D_C_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx) \
 {                                                                                     \
     (void)stack;                                                                      \
@@ -833,24 +894,28 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
   { .name = STRINGIZE(func),                                                                             \
     .sig = "... * " STRINGIZE(t0) ", ... * " STRINGIZE(t1) " -> ... * " STRINGIZE(t2),                   \
     .OptC = gm_cpu_host_fixed_1D_C_##func##_##t0##_##t1##_##t2,                                          \
+    .OptZ = gm_cpu_host_fixed_1D_Z_##func##_##t0##_##t1##_##t2,                                          \
     .OptS = gm_cpu_host_fixed_1D_S_##func##_##t0##_##t1##_##t2,                                          \
     .Xnd = gm_cpu_host_0D_##func##_##t0##_##t1##_##t2 },                                                 \
                                                                                                          \
   { .name = STRINGIZE(func),                                                                             \
     .sig = "... * ?" STRINGIZE(t0) ", ... * " STRINGIZE(t1) " -> ... * ?" STRINGIZE(t2),                 \
     .OptC = gm_cpu_host_fixed_1D_C_##func##_##t0##_##t1##_##t2,                                          \
+    .OptZ = gm_cpu_host_fixed_1D_Z_##func##_##t0##_##t1##_##t2,                                          \
     .OptS = gm_cpu_host_fixed_1D_S_##func##_##t0##_##t1##_##t2,                                          \
     .Xnd = gm_cpu_host_0D_##func##_##t0##_##t1##_##t2 },                                                 \
                                                                                                          \
   { .name = STRINGIZE(func),                                                                             \
     .sig = "... * " STRINGIZE(t0) ", ... * ?" STRINGIZE(t1) " -> ... * ?" STRINGIZE(t2),                 \
     .OptC = gm_cpu_host_fixed_1D_C_##func##_##t0##_##t1##_##t2,                                          \
+    .OptZ = gm_cpu_host_fixed_1D_Z_##func##_##t0##_##t1##_##t2,                                          \
     .OptS = gm_cpu_host_fixed_1D_S_##func##_##t0##_##t1##_##t2,                                          \
     .Xnd = gm_cpu_host_0D_##func##_##t0##_##t1##_##t2 },                                                 \
                                                                                                          \
   { .name = STRINGIZE(func),                                                                             \
     .sig = "... * ?" STRINGIZE(t0) ", ... * ?" STRINGIZE(t1) " -> ... * ?" STRINGIZE(t2),                \
     .OptC = gm_cpu_host_fixed_1D_C_##func##_##t0##_##t1##_##t2,                                          \
+    .OptZ = gm_cpu_host_fixed_1D_Z_##func##_##t0##_##t1##_##t2,                                          \
     .OptS = gm_cpu_host_fixed_1D_S_##func##_##t0##_##t1##_##t2,                                          \
     .Xnd = gm_cpu_host_0D_##func##_##t0##_##t1##_##t2 },                                                 \
                                                                                                          \
@@ -891,24 +956,28 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
   { .name = STRINGIZE(func),                                                                            \
     .sig = "... * " STRINGIZE(t0) ", ... * " STRINGIZE(t1) " -> ... * " STRINGIZE(t2),                  \
     .OptC = gm_cpu_host_fixed_1D_C_##func##_##t0##_##t1##_##t2,                                         \
+    .OptZ = gm_cpu_host_fixed_1D_Z_##func##_##t0##_##t1##_##t2,                                         \
     .OptS = gm_cpu_host_fixed_1D_S_##func##_##t0##_##t1##_##t2,                                         \
     .Xnd = gm_cpu_host_0D_##func##_##t0##_##t1##_##t2 },                                                \
                                                                                                         \
   { .name = STRINGIZE(func),                                                                            \
     .sig = "... * ?" STRINGIZE(t0) ", ... * " STRINGIZE(t1) " -> ... * " STRINGIZE(t2),                 \
     .OptC = gm_cpu_host_fixed_1D_C_##func##_##t0##_##t1##_##t2,                                         \
+    .OptZ = gm_cpu_host_fixed_1D_Z_##func##_##t0##_##t1##_##t2,                                         \
     .OptS = gm_cpu_host_fixed_1D_S_##func##_##t0##_##t1##_##t2,                                         \
     .Xnd = gm_cpu_host_0D_##func##_##t0##_##t1##_##t2 },                                                \
                                                                                                         \
   { .name = STRINGIZE(func),                                                                            \
     .sig = "... * " STRINGIZE(t0) ", ... * ?" STRINGIZE(t1) " -> ... * " STRINGIZE(t2),                 \
     .OptC = gm_cpu_host_fixed_1D_C_##func##_##t0##_##t1##_##t2,                                         \
+    .OptZ = gm_cpu_host_fixed_1D_Z_##func##_##t0##_##t1##_##t2,                                         \
     .OptS = gm_cpu_host_fixed_1D_S_##func##_##t0##_##t1##_##t2,                                         \
     .Xnd = gm_cpu_host_0D_##func##_##t0##_##t1##_##t2 },                                                \
                                                                                                         \
   { .name = STRINGIZE(func),                                                                            \
     .sig = "... * ?" STRINGIZE(t0) ", ... * ?" STRINGIZE(t1) " -> ... * " STRINGIZE(t2),                \
     .OptC = gm_cpu_host_fixed_1D_C_##func##_##t0##_##t1##_##t2,                                         \
+    .OptZ = gm_cpu_host_fixed_1D_Z_##func##_##t0##_##t1##_##t2,                                         \
     .OptS = gm_cpu_host_fixed_1D_S_##func##_##t0##_##t1##_##t2,                                         \
     .Xnd = gm_cpu_host_0D_##func##_##t0##_##t1##_##t2 },                                                \
                                                                                                         \
@@ -963,7 +1032,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, uint8, int32, int32)                \
     CPU_HOST_BINARY(name, uint8, int64, int64)                \
     CPU_HOST_BINARY(name, uint8, bfloat16, bfloat16)          \
-    CPU_HOST_NOIMPL(name, uint8, float16, float16)            \
+    CPU_HOST_BINARY(name, uint8, float16, float16)            \
     CPU_HOST_BINARY(name, uint8, float32, float32)            \
     CPU_HOST_BINARY(name, uint8, float64, float64)            \
     CPU_HOST_NOIMPL(name, uint8, complex32, complex32)        \
@@ -979,7 +1048,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, uint16, int32, int32)               \
     CPU_HOST_BINARY(name, uint16, int64, int64)               \
     CPU_HOST_BINARY(name, uint16, bfloat16, float32)          \
-    CPU_HOST_NOIMPL(name, uint16, float16, float32)           \
+    CPU_HOST_BINARY(name, uint16, float16, float32)           \
     CPU_HOST_BINARY(name, uint16, float32, float32)           \
     CPU_HOST_BINARY(name, uint16, float64, float64)           \
     CPU_HOST_NOIMPL(name, uint16, complex32, complex64)       \
@@ -995,7 +1064,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, uint32, int32, int64)               \
     CPU_HOST_BINARY(name, uint32, int64, int64)               \
     CPU_HOST_BINARY(name, uint32, bfloat16, float64)          \
-    CPU_HOST_NOIMPL(name, uint32, float16, float64)           \
+    CPU_HOST_BINARY(name, uint32, float16, float64)           \
     CPU_HOST_BINARY(name, uint32, float32, float64)           \
     CPU_HOST_BINARY(name, uint32, float64, float64)           \
     CPU_HOST_NOIMPL(name, uint32, complex32, complex128)      \
@@ -1015,7 +1084,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, int8, int32, int32)                 \
     CPU_HOST_BINARY(name, int8, int64, int64)                 \
     CPU_HOST_BINARY(name, int8, bfloat16, bfloat16)           \
-    CPU_HOST_NOIMPL(name, int8, float16, float16)             \
+    CPU_HOST_BINARY(name, int8, float16, float16)             \
     CPU_HOST_BINARY(name, int8, float32, float32)             \
     CPU_HOST_BINARY(name, int8, float64, float64)             \
     CPU_HOST_NOIMPL(name, int8, complex32, complex32)         \
@@ -1030,7 +1099,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, int16, int32, int32)                \
     CPU_HOST_BINARY(name, int16, int64, int64)                \
     CPU_HOST_BINARY(name, int16, bfloat16, float32)           \
-    CPU_HOST_NOIMPL(name, int16, float16, float32)            \
+    CPU_HOST_BINARY(name, int16, float16, float32)            \
     CPU_HOST_BINARY(name, int16, float32, float32)            \
     CPU_HOST_BINARY(name, int16, float64, float64)            \
     CPU_HOST_NOIMPL(name, int16, complex32, complex64)        \
@@ -1045,7 +1114,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, int32, int32, int32)                \
     CPU_HOST_BINARY(name, int32, int64, int64)                \
     CPU_HOST_BINARY(name, int32, bfloat16, float64)           \
-    CPU_HOST_NOIMPL(name, int32, float16, float64)            \
+    CPU_HOST_BINARY(name, int32, float16, float64)            \
     CPU_HOST_BINARY(name, int32, float32, float64)            \
     CPU_HOST_BINARY(name, int32, float64, float64)            \
     CPU_HOST_NOIMPL(name, int32, complex32, complex128)       \
@@ -1067,26 +1136,26 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, bfloat16, int16, float32)           \
     CPU_HOST_BINARY(name, bfloat16, int32, float64)           \
     CPU_HOST_BINARY(name, bfloat16, bfloat16, bfloat16)       \
-    CPU_HOST_NOIMPL(name, bfloat16, float16, float32)         \
+    CPU_HOST_BINARY(name, bfloat16, float16, float32)         \
     CPU_HOST_BINARY(name, bfloat16, float32, float32)         \
     CPU_HOST_BINARY(name, bfloat16, float64, float64)         \
     CPU_HOST_NOIMPL(name, bfloat16, complex32, complex64)     \
     CPU_HOST_BINARY(name, bfloat16, complex64, complex64)     \
     CPU_HOST_BINARY(name, bfloat16, complex128, complex128)   \
                                                               \
-    CPU_HOST_NOIMPL(name, float16, uint8, float16)            \
-    CPU_HOST_NOIMPL(name, float16, uint16, float32)           \
-    CPU_HOST_NOIMPL(name, float16, uint32, float64)           \
-    CPU_HOST_NOIMPL(name, float16, int8, float16)             \
-    CPU_HOST_NOIMPL(name, float16, int16, float32)            \
-    CPU_HOST_NOIMPL(name, float16, int32, float64)            \
-    CPU_HOST_NOIMPL(name, float16, bfloat16, float32)         \
-    CPU_HOST_NOIMPL(name, float16, float16, float16)          \
-    CPU_HOST_NOIMPL(name, float16, float32, float32)          \
-    CPU_HOST_NOIMPL(name, float16, float64, float64)          \
+    CPU_HOST_BINARY(name, float16, uint8, float16)            \
+    CPU_HOST_BINARY(name, float16, uint16, float32)           \
+    CPU_HOST_BINARY(name, float16, uint32, float64)           \
+    CPU_HOST_BINARY(name, float16, int8, float16)             \
+    CPU_HOST_BINARY(name, float16, int16, float32)            \
+    CPU_HOST_BINARY(name, float16, int32, float64)            \
+    CPU_HOST_BINARY(name, float16, bfloat16, float32)         \
+    CPU_HOST_BINARY(name, float16, float16, float16)          \
+    CPU_HOST_BINARY(name, float16, float32, float32)          \
+    CPU_HOST_BINARY(name, float16, float64, float64)          \
     CPU_HOST_NOIMPL(name, float16, complex32, complex32)      \
-    CPU_HOST_NOIMPL(name, float16, complex64, complex64)      \
-    CPU_HOST_NOIMPL(name, float16, complex128, complex128)    \
+    CPU_HOST_BINARY(name, float16, complex64, complex64)      \
+    CPU_HOST_BINARY(name, float16, complex128, complex128)    \
                                                               \
     CPU_HOST_BINARY(name, float32, uint8, float32)            \
     CPU_HOST_BINARY(name, float32, uint16, float32)           \
@@ -1095,7 +1164,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, float32, int16, float32)            \
     CPU_HOST_BINARY(name, float32, int32, float64)            \
     CPU_HOST_BINARY(name, float32, bfloat16, float32)         \
-    CPU_HOST_NOIMPL(name, float32, float16, float32)          \
+    CPU_HOST_BINARY(name, float32, float16, float32)          \
     CPU_HOST_BINARY(name, float32, float32, float32)          \
     CPU_HOST_BINARY(name, float32, float64, float64)          \
     CPU_HOST_NOIMPL(name, float32, complex32, complex64)      \
@@ -1109,7 +1178,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, float64, int16, float64)            \
     CPU_HOST_BINARY(name, float64, int32, float64)            \
     CPU_HOST_BINARY(name, float64, bfloat16, float64)         \
-    CPU_HOST_NOIMPL(name, float64, float16, float64)          \
+    CPU_HOST_BINARY(name, float64, float16, float64)          \
     CPU_HOST_BINARY(name, float64, float32, float64)          \
     CPU_HOST_BINARY(name, float64, float64, float64)          \
     CPU_HOST_NOIMPL(name, float64, complex32, complex128)     \
@@ -1137,7 +1206,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, complex64, int16, complex64)        \
     CPU_HOST_BINARY(name, complex64, int32, complex128)       \
     CPU_HOST_BINARY(name, complex64, bfloat16, complex64)     \
-    CPU_HOST_NOIMPL(name, complex64, float16, complex64)      \
+    CPU_HOST_BINARY(name, complex64, float16, complex64)      \
     CPU_HOST_BINARY(name, complex64, float32, complex64)      \
     CPU_HOST_BINARY(name, complex64, float64, complex128)     \
     CPU_HOST_NOIMPL(name, complex64, complex32, complex64)    \
@@ -1151,7 +1220,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, complex128, int16, complex128)      \
     CPU_HOST_BINARY(name, complex128, int32, complex128)      \
     CPU_HOST_BINARY(name, complex128, bfloat16, complex128)   \
-    CPU_HOST_NOIMPL(name, complex128, float16, complex128)    \
+    CPU_HOST_BINARY(name, complex128, float16, complex128)    \
     CPU_HOST_BINARY(name, complex128, float32, complex128)    \
     CPU_HOST_BINARY(name, complex128, float64, complex128)    \
     CPU_HOST_NOIMPL(name, complex128, complex32, complex128)  \
@@ -1168,7 +1237,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, uint8, int32, int32)                \
     CPU_HOST_BINARY(name, uint8, int64, int64)                \
     CPU_HOST_BINARY(name, uint8, bfloat16, bfloat16)          \
-    CPU_HOST_NOIMPL(name, uint8, float16, float16)            \
+    CPU_HOST_BINARY(name, uint8, float16, float16)            \
     CPU_HOST_BINARY(name, uint8, float32, float32)            \
     CPU_HOST_BINARY(name, uint8, float64, float64)            \
     CPU_HOST_NOKERN(name, uint8, complex32, complex32)        \
@@ -1184,7 +1253,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, uint16, int32, int32)               \
     CPU_HOST_BINARY(name, uint16, int64, int64)               \
     CPU_HOST_BINARY(name, uint16, bfloat16, float32)          \
-    CPU_HOST_NOIMPL(name, uint16, float16, float32)           \
+    CPU_HOST_BINARY(name, uint16, float16, float32)           \
     CPU_HOST_BINARY(name, uint16, float32, float32)           \
     CPU_HOST_BINARY(name, uint16, float64, float64)           \
     CPU_HOST_NOKERN(name, uint16, complex32, complex64)       \
@@ -1200,7 +1269,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, uint32, int32, int64)               \
     CPU_HOST_BINARY(name, uint32, int64, int64)               \
     CPU_HOST_BINARY(name, uint32, bfloat16, float64)          \
-    CPU_HOST_NOIMPL(name, uint32, float16, float64)           \
+    CPU_HOST_BINARY(name, uint32, float16, float64)           \
     CPU_HOST_BINARY(name, uint32, float32, float64)           \
     CPU_HOST_BINARY(name, uint32, float64, float64)           \
     CPU_HOST_NOKERN(name, uint32, complex32, complex128)      \
@@ -1220,7 +1289,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, int8, int32, int32)                 \
     CPU_HOST_BINARY(name, int8, int64, int64)                 \
     CPU_HOST_BINARY(name, int8, bfloat16, bfloat16)           \
-    CPU_HOST_NOIMPL(name, int8, float16, float16)             \
+    CPU_HOST_BINARY(name, int8, float16, float16)             \
     CPU_HOST_BINARY(name, int8, float32, float32)             \
     CPU_HOST_BINARY(name, int8, float64, float64)             \
     CPU_HOST_NOKERN(name, int8, complex32, complex32)         \
@@ -1235,7 +1304,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, int16, int32, int32)                \
     CPU_HOST_BINARY(name, int16, int64, int64)                \
     CPU_HOST_BINARY(name, int16, bfloat16, float32)           \
-    CPU_HOST_NOIMPL(name, int16, float16, float32)            \
+    CPU_HOST_BINARY(name, int16, float16, float32)            \
     CPU_HOST_BINARY(name, int16, float32, float32)            \
     CPU_HOST_BINARY(name, int16, float64, float64)            \
     CPU_HOST_NOKERN(name, int16, complex32, complex64)        \
@@ -1250,7 +1319,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, int32, int32, int32)                \
     CPU_HOST_BINARY(name, int32, int64, int64)                \
     CPU_HOST_BINARY(name, int32, bfloat16, float64)           \
-    CPU_HOST_NOIMPL(name, int32, float16, float64)            \
+    CPU_HOST_BINARY(name, int32, float16, float64)            \
     CPU_HOST_BINARY(name, int32, float32, float64)            \
     CPU_HOST_BINARY(name, int32, float64, float64)            \
     CPU_HOST_NOKERN(name, int32, complex32, complex128)       \
@@ -1272,23 +1341,23 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, bfloat16, int16, float32)           \
     CPU_HOST_BINARY(name, bfloat16, int32, float64)           \
     CPU_HOST_BINARY(name, bfloat16, bfloat16, bfloat16)       \
-    CPU_HOST_NOIMPL(name, bfloat16, float16, float32)         \
+    CPU_HOST_BINARY(name, bfloat16, float16, float32)         \
     CPU_HOST_BINARY(name, bfloat16, float32, float32)         \
     CPU_HOST_BINARY(name, bfloat16, float64, float64)         \
     CPU_HOST_NOKERN(name, bfloat16, complex32, complex64)     \
     CPU_HOST_NOKERN(name, bfloat16, complex64, complex64)     \
     CPU_HOST_NOKERN(name, bfloat16, complex128, complex128)   \
                                                               \
-    CPU_HOST_NOIMPL(name, float16, uint8, float16)            \
-    CPU_HOST_NOIMPL(name, float16, uint16, float32)           \
-    CPU_HOST_NOIMPL(name, float16, uint32, float64)           \
-    CPU_HOST_NOIMPL(name, float16, int8, float16)             \
-    CPU_HOST_NOIMPL(name, float16, int16, float32)            \
-    CPU_HOST_NOIMPL(name, float16, int32, float64)            \
-    CPU_HOST_NOIMPL(name, float16, bfloat16, float32)         \
-    CPU_HOST_NOIMPL(name, float16, float16, float16)          \
-    CPU_HOST_NOIMPL(name, float16, float32, float32)          \
-    CPU_HOST_NOIMPL(name, float16, float64, float64)          \
+    CPU_HOST_BINARY(name, float16, uint8, float16)            \
+    CPU_HOST_BINARY(name, float16, uint16, float32)           \
+    CPU_HOST_BINARY(name, float16, uint32, float64)           \
+    CPU_HOST_BINARY(name, float16, int8, float16)             \
+    CPU_HOST_BINARY(name, float16, int16, float32)            \
+    CPU_HOST_BINARY(name, float16, int32, float64)            \
+    CPU_HOST_BINARY(name, float16, bfloat16, float32)         \
+    CPU_HOST_BINARY(name, float16, float16, float16)          \
+    CPU_HOST_BINARY(name, float16, float32, float32)          \
+    CPU_HOST_BINARY(name, float16, float64, float64)          \
     CPU_HOST_NOKERN(name, float16, complex32, complex32)      \
     CPU_HOST_NOKERN(name, float16, complex64, complex64)      \
     CPU_HOST_NOKERN(name, float16, complex128, complex128)    \
@@ -1300,7 +1369,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, float32, int16, float32)            \
     CPU_HOST_BINARY(name, float32, int32, float64)            \
     CPU_HOST_BINARY(name, float32, bfloat16, float32)         \
-    CPU_HOST_NOIMPL(name, float32, float16, float32)          \
+    CPU_HOST_BINARY(name, float32, float16, float32)          \
     CPU_HOST_BINARY(name, float32, float32, float32)          \
     CPU_HOST_BINARY(name, float32, float64, float64)          \
     CPU_HOST_NOKERN(name, float32, complex32, complex64)      \
@@ -1314,7 +1383,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, float64, int16, float64)            \
     CPU_HOST_BINARY(name, float64, int32, float64)            \
     CPU_HOST_BINARY(name, float64, bfloat16, float64)         \
-    CPU_HOST_NOIMPL(name, float64, float16, float64)          \
+    CPU_HOST_BINARY(name, float64, float16, float64)          \
     CPU_HOST_BINARY(name, float64, float32, float64)          \
     CPU_HOST_BINARY(name, float64, float64, float64)          \
     CPU_HOST_NOKERN(name, float64, complex32, complex128)     \
@@ -1364,16 +1433,16 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_NOKERN(name, complex128, complex128, complex128)
 
 #define CPU_HOST_ALL_ARITHMETIC_FLOAT_RETURN(name) \
-    CPU_HOST_NOIMPL(name, uint8, uint8, float16)              \
+    CPU_HOST_BINARY(name, uint8, uint8, float16)              \
     CPU_HOST_BINARY(name, uint8, uint16, float32)             \
     CPU_HOST_BINARY(name, uint8, uint32, float64)             \
     CPU_HOST_NOKERN(name, uint8, uint64, uint64)              \
-    CPU_HOST_NOIMPL(name, uint8, int8, float16)               \
+    CPU_HOST_BINARY(name, uint8, int8, float16)               \
     CPU_HOST_BINARY(name, uint8, int16, float32)              \
     CPU_HOST_BINARY(name, uint8, int32, float64)              \
     CPU_HOST_NOKERN(name, uint8, int64, int64)                \
     CPU_HOST_BINARY(name, uint8, bfloat16, bfloat16)          \
-    CPU_HOST_NOIMPL(name, uint8, float16, float16)            \
+    CPU_HOST_BINARY(name, uint8, float16, float16)            \
     CPU_HOST_BINARY(name, uint8, float32, float32)            \
     CPU_HOST_BINARY(name, uint8, float64, float64)            \
     CPU_HOST_NOIMPL(name, uint8, complex32, complex32)        \
@@ -1389,7 +1458,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, uint16, int32, float64)             \
     CPU_HOST_NOKERN(name, uint16, int64, int64)               \
     CPU_HOST_BINARY(name, uint16, bfloat16, float32)          \
-    CPU_HOST_NOIMPL(name, uint16, float16, float32)           \
+    CPU_HOST_BINARY(name, uint16, float16, float32)           \
     CPU_HOST_BINARY(name, uint16, float32, float32)           \
     CPU_HOST_BINARY(name, uint16, float64, float64)           \
     CPU_HOST_NOIMPL(name, uint16, complex32, complex64)       \
@@ -1405,7 +1474,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, uint32, int32, float64)             \
     CPU_HOST_NOKERN(name, uint32, int64, int64)               \
     CPU_HOST_BINARY(name, uint32, bfloat16, float64)          \
-    CPU_HOST_NOIMPL(name, uint32, float16, float64)           \
+    CPU_HOST_BINARY(name, uint32, float16, float64)           \
     CPU_HOST_BINARY(name, uint32, float32, float64)           \
     CPU_HOST_BINARY(name, uint32, float64, float64)           \
     CPU_HOST_NOIMPL(name, uint32, complex32, complex128)      \
@@ -1417,15 +1486,15 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_NOKERN(name, uint64, uint32, uint64)             \
     CPU_HOST_NOKERN(name, uint64, uint64, uint64)             \
                                                               \
-    CPU_HOST_NOIMPL(name, int8, uint8, float16)               \
+    CPU_HOST_BINARY(name, int8, uint8, float16)               \
     CPU_HOST_BINARY(name, int8, uint16, float32)              \
     CPU_HOST_BINARY(name, int8, uint32, float64)              \
-    CPU_HOST_NOIMPL(name, int8, int8, float16)                \
+    CPU_HOST_BINARY(name, int8, int8, float16)                \
     CPU_HOST_BINARY(name, int8, int16, float32)               \
     CPU_HOST_BINARY(name, int8, int32, float64)               \
     CPU_HOST_NOKERN(name, int8, int64, int64)                 \
     CPU_HOST_BINARY(name, int8, bfloat16, bfloat16)           \
-    CPU_HOST_NOIMPL(name, int8, float16, float16)             \
+    CPU_HOST_BINARY(name, int8, float16, float16)             \
     CPU_HOST_BINARY(name, int8, float32, float32)             \
     CPU_HOST_BINARY(name, int8, float64, float64)             \
     CPU_HOST_NOIMPL(name, int8, complex32, complex32)         \
@@ -1440,7 +1509,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, int16, int32, float64)              \
     CPU_HOST_NOKERN(name, int16, int64, int64)                \
     CPU_HOST_BINARY(name, int16, bfloat16, float32)           \
-    CPU_HOST_NOIMPL(name, int16, float16, float32)            \
+    CPU_HOST_BINARY(name, int16, float16, float32)            \
     CPU_HOST_BINARY(name, int16, float32, float32)            \
     CPU_HOST_BINARY(name, int16, float64, float64)            \
     CPU_HOST_NOIMPL(name, int16, complex32, complex64)        \
@@ -1455,7 +1524,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, int32, int32, float64)              \
     CPU_HOST_NOKERN(name, int32, int64, int64)                \
     CPU_HOST_BINARY(name, int32, bfloat16, float64)           \
-    CPU_HOST_NOIMPL(name, int32, float16, float64)            \
+    CPU_HOST_BINARY(name, int32, float16, float64)            \
     CPU_HOST_BINARY(name, int32, float32, float64)            \
     CPU_HOST_BINARY(name, int32, float64, float64)            \
     CPU_HOST_NOIMPL(name, int32, complex32, complex128)       \
@@ -1477,26 +1546,26 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, bfloat16, int16, float32)           \
     CPU_HOST_BINARY(name, bfloat16, int32, float64)           \
     CPU_HOST_BINARY(name, bfloat16, bfloat16, bfloat16)       \
-    CPU_HOST_NOIMPL(name, bfloat16, float16, float32)         \
+    CPU_HOST_BINARY(name, bfloat16, float16, float32)         \
     CPU_HOST_BINARY(name, bfloat16, float32, float32)         \
     CPU_HOST_BINARY(name, bfloat16, float64, float64)         \
     CPU_HOST_NOIMPL(name, bfloat16, complex32, complex64)     \
     CPU_HOST_BINARY(name, bfloat16, complex64, complex64)     \
     CPU_HOST_BINARY(name, bfloat16, complex128, complex128)   \
                                                               \
-    CPU_HOST_NOIMPL(name, float16, uint8, float16)            \
-    CPU_HOST_NOIMPL(name, float16, uint16, float32)           \
-    CPU_HOST_NOIMPL(name, float16, uint32, float64)           \
-    CPU_HOST_NOIMPL(name, float16, int8, float16)             \
-    CPU_HOST_NOIMPL(name, float16, int16, float32)            \
-    CPU_HOST_NOIMPL(name, float16, int32, float64)            \
-    CPU_HOST_NOIMPL(name, float16, bfloat16, float32)         \
-    CPU_HOST_NOIMPL(name, float16, float16, float16)          \
-    CPU_HOST_NOIMPL(name, float16, float32, float32)          \
-    CPU_HOST_NOIMPL(name, float16, float64, float64)          \
+    CPU_HOST_BINARY(name, float16, uint8, float16)            \
+    CPU_HOST_BINARY(name, float16, uint16, float32)           \
+    CPU_HOST_BINARY(name, float16, uint32, float64)           \
+    CPU_HOST_BINARY(name, float16, int8, float16)             \
+    CPU_HOST_BINARY(name, float16, int16, float32)            \
+    CPU_HOST_BINARY(name, float16, int32, float64)            \
+    CPU_HOST_BINARY(name, float16, bfloat16, float32)         \
+    CPU_HOST_BINARY(name, float16, float16, float16)          \
+    CPU_HOST_BINARY(name, float16, float32, float32)          \
+    CPU_HOST_BINARY(name, float16, float64, float64)          \
     CPU_HOST_NOIMPL(name, float16, complex32, complex32)      \
-    CPU_HOST_NOIMPL(name, float16, complex64, complex64)      \
-    CPU_HOST_NOIMPL(name, float16, complex128, complex128)    \
+    CPU_HOST_BINARY(name, float16, complex64, complex64)      \
+    CPU_HOST_BINARY(name, float16, complex128, complex128)    \
                                                               \
     CPU_HOST_BINARY(name, float32, uint8, float32)            \
     CPU_HOST_BINARY(name, float32, uint16, float32)           \
@@ -1505,7 +1574,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, float32, int16, float32)            \
     CPU_HOST_BINARY(name, float32, int32, float64)            \
     CPU_HOST_BINARY(name, float32, bfloat16, float32)         \
-    CPU_HOST_NOIMPL(name, float32, float16, float32)          \
+    CPU_HOST_BINARY(name, float32, float16, float32)          \
     CPU_HOST_BINARY(name, float32, float32, float32)          \
     CPU_HOST_BINARY(name, float32, float64, float64)          \
     CPU_HOST_NOIMPL(name, float32, complex32, complex64)      \
@@ -1519,7 +1588,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, float64, int16, float64)            \
     CPU_HOST_BINARY(name, float64, int32, float64)            \
     CPU_HOST_BINARY(name, float64, bfloat16, float64)         \
-    CPU_HOST_NOIMPL(name, float64, float16, float64)          \
+    CPU_HOST_BINARY(name, float64, float16, float64)          \
     CPU_HOST_BINARY(name, float64, float32, float64)          \
     CPU_HOST_BINARY(name, float64, float64, float64)          \
     CPU_HOST_NOIMPL(name, float64, complex32, complex128)     \
@@ -1547,7 +1616,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, complex64, int16, complex64)        \
     CPU_HOST_BINARY(name, complex64, int32, complex128)       \
     CPU_HOST_BINARY(name, complex64, bfloat16, complex64)     \
-    CPU_HOST_NOIMPL(name, complex64, float16, complex64)      \
+    CPU_HOST_BINARY(name, complex64, float16, complex64)      \
     CPU_HOST_BINARY(name, complex64, float32, complex64)      \
     CPU_HOST_BINARY(name, complex64, float64, complex128)     \
     CPU_HOST_NOIMPL(name, complex64, complex32, complex64)    \
@@ -1561,7 +1630,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2(xnd_t stack[], ndt_context_t *ctx)
     CPU_HOST_BINARY(name, complex128, int16, complex128)      \
     CPU_HOST_BINARY(name, complex128, int32, complex128)      \
     CPU_HOST_BINARY(name, complex128, bfloat16, complex128)   \
-    CPU_HOST_NOIMPL(name, complex128, float16, complex128)    \
+    CPU_HOST_BINARY(name, complex128, float16, complex128)    \
     CPU_HOST_BINARY(name, complex128, float32, complex128)    \
     CPU_HOST_BINARY(name, complex128, float64, complex128)    \
     CPU_HOST_NOIMPL(name, complex128, complex32, complex128)  \
@@ -2002,7 +2071,7 @@ CPU_HOST_ALL_ARITHMETIC(power)
     CPU_HOST_BINARY(name, uint8, int32, bool)           \
     CPU_HOST_BINARY(name, uint8, int64, bool)           \
     CPU_HOST_BINARY(name, uint8, bfloat16, bool)        \
-    CPU_HOST_NOIMPL(name, uint8, float16, bool)         \
+    CPU_HOST_BINARY(name, uint8, float16, bool)         \
     CPU_HOST_BINARY(name, uint8, float32, bool)         \
     CPU_HOST_BINARY(name, uint8, float64, bool)         \
     CPU_HOST_NOIMPL(name, uint8, complex32, bool)       \
@@ -2018,7 +2087,7 @@ CPU_HOST_ALL_ARITHMETIC(power)
     CPU_HOST_BINARY(name, uint16, int32, bool)          \
     CPU_HOST_BINARY(name, uint16, int64, bool)          \
     CPU_HOST_BINARY(name, uint16, bfloat16, bool)       \
-    CPU_HOST_NOIMPL(name, uint16, float16, bool)        \
+    CPU_HOST_BINARY(name, uint16, float16, bool)        \
     CPU_HOST_BINARY(name, uint16, float32, bool)        \
     CPU_HOST_BINARY(name, uint16, float64, bool)        \
     CPU_HOST_NOIMPL(name, uint16, complex32, bool)      \
@@ -2034,7 +2103,7 @@ CPU_HOST_ALL_ARITHMETIC(power)
     CPU_HOST_BINARY(name, uint32, int32, bool)          \
     CPU_HOST_BINARY(name, uint32, int64, bool)          \
     CPU_HOST_BINARY(name, uint32, bfloat16, bool)       \
-    CPU_HOST_NOIMPL(name, uint32, float16, bool)        \
+    CPU_HOST_BINARY(name, uint32, float16, bool)        \
     CPU_HOST_BINARY(name, uint32, float32, bool)        \
     CPU_HOST_BINARY(name, uint32, float64, bool)        \
     CPU_HOST_NOIMPL(name, uint32, complex32, bool)      \
@@ -2054,7 +2123,7 @@ CPU_HOST_ALL_ARITHMETIC(power)
     CPU_HOST_BINARY(name, int8, int32, bool)            \
     CPU_HOST_BINARY(name, int8, int64, bool)            \
     CPU_HOST_BINARY(name, int8, bfloat16, bool)         \
-    CPU_HOST_NOIMPL(name, int8, float16, bool)          \
+    CPU_HOST_BINARY(name, int8, float16, bool)          \
     CPU_HOST_BINARY(name, int8, float32, bool)          \
     CPU_HOST_BINARY(name, int8, float64, bool)          \
     CPU_HOST_NOIMPL(name, int8, complex32, bool)        \
@@ -2069,7 +2138,7 @@ CPU_HOST_ALL_ARITHMETIC(power)
     CPU_HOST_BINARY(name, int16, int32, bool)           \
     CPU_HOST_BINARY(name, int16, int64, bool)           \
     CPU_HOST_BINARY(name, int16, bfloat16, bool)        \
-    CPU_HOST_NOIMPL(name, int16, float16, bool)         \
+    CPU_HOST_BINARY(name, int16, float16, bool)         \
     CPU_HOST_BINARY(name, int16, float32, bool)         \
     CPU_HOST_BINARY(name, int16, float64, bool)         \
     CPU_HOST_NOIMPL(name, int16, complex32, bool)       \
@@ -2084,7 +2153,7 @@ CPU_HOST_ALL_ARITHMETIC(power)
     CPU_HOST_BINARY(name, int32, int32, bool)           \
     CPU_HOST_BINARY(name, int32, int64, bool)           \
     CPU_HOST_BINARY(name, int32, bfloat16, bool)        \
-    CPU_HOST_NOIMPL(name, int32, float16, bool)         \
+    CPU_HOST_BINARY(name, int32, float16, bool)         \
     CPU_HOST_BINARY(name, int32, float32, bool)         \
     CPU_HOST_BINARY(name, int32, float64, bool)         \
     CPU_HOST_NOIMPL(name, int32, complex32, bool)       \
@@ -2106,26 +2175,26 @@ CPU_HOST_ALL_ARITHMETIC(power)
     CPU_HOST_BINARY(name, bfloat16, int16, bool)        \
     CPU_HOST_BINARY(name, bfloat16, int32, bool)        \
     CPU_HOST_BINARY(name, bfloat16, bfloat16, bool)     \
-    CPU_HOST_NOIMPL(name, bfloat16, float16, bool)      \
+    CPU_HOST_BINARY(name, bfloat16, float16, bool)      \
     CPU_HOST_BINARY(name, bfloat16, float32, bool)      \
     CPU_HOST_BINARY(name, bfloat16, float64, bool)      \
     CPU_HOST_NOIMPL(name, bfloat16, complex32, bool)    \
     CPU_HOST_BINARY(name, bfloat16, complex64, bool)    \
     CPU_HOST_BINARY(name, bfloat16, complex128, bool)   \
                                                         \
-    CPU_HOST_NOIMPL(name, float16, uint8, bool)         \
-    CPU_HOST_NOIMPL(name, float16, uint16, bool)        \
-    CPU_HOST_NOIMPL(name, float16, uint32, bool)        \
-    CPU_HOST_NOIMPL(name, float16, int8, bool)          \
-    CPU_HOST_NOIMPL(name, float16, int16, bool)         \
-    CPU_HOST_NOIMPL(name, float16, int32, bool)         \
-    CPU_HOST_NOIMPL(name, float16, bfloat16, bool)      \
-    CPU_HOST_NOIMPL(name, float16, float16, bool)       \
-    CPU_HOST_NOIMPL(name, float16, float32, bool)       \
-    CPU_HOST_NOIMPL(name, float16, float64, bool)       \
+    CPU_HOST_BINARY(name, float16, uint8, bool)         \
+    CPU_HOST_BINARY(name, float16, uint16, bool)        \
+    CPU_HOST_BINARY(name, float16, uint32, bool)        \
+    CPU_HOST_BINARY(name, float16, int8, bool)          \
+    CPU_HOST_BINARY(name, float16, int16, bool)         \
+    CPU_HOST_BINARY(name, float16, int32, bool)         \
+    CPU_HOST_BINARY(name, float16, bfloat16, bool)      \
+    CPU_HOST_BINARY(name, float16, float16, bool)       \
+    CPU_HOST_BINARY(name, float16, float32, bool)       \
+    CPU_HOST_BINARY(name, float16, float64, bool)       \
     CPU_HOST_NOIMPL(name, float16, complex32, bool)     \
-    CPU_HOST_NOIMPL(name, float16, complex64, bool)     \
-    CPU_HOST_NOIMPL(name, float16, complex128, bool)    \
+    CPU_HOST_BINARY(name, float16, complex64, bool)     \
+    CPU_HOST_BINARY(name, float16, complex128, bool)    \
                                                         \
     CPU_HOST_BINARY(name, float32, uint8, bool)         \
     CPU_HOST_BINARY(name, float32, uint16, bool)        \
@@ -2134,7 +2203,7 @@ CPU_HOST_ALL_ARITHMETIC(power)
     CPU_HOST_BINARY(name, float32, int16, bool)         \
     CPU_HOST_BINARY(name, float32, int32, bool)         \
     CPU_HOST_BINARY(name, float32, bfloat16, bool)      \
-    CPU_HOST_NOIMPL(name, float32, float16, bool)       \
+    CPU_HOST_BINARY(name, float32, float16, bool)       \
     CPU_HOST_BINARY(name, float32, float32, bool)       \
     CPU_HOST_BINARY(name, float32, float64, bool)       \
     CPU_HOST_NOIMPL(name, float32, complex32, bool)     \
@@ -2148,7 +2217,7 @@ CPU_HOST_ALL_ARITHMETIC(power)
     CPU_HOST_BINARY(name, float64, int16, bool)         \
     CPU_HOST_BINARY(name, float64, int32, bool)         \
     CPU_HOST_BINARY(name, float64, bfloat16, bool)      \
-    CPU_HOST_NOIMPL(name, float64, float16, bool)       \
+    CPU_HOST_BINARY(name, float64, float16, bool)       \
     CPU_HOST_BINARY(name, float64, float32, bool)       \
     CPU_HOST_BINARY(name, float64, float64, bool)       \
     CPU_HOST_NOIMPL(name, float64, complex32, bool)     \
@@ -2176,7 +2245,7 @@ CPU_HOST_ALL_ARITHMETIC(power)
     CPU_HOST_BINARY(name, complex64, int16, bool)       \
     CPU_HOST_BINARY(name, complex64, int32, bool)       \
     CPU_HOST_BINARY(name, complex64, bfloat16, bool)    \
-    CPU_HOST_NOIMPL(name, complex64, float16, bool)     \
+    CPU_HOST_BINARY(name, complex64, float16, bool)     \
     CPU_HOST_BINARY(name, complex64, float32, bool)     \
     CPU_HOST_BINARY(name, complex64, float64, bool)     \
     CPU_HOST_NOIMPL(name, complex64, complex32, bool)   \
@@ -2190,7 +2259,7 @@ CPU_HOST_ALL_ARITHMETIC(power)
     CPU_HOST_BINARY(name, complex128, int16, bool)      \
     CPU_HOST_BINARY(name, complex128, int32, bool)      \
     CPU_HOST_BINARY(name, complex128, bfloat16, bool)   \
-    CPU_HOST_NOIMPL(name, complex128, float16, bool)    \
+    CPU_HOST_BINARY(name, complex128, float16, bool)    \
     CPU_HOST_BINARY(name, complex128, float32, bool)    \
     CPU_HOST_BINARY(name, complex128, float64, bool)    \
     CPU_HOST_NOIMPL(name, complex128, complex32, bool)  \
@@ -2874,6 +2943,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2##_##t3(xnd_t stack[], ndt_context_t *
     CPU_HOST_BINARY_MV(name, int32, int32, int32, int32)             \
     CPU_HOST_BINARY_MV(name, int64, int64, int64, int64)             \
     CPU_HOST_BINARY_MV(name, bfloat16, bfloat16, bfloat16, bfloat16) \
+    CPU_HOST_BINARY_MV(name, float16, float16, float16, float16)     \
     CPU_HOST_BINARY_MV(name, float32, float32, float32, float32)     \
     CPU_HOST_BINARY_MV(name, float64, float64, float64, float64)
 
@@ -2887,6 +2957,7 @@ gm_cpu_host_0D_##name##_##t0##_##t1##_##t2##_##t3(xnd_t stack[], ndt_context_t *
     CPU_HOST_BINARY_MV_INIT(name, int32, int32, int32, int32),             \
     CPU_HOST_BINARY_MV_INIT(name, int64, int64, int64, int64),             \
     CPU_HOST_BINARY_MV_INIT(name, bfloat16, bfloat16, bfloat16, bfloat16), \
+    CPU_HOST_BINARY_MV_INIT(name, float16, float16, float16, float16),     \
     CPU_HOST_BINARY_MV_INIT(name, float32, float32, float32, float32),     \
     CPU_HOST_BINARY_MV_INIT(name, float64, float64, float64, float64)
 
@@ -2931,19 +3002,19 @@ gm_init_cpu_binary_kernels(gm_tbl_t *tbl, ndt_context_t *ctx)
     const gm_kernel_init_t *k;
 
     for (k = binary_kernels; k->name != NULL; k++) {
-        if (gm_add_kernel_typecheck(tbl, k, ctx, &binary_typecheck) < 0) {
+        if (gm_add_kernel_lazy(tbl, k, ctx, &binary_typecheck) < 0) {
              return -1;
         }
     }
 
     for (k = bitwise_kernels; k->name != NULL; k++) {
-        if (gm_add_kernel_typecheck(tbl, k, ctx, &bitwise_typecheck) < 0) {
+        if (gm_add_kernel_lazy(tbl, k, ctx, &bitwise_typecheck) < 0) {
              return -1;
         }
     }
 
     for (k = binary_mv_kernels; k->name != NULL; k++) {
-        if (gm_add_kernel(tbl, k, ctx) < 0) {
+        if (gm_add_kernel_lazy(tbl, k, ctx, NULL) < 0) {
              return -1;
         }
     }
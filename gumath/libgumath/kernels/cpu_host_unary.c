@@ -518,7 +518,7 @@ gm_cpu_host_array_1D_C_##name##_##t0##_##t1(xnd_t stack[], ndt_context_t *ctx) \
     CPU_HOST_UNARY(name, bool, int32)            \
     CPU_HOST_UNARY(name, bool, int64)            \
     CPU_HOST_UNARY(name, bool, bfloat16)         \
-    CPU_HOST_NOIMPL(name, bool, float16)         \
+    CPU_HOST_UNARY(name, bool, float16)          \
     CPU_HOST_UNARY(name, bool, float32)          \
     CPU_HOST_UNARY(name, bool, float64)          \
     CPU_HOST_NOIMPL(name,bool, complex32)        \
@@ -533,7 +533,7 @@ gm_cpu_host_array_1D_C_##name##_##t0##_##t1(xnd_t stack[], ndt_context_t *ctx) \
     CPU_HOST_UNARY(name, uint8, int32)           \
     CPU_HOST_UNARY(name, uint8, int64)           \
     CPU_HOST_UNARY(name, uint8, bfloat16)        \
-    CPU_HOST_NOIMPL(name, uint8, float16)        \
+    CPU_HOST_UNARY(name, uint8, float16)         \
     CPU_HOST_UNARY(name, uint8, float32)         \
     CPU_HOST_UNARY(name, uint8, float64)         \
     CPU_HOST_NOIMPL(name, uint8, complex32)      \
@@ -563,7 +563,7 @@ gm_cpu_host_array_1D_C_##name##_##t0##_##t1(xnd_t stack[], ndt_context_t *ctx) \
     CPU_HOST_UNARY(name, int8, int32)            \
     CPU_HOST_UNARY(name, int8, int64)            \
     CPU_HOST_UNARY(name, int8, bfloat16)         \
-    CPU_HOST_NOIMPL(name, int8, float16)         \
+    CPU_HOST_UNARY(name, int8, float16)          \
     CPU_HOST_UNARY(name, int8, float32)          \
     CPU_HOST_UNARY(name, int8, float64)          \
     CPU_HOST_NOIMPL(name, int8, complex32)       \
@@ -591,12 +591,12 @@ gm_cpu_host_array_1D_C_##name##_##t0##_##t1(xnd_t stack[], ndt_context_t *ctx) \
     CPU_HOST_UNARY(name, bfloat16, complex64)    \
     CPU_HOST_UNARY(name, bfloat16, complex128)   \
                                                  \
-    CPU_HOST_NOIMPL(name, float16, float16)      \
-    CPU_HOST_NOIMPL(name, float16, float32)      \
-    CPU_HOST_NOIMPL(name, float16, float64)      \
+    CPU_HOST_UNARY(name, float16, float16)       \
+    CPU_HOST_UNARY(name, float16, float32)       \
+    CPU_HOST_UNARY(name, float16, float64)       \
     CPU_HOST_NOIMPL(name, float16, complex32)    \
-    CPU_HOST_NOIMPL(name, float16, complex64)    \
-    CPU_HOST_NOIMPL(name, float16, complex128)   \
+    CPU_HOST_UNARY(name, float16, complex64)     \
+    CPU_HOST_UNARY(name, float16, complex128)    \
                                                  \
     CPU_HOST_UNARY(name, float32, float32)       \
     CPU_HOST_UNARY(name, float32, float64)       \
@@ -785,7 +785,7 @@ CPU_HOST_UNARY(negative, int32, int32)
 CPU_HOST_UNARY(negative, int64, int64)
 
 CPU_HOST_UNARY(negative, bfloat16, bfloat16)
-CPU_HOST_NOIMPL(negative, float16, float16)
+CPU_HOST_UNARY(negative, float16, float16)
 CPU_HOST_UNARY(negative, float32, float32)
 CPU_HOST_UNARY(negative, float64, float64)
 
@@ -827,11 +827,6 @@ static const gm_kernel_init_t unary_negative[] = {
     CPU_HOST_UNARY(name##f16, int8, float16)    \
     CPU_HOST_UNARY(name##f16, float16, float16)
 
-#define _CPU_ALL_HALF_MATH_NOIMPL(name) \
-    CPU_HOST_NOIMPL(name##f16, uint8, float16)   \
-    CPU_HOST_NOIMPL(name##f16, int8, float16)    \
-    CPU_HOST_NOIMPL(name##f16, float16, float16)
-
 #define _CPU_ALL_COMPLEX_MATH(name) \
     CPU_HOST_NOIMPL(name, complex32, complex32)  \
     CPU_HOST_UNARY(name, complex64, complex64)   \
@@ -852,25 +847,15 @@ static const gm_kernel_init_t unary_negative[] = {
     CPU_HOST_UNARY(name, float64, float64)        \
 
 #define CPU_ALL_REAL_MATH(name) \
-    _CPU_ALL_HALF_MATH_NOIMPL(name)    \
+    _CPU_ALL_HALF_MATH(name)           \
     _CPU_ALL_REAL_MATH(name)           \
     _CPU_ALL_COMPLEX_MATH_NOIMPL(name)
 
-#define CPU_ALL_REAL_MATH_WITH_HALF(name) \
-    _CPU_ALL_HALF_MATH(name)              \
-    _CPU_ALL_REAL_MATH(name)              \
-    _CPU_ALL_COMPLEX_MATH_NOIMPL(name)
-
 #define CPU_ALL_COMPLEX_MATH(name) \
-    _CPU_ALL_HALF_MATH_NOIMPL(name) \
+    _CPU_ALL_HALF_MATH(name)        \
     _CPU_ALL_REAL_MATH(name)        \
     _CPU_ALL_COMPLEX_MATH(name)
 
-#define CPU_ALL_COMPLEX_MATH_WITH_HALF(name) \
-    _CPU_ALL_HALF_MATH(name)                 \
-    _CPU_ALL_REAL_MATH(name)                 \
-    _CPU_ALL_COMPLEX_MATH(name)              \
-
 
 #define CPU_ALL_UNARY_MATH_INIT(name) \
     CPU_HOST_UNARY_INIT(name, name##f16, uint8, float16),     \
@@ -1025,6 +1010,267 @@ static const gm_kernel_init_t unary_float[] = {
 };
 
 
+/****************************************************************************/
+/*                                Reductions                                */
+/****************************************************************************/
+
+/*
+ * The result of a reduction over an optional dtype is missing if any of the
+ * inputs is missing.  Return false in that case so that the kernel can skip
+ * the computation.
+ */
+static bool_t
+reduce_bitmap(xnd_t stack[])
+{
+    const int64_t N = xnd_fixed_shape(&stack[0]);
+    const int64_t li0 = stack[0].index;
+    const int64_t li1 = stack[1].index;
+    const int64_t s0 = xnd_fixed_step(&stack[0]);
+    const uint8_t *b0 = get_bitmap1D(&stack[0]);
+    uint8_t *b1 = get_bitmap(&stack[1]);
+    int64_t i, k0;
+
+    assert(b0 != NULL);
+    assert(b1 != NULL);
+
+    if (xnd_bitmap_all_valid(&stack[0].bitmap)) {
+        set_bit(b1, li1, 1);
+        return 1;
+    }
+
+    if (s0 == 1) {
+        const bool_t x = bitmap_all_valid(b0, li0, N);
+        set_bit(b1, li1, x);
+        return x;
+    }
+
+    for (i=0, k0=li0; i<N; i++, k0+=s0) {
+        if (!is_valid(b0, k0)) {
+            set_bit(b1, li1, 0);
+            return 0;
+        }
+    }
+
+    set_bit(b1, li1, 1);
+    return 1;
+}
+
+static int
+reduce_empty_error(const char *name, ndt_context_t *ctx)
+{
+    ndt_err_format(ctx, NDT_ValueError,
+        "zero-size array to reduction operation %s which has no identity",
+        name);
+    return -1;
+}
+
+#define CPU_HOST_REDUCE(name, t0, t1, nonempty) \
+static int                                                                        \
+gm_cpu_host_1D_C_reduce_##name##_##t0##_##t1(xnd_t stack[], ndt_context_t *ctx)   \
+{                                                                                 \
+    const char *a0 = apply_index(&stack[0]);                                      \
+    char *a1 = stack[1].ptr;                                                      \
+    const int64_t N = xnd_fixed_shape(&stack[0]);                                 \
+                                                                                  \
+    if (nonempty && N == 0) {                                                     \
+        return reduce_empty_error(STRINGIZE(name), ctx);                          \
+    }                                                                             \
+                                                                                  \
+    if (ndt_is_optional(ndt_dtype(stack[0].type)) && !reduce_bitmap(stack)) {    \
+        return 0;                                                                 \
+    }                                                                             \
+                                                                                  \
+    gm_cpu_device_1D_C_reduce_##name##_##t0##_##t1(a0, a1, N);                    \
+                                                                                  \
+    return 0;                                                                     \
+}                                                                                 \
+                                                                                  \
+static int                                                                        \
+gm_cpu_host_1D_S_reduce_##name##_##t0##_##t1(xnd_t stack[], ndt_context_t *ctx)   \
+{                                                                                 \
+    const char *a0 = apply_index(&stack[0]);                                      \
+    char *a1 = stack[1].ptr;                                                      \
+    const int64_t N = xnd_fixed_shape(&stack[0]);                                 \
+    const int64_t s0 = xnd_fixed_step(&stack[0]);                                 \
+                                                                                  \
+    if (nonempty && N == 0) {                                                     \
+        return reduce_empty_error(STRINGIZE(name), ctx);                          \
+    }                                                                             \
+                                                                                  \
+    if (ndt_is_optional(ndt_dtype(stack[0].type)) && !reduce_bitmap(stack)) {    \
+        return 0;                                                                 \
+    }                                                                             \
+                                                                                  \
+    gm_cpu_device_1D_S_reduce_##name##_##t0##_##t1(a0, a1, s0, N);                \
+                                                                                  \
+    return 0;                                                                     \
+}
+
+#define CPU_HOST_REDUCE_INIT(func, t0, t1) \
+  { .name = "reduce_" STRINGIZE(func),                                \
+    .sig = "... * N * " STRINGIZE(t0) " -> ... * " STRINGIZE(t1),     \
+    .C = gm_cpu_host_1D_C_reduce_##func##_##t0##_##t1,                \
+    .Xnd = gm_cpu_host_1D_S_reduce_##func##_##t0##_##t1 },            \
+                                                                      \
+  { .name = "reduce_" STRINGIZE(func),                                \
+    .sig = "... * N * ?" STRINGIZE(t0) " -> ... * ?" STRINGIZE(t1),   \
+    .C = gm_cpu_host_1D_C_reduce_##func##_##t0##_##t1,                \
+    .Xnd = gm_cpu_host_1D_S_reduce_##func##_##t0##_##t1 }
+
+/* The widening variants come first, so they are the default result types. */
+#define CPU_HOST_REDUCE_ALL_SUM(name) \
+    CPU_HOST_REDUCE(name, uint8, uint64, 0)              \
+    CPU_HOST_REDUCE(name, uint8, uint8, 0)               \
+    CPU_HOST_REDUCE(name, uint16, uint64, 0)             \
+    CPU_HOST_REDUCE(name, uint16, uint16, 0)             \
+    CPU_HOST_REDUCE(name, uint32, uint64, 0)             \
+    CPU_HOST_REDUCE(name, uint32, uint32, 0)             \
+    CPU_HOST_REDUCE(name, uint64, uint64, 0)             \
+    CPU_HOST_REDUCE(name, int8, int64, 0)                \
+    CPU_HOST_REDUCE(name, int8, int8, 0)                 \
+    CPU_HOST_REDUCE(name, int16, int64, 0)               \
+    CPU_HOST_REDUCE(name, int16, int16, 0)               \
+    CPU_HOST_REDUCE(name, int32, int64, 0)               \
+    CPU_HOST_REDUCE(name, int32, int32, 0)               \
+    CPU_HOST_REDUCE(name, int64, int64, 0)               \
+    CPU_HOST_REDUCE(name, bfloat16, float64, 0)          \
+    CPU_HOST_REDUCE(name, bfloat16, bfloat16, 0)         \
+    CPU_HOST_REDUCE(name, float32, float64, 0)           \
+    CPU_HOST_REDUCE(name, float32, float32, 0)           \
+    CPU_HOST_REDUCE(name, float64, float64, 0)           \
+    CPU_HOST_REDUCE(name, complex64, complex128, 0)      \
+    CPU_HOST_REDUCE(name, complex64, complex64, 0)       \
+    CPU_HOST_REDUCE(name, complex128, complex128, 0)
+
+#define CPU_HOST_REDUCE_ALL_SUM_INIT(name) \
+    CPU_HOST_REDUCE_INIT(name, uint8, uint64),           \
+    CPU_HOST_REDUCE_INIT(name, uint8, uint8),            \
+    CPU_HOST_REDUCE_INIT(name, uint16, uint64),          \
+    CPU_HOST_REDUCE_INIT(name, uint16, uint16),          \
+    CPU_HOST_REDUCE_INIT(name, uint32, uint64),          \
+    CPU_HOST_REDUCE_INIT(name, uint32, uint32),          \
+    CPU_HOST_REDUCE_INIT(name, uint64, uint64),          \
+    CPU_HOST_REDUCE_INIT(name, int8, int64),             \
+    CPU_HOST_REDUCE_INIT(name, int8, int8),              \
+    CPU_HOST_REDUCE_INIT(name, int16, int64),            \
+    CPU_HOST_REDUCE_INIT(name, int16, int16),            \
+    CPU_HOST_REDUCE_INIT(name, int32, int64),            \
+    CPU_HOST_REDUCE_INIT(name, int32, int32),            \
+    CPU_HOST_REDUCE_INIT(name, int64, int64),            \
+    CPU_HOST_REDUCE_INIT(name, bfloat16, float64),       \
+    CPU_HOST_REDUCE_INIT(name, bfloat16, bfloat16),      \
+    CPU_HOST_REDUCE_INIT(name, float32, float64),        \
+    CPU_HOST_REDUCE_INIT(name, float32, float32),        \
+    CPU_HOST_REDUCE_INIT(name, float64, float64),        \
+    CPU_HOST_REDUCE_INIT(name, complex64, complex128),   \
+    CPU_HOST_REDUCE_INIT(name, complex64, complex64),    \
+    CPU_HOST_REDUCE_INIT(name, complex128, complex128)
+
+#define CPU_HOST_REDUCE_ALL_MINMAX(name) \
+    CPU_HOST_REDUCE(name, uint8, uint8, 1)               \
+    CPU_HOST_REDUCE(name, uint16, uint16, 1)             \
+    CPU_HOST_REDUCE(name, uint32, uint32, 1)             \
+    CPU_HOST_REDUCE(name, uint64, uint64, 1)             \
+    CPU_HOST_REDUCE(name, int8, int8, 1)                 \
+    CPU_HOST_REDUCE(name, int16, int16, 1)               \
+    CPU_HOST_REDUCE(name, int32, int32, 1)               \
+    CPU_HOST_REDUCE(name, int64, int64, 1)               \
+    CPU_HOST_REDUCE(name, bfloat16, bfloat16, 1)         \
+    CPU_HOST_REDUCE(name, float32, float32, 1)           \
+    CPU_HOST_REDUCE(name, float64, float64, 1)
+
+#define CPU_HOST_REDUCE_ALL_MINMAX_INIT(name) \
+    CPU_HOST_REDUCE_INIT(name, uint8, uint8),            \
+    CPU_HOST_REDUCE_INIT(name, uint16, uint16),          \
+    CPU_HOST_REDUCE_INIT(name, uint32, uint32),          \
+    CPU_HOST_REDUCE_INIT(name, uint64, uint64),          \
+    CPU_HOST_REDUCE_INIT(name, int8, int8),              \
+    CPU_HOST_REDUCE_INIT(name, int16, int16),            \
+    CPU_HOST_REDUCE_INIT(name, int32, int32),            \
+    CPU_HOST_REDUCE_INIT(name, int64, int64),            \
+    CPU_HOST_REDUCE_INIT(name, bfloat16, bfloat16),      \
+    CPU_HOST_REDUCE_INIT(name, float32, float32),        \
+    CPU_HOST_REDUCE_INIT(name, float64, float64)
+
+#define CPU_HOST_REDUCE_ALL_ARG(name) \
+    CPU_HOST_REDUCE(name, uint8, int64, 1)               \
+    CPU_HOST_REDUCE(name, uint16, int64, 1)              \
+    CPU_HOST_REDUCE(name, uint32, int64, 1)              \
+    CPU_HOST_REDUCE(name, uint64, int64, 1)              \
+    CPU_HOST_REDUCE(name, int8, int64, 1)                \
+    CPU_HOST_REDUCE(name, int16, int64, 1)               \
+    CPU_HOST_REDUCE(name, int32, int64, 1)               \
+    CPU_HOST_REDUCE(name, int64, int64, 1)               \
+    CPU_HOST_REDUCE(name, bfloat16, int64, 1)            \
+    CPU_HOST_REDUCE(name, float32, int64, 1)             \
+    CPU_HOST_REDUCE(name, float64, int64, 1)
+
+#define CPU_HOST_REDUCE_ALL_ARG_INIT(name) \
+    CPU_HOST_REDUCE_INIT(name, uint8, int64),            \
+    CPU_HOST_REDUCE_INIT(name, uint16, int64),           \
+    CPU_HOST_REDUCE_INIT(name, uint32, int64),           \
+    CPU_HOST_REDUCE_INIT(name, uint64, int64),           \
+    CPU_HOST_REDUCE_INIT(name, int8, int64),             \
+    CPU_HOST_REDUCE_INIT(name, int16, int64),            \
+    CPU_HOST_REDUCE_INIT(name, int32, int64),            \
+    CPU_HOST_REDUCE_INIT(name, int64, int64),            \
+    CPU_HOST_REDUCE_INIT(name, bfloat16, int64),         \
+    CPU_HOST_REDUCE_INIT(name, float32, int64),          \
+    CPU_HOST_REDUCE_INIT(name, float64, int64)
+
+#define CPU_HOST_REDUCE_ALL_MEAN(name) \
+    CPU_HOST_REDUCE(name, uint8, float64, 0)             \
+    CPU_HOST_REDUCE(name, uint16, float64, 0)            \
+    CPU_HOST_REDUCE(name, uint32, float64, 0)            \
+    CPU_HOST_REDUCE(name, uint64, float64, 0)            \
+    CPU_HOST_REDUCE(name, int8, float64, 0)              \
+    CPU_HOST_REDUCE(name, int16, float64, 0)             \
+    CPU_HOST_REDUCE(name, int32, float64, 0)             \
+    CPU_HOST_REDUCE(name, int64, float64, 0)             \
+    CPU_HOST_REDUCE(name, bfloat16, bfloat16, 0)         \
+    CPU_HOST_REDUCE(name, float32, float32, 0)           \
+    CPU_HOST_REDUCE(name, float64, float64, 0)           \
+    CPU_HOST_REDUCE(name, complex64, complex64, 0)       \
+    CPU_HOST_REDUCE(name, complex128, complex128, 0)
+
+#define CPU_HOST_REDUCE_ALL_MEAN_INIT(name) \
+    CPU_HOST_REDUCE_INIT(name, uint8, float64),          \
+    CPU_HOST_REDUCE_INIT(name, uint16, float64),         \
+    CPU_HOST_REDUCE_INIT(name, uint32, float64),         \
+    CPU_HOST_REDUCE_INIT(name, uint64, float64),         \
+    CPU_HOST_REDUCE_INIT(name, int8, float64),           \
+    CPU_HOST_REDUCE_INIT(name, int16, float64),          \
+    CPU_HOST_REDUCE_INIT(name, int32, float64),          \
+    CPU_HOST_REDUCE_INIT(name, int64, float64),          \
+    CPU_HOST_REDUCE_INIT(name, bfloat16, bfloat16),      \
+    CPU_HOST_REDUCE_INIT(name, float32, float32),        \
+    CPU_HOST_REDUCE_INIT(name, float64, float64),        \
+    CPU_HOST_REDUCE_INIT(name, complex64, complex64),    \
+    CPU_HOST_REDUCE_INIT(name, complex128, complex128)
+
+CPU_HOST_REDUCE_ALL_SUM(add)
+CPU_HOST_REDUCE_ALL_SUM(multiply)
+CPU_HOST_REDUCE_ALL_MINMAX(min)
+CPU_HOST_REDUCE_ALL_MINMAX(max)
+CPU_HOST_REDUCE_ALL_ARG(argmin)
+CPU_HOST_REDUCE_ALL_ARG(argmax)
+CPU_HOST_REDUCE_ALL_MEAN(mean)
+
+
+static const gm_kernel_init_t unary_reduce[] = {
+  /* REDUCE */
+  CPU_HOST_REDUCE_ALL_SUM_INIT(add),
+  CPU_HOST_REDUCE_ALL_SUM_INIT(multiply),
+  CPU_HOST_REDUCE_ALL_MINMAX_INIT(min),
+  CPU_HOST_REDUCE_ALL_MINMAX_INIT(max),
+  CPU_HOST_REDUCE_ALL_ARG_INIT(argmin),
+  CPU_HOST_REDUCE_ALL_ARG_INIT(argmax),
+  CPU_HOST_REDUCE_ALL_MEAN_INIT(mean),
+
+  { .name = NULL, .sig = NULL }
+};
+
+
 /****************************************************************************/
 /*                         Initialize kernel table                          */
 /****************************************************************************/
@@ -1073,25 +1319,31 @@ gm_init_cpu_unary_kernels(gm_tbl_t *tbl, ndt_context_t *ctx)
     const gm_kernel_init_t *k;
 
     for (k = unary_copy; k->name != NULL; k++) {
-        if (gm_add_kernel_typecheck(tbl, k, ctx, &unary_copy_typecheck) < 0) {
+        if (gm_add_kernel_lazy(tbl, k, ctx, &unary_copy_typecheck) < 0) {
              return -1;
         }
     }
 
     for (k = unary_invert; k->name != NULL; k++) {
-        if (gm_add_kernel_typecheck(tbl, k, ctx, &unary_invert_typecheck) < 0) {
+        if (gm_add_kernel_lazy(tbl, k, ctx, &unary_invert_typecheck) < 0) {
              return -1;
         }
     }
 
     for (k = unary_negative; k->name != NULL; k++) {
-        if (gm_add_kernel_typecheck(tbl, k, ctx, &unary_negative_typecheck) < 0) {
+        if (gm_add_kernel_lazy(tbl, k, ctx, &unary_negative_typecheck) < 0) {
              return -1;
         }
     }
 
     for (k = unary_float; k->name != NULL; k++) {
-        if (gm_add_kernel_typecheck(tbl, k, ctx, &unary_math_typecheck) < 0) {
+        if (gm_add_kernel_lazy(tbl, k, ctx, &unary_math_typecheck) < 0) {
+            return -1;
+        }
+    }
+
+    for (k = unary_reduce; k->name != NULL; k++) {
+        if (gm_add_kernel_lazy(tbl, k, ctx, NULL) < 0) {
             return -1;
         }
     }
@@ -2796,19 +2796,19 @@ gm_init_cuda_binary_kernels(gm_tbl_t *tbl, ndt_context_t *ctx)
     const gm_kernel_init_t *k;
 
     for (k = binary_kernels; k->name != NULL; k++) {
-        if (gm_add_kernel_typecheck(tbl, k, ctx, &binary_typecheck) < 0) {
+        if (gm_add_kernel_lazy(tbl, k, ctx, &binary_typecheck) < 0) {
              return -1;
         }
     }
 
     for (k = bitwise_kernels; k->name != NULL; k++) {
-        if (gm_add_kernel_typecheck(tbl, k, ctx, &bitwise_typecheck) < 0) {
+        if (gm_add_kernel_lazy(tbl, k, ctx, &bitwise_typecheck) < 0) {
              return -1;
         }
     }
 
     for (k = binary_mv_kernels; k->name != NULL; k++) {
-        if (gm_add_kernel(tbl, k, ctx) < 0) {
+        if (gm_add_kernel_lazy(tbl, k, ctx, NULL) < 0) {
              return -1;
         }
     }
@@ -1298,31 +1298,31 @@ gm_init_cuda_unary_kernels(gm_tbl_t *tbl, ndt_context_t *ctx)
     const gm_kernel_init_t *k;
 
     for (k = unary_copy; k->name != NULL; k++) {
-        if (gm_add_kernel_typecheck(tbl, k, ctx, &unary_copy_typecheck) < 0) {
+        if (gm_add_kernel_lazy(tbl, k, ctx, &unary_copy_typecheck) < 0) {
              return -1;
         }
     }
 
     for (k = unary_reduce; k->name != NULL; k++) {
-        if (gm_add_kernel(tbl, k, ctx) < 0) {
+        if (gm_add_kernel_lazy(tbl, k, ctx, NULL) < 0) {
              return -1;
         }
     }
 
     for (k = unary_invert; k->name != NULL; k++) {
-        if (gm_add_kernel_typecheck(tbl, k, ctx, &unary_invert_typecheck) < 0) {
+        if (gm_add_kernel_lazy(tbl, k, ctx, &unary_invert_typecheck) < 0) {
              return -1;
         }
     }
 
     for (k = unary_negative; k->name != NULL; k++) {
-        if (gm_add_kernel_typecheck(tbl, k, ctx, &unary_negative_typecheck) < 0) {
+        if (gm_add_kernel_lazy(tbl, k, ctx, &unary_negative_typecheck) < 0) {
              return -1;
         }
     }
 
     for (k = unary_float; k->name != NULL; k++) {
-        if (gm_add_kernel_typecheck(tbl, k, ctx, &unary_math_typecheck) < 0) {
+        if (gm_add_kernel_lazy(tbl, k, ctx, &unary_math_typecheck) < 0) {
             return -1;
         }
     }
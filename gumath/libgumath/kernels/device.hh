@@ -150,6 +150,20 @@ _divmod(bfloat16_t *q, bfloat16_t *r, bfloat16_t a, bfloat16_t b)
     *r = (bfloat16_t)rr;
 }
 
+#ifndef __CUDACC__
+static inline void
+_divmod(float16_t *q, float16_t *r, float16_t a, float16_t b)
+{
+    float qq;
+    float rr;
+
+    _divmod(&qq, &rr, (float)a, (float)b);
+
+    *q = (float16_t)qq;
+    *r = (float16_t)rr;
+}
+#endif
+
 #define divmod_unsigned(T) \
 static inline DEVICE void     \
 _divmod(T *q, T *r, T a, T b) \
@@ -351,6 +365,12 @@ _pow(half x, half y)
 {
     return __float2half(pow(__half2float(x), __half2float(y)));
 }
+#else
+static inline float16_t
+_pow(float16_t x, float16_t y)
+{
+    return (float16_t)pow((double)x, (double)y);
+}
 #endif
 
 
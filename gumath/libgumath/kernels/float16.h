@@ -0,0 +1,450 @@
+/*
+* BSD 3-Clause License
+*
+* Copyright (c) 2017-2018, plures
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+*    this list of conditions and the following disclaimer in the documentation
+*    and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+#ifndef FLOAT16_H
+#define FLOAT16_H
+
+
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <complex>
+#include "contrib/bfloat16.h"
+#include "isa.h"
+
+#ifdef GM_ISA_DISPATCH
+  #include <immintrin.h>
+#endif
+
+
+/*
+ * IEEE 754 binary16 for the cpu kernels.
+ *
+ * float16 is a storage type: values are converted to float32 and all
+ * arithmetic is done in float32 or float64.  The results are the correctly
+ * rounded float16 results:
+ *
+ *   - +, -, *, / and comparisons are evaluated in float32.  float32 has more
+ *     than 2*11+2 bits of precision, so rounding the float32 result to
+ *     float16 does not suffer from double rounding.
+ *
+ *   - The math functions are evaluated in float64.  The float64 result is
+ *     rounded to odd in float32 and then to nearest in float16, which is
+ *     equivalent to a single rounding of the float64 result.
+ *
+ * The scalar conversions contain no branches or table lookups, so loops over
+ * them vectorize.  The block conversions use F16C in the AVX2 and AVX-512
+ * clones and give bit identical results, including NaN payloads.
+ */
+
+#if defined(__GNUC__)
+  #define F16_INLINE static inline __attribute__((always_inline))
+#else
+  #define F16_INLINE static inline
+#endif
+
+
+namespace gm {
+
+/*****************************************************************************/
+/*                            Scalar conversions                             */
+/*****************************************************************************/
+
+F16_INLINE uint32_t
+as_uint(const float x)
+{
+    uint32_t u;
+    memcpy(&u, &x, sizeof u);
+    return u;
+}
+
+F16_INLINE float
+as_float(const uint32_t u)
+{
+    float x;
+    memcpy(&x, &u, sizeof x);
+    return x;
+}
+
+/* Exact.  NaNs are quieted like vcvtph2ps does. */
+F16_INLINE float
+half_to_float(const uint16_t h)
+{
+    const uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    const uint32_t bits = (uint32_t)(h & 0x7fff) << 13;
+    const uint32_t mant = bits & 0x7fffff;
+
+    /* Rebias the exponent by multiplying with 2**112, subnormals included. */
+    uint32_t u = as_uint(as_float(bits) * as_float(0x77800000));
+    u = (h & 0x7c00) == 0x7c00 ? 0x7f800000 | mant | (mant ? 0x400000 : 0) : u;
+
+    return as_float(u | sign);
+}
+
+/* Round to nearest even.  NaNs keep the upper payload bits like vcvtps2ph. */
+F16_INLINE uint16_t
+float_to_half(const float x)
+{
+    const uint32_t v = as_uint(x);
+    const uint32_t sign = (v >> 16) & 0x8000;
+    const uint32_t u = v & 0x7fffffff;
+
+    /* Normal results: rebias the exponent and round the mantissa. */
+    uint32_t n = u - (112U << 23);
+    n = (n + 0xfff + ((n >> 13) & 1)) >> 13;
+
+    /* Subnormal results: the addition rounds to a multiple of 2**-24. */
+    const uint32_t s = as_uint(as_float(u) + 0.5f) - 0x3f000000;
+
+    uint32_t h = u < 0x38800000 ? s : n;
+    h = u >= 0x477ff000 ? 0x7c00 : h;
+    h = u > 0x7f800000 ? 0x7e00 | ((u >> 13) & 0x3ff) : h;
+
+    return (uint16_t)(h | sign);
+}
+
+/*
+ * Round to float32 with the sticky bit in the last place (round to odd).  A
+ * subsequent rounding to float16 then equals the direct rounding of x.
+ */
+F16_INLINE float
+round_to_odd(const double x)
+{
+    const float f = (float)x;
+    const double y = (double)f;
+    const uint32_t inexact = y != x && x == x;
+    const uint32_t toward_zero = std::fabs(y) > std::fabs(x);
+
+    return as_float(((as_uint(f) - (inexact & toward_zero)) | inexact));
+}
+
+F16_INLINE uint16_t
+double_to_half(const double x)
+{
+    return float_to_half(round_to_odd(x));
+}
+
+/* Matches tf::bfloat16::round_to_bfloat16(). */
+F16_INLINE uint16_t
+float_to_bfloat16(const float x)
+{
+    const uint32_t u = as_uint(x);
+    const uint32_t r = (u + 0x7fff + ((u >> 16) & 1)) >> 16;
+
+    return (uint16_t)(x != x ? 0x7fc0 : r);
+}
+
+F16_INLINE float
+bfloat16_to_float(const uint16_t b)
+{
+    return as_float((uint32_t)b << 16);
+}
+
+
+/*****************************************************************************/
+/*                                  float16                                  */
+/*****************************************************************************/
+
+struct float16 {
+    uint16_t value;
+
+    float16() : value(0) {}
+    explicit float16(const float x) : value(float_to_half(x)) {}
+    explicit float16(const double x) : value(double_to_half(x)) {}
+    template <class T>
+    explicit float16(const T& x) : value(double_to_half(static_cast<double>(x))) {}
+
+    template <class T>
+    explicit operator T() const { return static_cast<T>(half_to_float(value)); }
+};
+
+inline float16 operator+(const float16 a, const float16 b) { return float16((float)a + (float)b); }
+inline float16 operator-(const float16 a, const float16 b) { return float16((float)a - (float)b); }
+inline float16 operator*(const float16 a, const float16 b) { return float16((float)a * (float)b); }
+inline float16 operator/(const float16 a, const float16 b) { return float16((float)a / (float)b); }
+
+inline float16
+operator-(const float16 a)
+{
+    float16 r;
+    r.value = a.value ^ 0x8000;
+    return r;
+}
+
+inline bool operator<(const float16 a, const float16 b) { return (float)a < (float)b; }
+inline bool operator<=(const float16 a, const float16 b) { return (float)a <= (float)b; }
+inline bool operator==(const float16 a, const float16 b) { return (float)a == (float)b; }
+inline bool operator!=(const float16 a, const float16 b) { return (float)a != (float)b; }
+inline bool operator>(const float16 a, const float16 b) { return (float)a > (float)b; }
+inline bool operator>=(const float16 a, const float16 b) { return (float)a >= (float)b; }
+
+
+/*****************************************************************************/
+/*                               Math functions                              */
+/*****************************************************************************/
+
+/*
+ * gm::name is overloaded for float, double, bfloat16 and float16, so the
+ * kernel loops can call it both on the stored and on the widened types.
+ */
+#define GM_HALF_FUNCTION(name) \
+using std::name;                                                      \
+using tf::name;                                                       \
+inline float16 name(const float16 a) { return float16(std::name((double)a)); }
+
+inline float16
+fabs(const float16 a)
+{
+    float16 r;
+    r.value = a.value & 0x7fff;
+    return r;
+}
+
+using std::fabs;
+using tf::fabs;
+GM_HALF_FUNCTION(exp)
+GM_HALF_FUNCTION(exp2)
+GM_HALF_FUNCTION(expm1)
+GM_HALF_FUNCTION(log)
+GM_HALF_FUNCTION(log2)
+GM_HALF_FUNCTION(log10)
+GM_HALF_FUNCTION(log1p)
+GM_HALF_FUNCTION(logb)
+GM_HALF_FUNCTION(sqrt)
+GM_HALF_FUNCTION(cbrt)
+GM_HALF_FUNCTION(sin)
+GM_HALF_FUNCTION(cos)
+GM_HALF_FUNCTION(tan)
+GM_HALF_FUNCTION(asin)
+GM_HALF_FUNCTION(acos)
+GM_HALF_FUNCTION(atan)
+GM_HALF_FUNCTION(sinh)
+GM_HALF_FUNCTION(cosh)
+GM_HALF_FUNCTION(tanh)
+GM_HALF_FUNCTION(asinh)
+GM_HALF_FUNCTION(acosh)
+GM_HALF_FUNCTION(atanh)
+GM_HALF_FUNCTION(erf)
+GM_HALF_FUNCTION(erfc)
+GM_HALF_FUNCTION(lgamma)
+GM_HALF_FUNCTION(tgamma)
+GM_HALF_FUNCTION(ceil)
+GM_HALF_FUNCTION(floor)
+GM_HALF_FUNCTION(trunc)
+GM_HALF_FUNCTION(round)
+GM_HALF_FUNCTION(nearbyint)
+
+
+/*****************************************************************************/
+/*                             Block conversions                             */
+/*****************************************************************************/
+
+/*
+ * The contiguous kernels convert float16 and bfloat16 operands to float in
+ * blocks of GM_HALF_BLOCKSIZE, compute on the float buffers and convert the
+ * results back in one pass.
+ */
+#define GM_HALF_BLOCKSIZE 256
+
+F16_INLINE void
+half_load_base(const float16 *x, float *y, const int64_t n)
+{
+    for (int64_t k = 0; k < n; k++) {
+        y[k] = half_to_float(x[k].value);
+    }
+}
+
+F16_INLINE void
+half_store_base(float16 *x, const float *y, const int64_t n)
+{
+    for (int64_t k = 0; k < n; k++) {
+        x[k].value = float_to_half(y[k]);
+    }
+}
+
+#ifdef GM_ISA_DISPATCH
+static inline GM_TARGET_AVX2 void
+half_load_avx2(const float16 *x, float *y, const int64_t n)
+{
+    const int64_t m = n - n % 8;
+    int64_t k;
+
+    for (k = 0; k < m; k += 8) {
+        const __m128i h = _mm_loadu_si128((const __m128i *)(x + k));
+        _mm256_storeu_ps(y + k, _mm256_cvtph_ps(h));
+    }
+    for (; k < n; k++) {
+        y[k] = half_to_float(x[k].value);
+    }
+}
+
+static inline GM_TARGET_AVX2 void
+half_store_avx2(float16 *x, const float *y, const int64_t n)
+{
+    const int64_t m = n - n % 8;
+    int64_t k;
+
+    for (k = 0; k < m; k += 8) {
+        const __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(y + k),
+                                          _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128((__m128i *)(x + k), h);
+    }
+    for (; k < n; k++) {
+        x[k].value = float_to_half(y[k]);
+    }
+}
+
+static inline GM_TARGET_AVX512 void
+half_load_avx512(const float16 *x, float *y, const int64_t n)
+{
+    const int64_t m = n - n % 16;
+    int64_t k;
+
+    for (k = 0; k < m; k += 16) {
+        const __m256i h = _mm256_loadu_si256((const __m256i *)(x + k));
+        _mm512_storeu_ps(y + k, _mm512_maskz_cvtph_ps(0xffff, h));
+    }
+    for (; k < n; k++) {
+        y[k] = half_to_float(x[k].value);
+    }
+}
+
+static inline GM_TARGET_AVX512 void
+half_store_avx512(float16 *x, const float *y, const int64_t n)
+{
+    const int64_t m = n - n % 16;
+    int64_t k;
+
+    for (k = 0; k < m; k += 16) {
+        const __m256i h = _mm512_maskz_cvtps_ph(0xffff, _mm512_loadu_ps(y + k),
+                                                _MM_FROUND_TO_NEAREST_INT);
+        _mm256_storeu_si256((__m256i *)(x + k), h);
+    }
+    for (; k < n; k++) {
+        x[k].value = float_to_half(y[k]);
+    }
+}
+#endif
+
+F16_INLINE void
+bfloat16_load(const tf::bfloat16 *x, float *y, const int64_t n)
+{
+    for (int64_t k = 0; k < n; k++) {
+        y[k] = bfloat16_to_float(x[k].value);
+    }
+}
+
+F16_INLINE void
+bfloat16_store(tf::bfloat16 *x, const float *y, const int64_t n)
+{
+    for (int64_t k = 0; k < n; k++) {
+        x[k].value = float_to_bfloat16(y[k]);
+    }
+}
+
+/* Buffer type of a block loop operand. */
+template <class T>
+struct half_wide {
+    typedef T type;
+    static const bool value = false;
+};
+
+template <>
+struct half_wide<float16> {
+    typedef float type;
+    static const bool value = true;
+};
+
+template <>
+struct half_wide<tf::bfloat16> {
+    typedef float type;
+    static const bool value = true;
+};
+
+/* Results go to the buffer for half types and to the output otherwise. */
+template <class T>
+static inline T *half_out(T *x, T *) { return x; }
+static inline float *half_out(float16 *, float *buf) { return buf; }
+static inline float *half_out(tf::bfloat16 *, float *buf) { return buf; }
+
+/*
+ * half_widen_<isa>() returns the operand as a pointer to its buffer type,
+ * half_narrow_<isa>() writes back a buffer.  Both are no-ops for types that
+ * are not widened.
+ */
+#define GM_HALF_BLOCK(isa, target) \
+template <class T>                                                          \
+static inline const T *                                                     \
+half_widen_##isa(const T *x, T *, const int64_t) { return x; }              \
+                                                                            \
+static inline target const float *                                          \
+half_widen_##isa(const float16 *x, float *buf, const int64_t n)             \
+{                                                                           \
+    half_load_##isa(x, buf, n);                                             \
+    return buf;                                                             \
+}                                                                           \
+                                                                            \
+static inline target const float *                                          \
+half_widen_##isa(const tf::bfloat16 *x, float *buf, const int64_t n)        \
+{                                                                           \
+    bfloat16_load(x, buf, n);                                               \
+    return buf;                                                             \
+}                                                                           \
+                                                                            \
+template <class T>                                                          \
+static inline void                                                          \
+half_narrow_##isa(T *, const T *, const int64_t) {}                         \
+                                                                            \
+static inline target void                                                   \
+half_narrow_##isa(float16 *x, const float *buf, const int64_t n)            \
+{                                                                           \
+    half_store_##isa(x, buf, n);                                            \
+}                                                                           \
+                                                                            \
+static inline target void                                                   \
+half_narrow_##isa(tf::bfloat16 *x, const float *buf, const int64_t n)       \
+{                                                                           \
+    bfloat16_store(x, buf, n);                                              \
+}
+
+GM_HALF_BLOCK(base, )
+#ifdef GM_ISA_DISPATCH
+GM_HALF_BLOCK(avx2, GM_TARGET_AVX2)
+GM_HALF_BLOCK(avx512, GM_TARGET_AVX512)
+#endif
+
+} /* namespace gm */
+
+
+#endif /* FLOAT16_H */
@@ -0,0 +1,110 @@
+/*
+* BSD 3-Clause License
+*
+* Copyright (c) 2017-2018, plures
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright notice,
+*    this list of conditions and the following disclaimer in the documentation
+*    and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+#ifndef ISA_H
+#define ISA_H
+
+
+/*
+ * Runtime instruction set dispatch for the cpu device kernels.
+ *
+ * The vectorizable kernels are compiled for the baseline of the build (SSE2
+ * on x86-64, NEON on aarch64) and, on x86 with gcc or clang, additionally
+ * for AVX2 and AVX-512.  Both levels include F16C for the float16 kernels.
+ * gm_init() selects the level once from CPUID, so the library can be built
+ * without -march=native and still use the full vector width of the machine
+ * it runs on.
+ */
+
+#define GM_ISA_BASE   0
+#define GM_ISA_AVX2   1
+#define GM_ISA_AVX512 2
+
+/*
+ * AVX-512 implies FMA.  gcc contracts a*b+c by default in C++, which would
+ * make the results depend on the selected level, so contraction is disabled
+ * in the clones.
+ */
+#if defined(__GNUC__) && !defined(__clang__)
+  #define GM_NO_FP_CONTRACT optimize("fp-contract=off"),
+#else
+  #define GM_NO_FP_CONTRACT
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+    !defined(__CUDACC__)
+  #define GM_ISA_DISPATCH
+  #define GM_TARGET_AVX2 \
+    __attribute__((target("avx2,f16c"), GM_NO_FP_CONTRACT flatten))
+  #define GM_TARGET_AVX512 \
+    __attribute__((target("avx512f,avx512bw,avx512vl,avx512dq,f16c"), \
+                   GM_NO_FP_CONTRACT flatten))
+#endif
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Selected level, written only by gm_init() and gm_set_isa(). */
+extern int gm_isa_level;
+
+/* Use libm instead of vmath.h, written only by gm_set_strict_math(). */
+extern int gm_strict_math;
+
+#ifdef __cplusplus
+} /* END extern "C" */
+#endif
+
+
+/*
+ * Call the clone f##_base, f##_avx2 or f##_avx512 that matches the selected
+ * level.  The clones are generated by the kernel macros.
+ */
+#ifdef GM_ISA_DISPATCH
+  #define GM_ISA_CALL(f, args) \
+    switch (gm_isa_level) {                      \
+    case GM_ISA_AVX512: f##_avx512 args; break;  \
+    case GM_ISA_AVX2: f##_avx2 args; break;      \
+    default: f##_base args; break;               \
+    }
+#else
+  #define GM_ISA_CALL(f, args) f##_base args;
+#endif
+
+/* Call the baseline clone f##_base of a kernel that has no other clones. */
+#define GM_ISA_CALL_BASE(f, args) f##_base args;
+
+
+#endif /* ISA_H */
@@ -0,0 +1,351 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2017-2018, plures
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ndtypes.h"
+#include "xnd.h"
+#include "gumath.h"
+
+
+/*
+ * Compiled signature matchers.  ndt_typecheck() walks the signature tree and
+ * keeps symbol bindings in a symbol table.  For most gufunc signatures the
+ * walk is the same every time: select an argument, strip the broadcast dims,
+ * compare a few shapes and a dtype.  The matcher flattens that walk into a
+ * linear program when the kernel is added.
+ *
+ * The program is a rejection filter: if gm_matcher_reject() returns true,
+ * ndt_typecheck() is guaranteed to fail for the same arguments.  Parts of
+ * a signature that the program cannot express are simply not checked, so
+ * ndt_typecheck() remains the authority and still computes the apply spec
+ * for the kernel that is finally selected.
+ */
+
+
+/******************************************************************************/
+/*                                   Program                                  */
+/******************************************************************************/
+
+#define GM_MATCHER_MAX_SYMBOLS 16
+
+enum gm_op {
+  OpArg,      /* select types[arg]; value: inner ndim of the ellipsis type */
+  OpFixed,    /* fixed dimension; value: shape */
+  OpSymbol,   /* symbolic dimension; value: symbol slot */
+  OpDtype,    /* primitive dtype; value: type tag */
+  OpOption    /* any other dtype, only the option flag is checked */
+};
+
+typedef struct {
+    uint8_t op;
+    bool opt;       /* OpArg: unnamed ellipsis, otherwise: option type */
+    int16_t arg;
+    int64_t value;
+} gm_instr_t;
+
+struct _gm_matcher {
+    int nin;
+    int nout;
+    int ninstr;
+    gm_instr_t *code;
+};
+
+typedef struct {
+    int nsymbols;
+    const char *names[GM_MATCHER_MAX_SYMBOLS];
+} symbols_t;
+
+static bool
+is_primitive(enum ndt tag)
+{
+    switch (tag) {
+    case Bool:
+    case Int8: case Int16: case Int32: case Int64:
+    case Uint8: case Uint16: case Uint32: case Uint64:
+    case BFloat16: case Float16: case Float32: case Float64:
+    case BComplex32: case Complex32: case Complex64: case Complex128:
+    case String:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static int
+symbol_slot(symbols_t *s, const char *name)
+{
+    for (int i = 0; i < s->nsymbols; i++) {
+        if (strcmp(s->names[i], name) == 0) {
+            return i;
+        }
+    }
+
+    if (s->nsymbols == GM_MATCHER_MAX_SYMBOLS) {
+        return -1;
+    }
+
+    s->names[s->nsymbols] = name;
+    return s->nsymbols++;
+}
+
+static void
+emit(gm_instr_t *code, int *n, enum gm_op op, bool opt, int arg, int64_t value)
+{
+    gm_instr_t *x = &code[(*n)++];
+
+    x->op = (uint8_t)op;
+    x->opt = opt;
+    x->arg = (int16_t)arg;
+    x->value = value;
+}
+
+/*
+ * Emit the instructions for one signature argument.  Compilation of the
+ * argument stops at the first construct that has no instruction: everything
+ * emitted so far is a necessary condition for a match.
+ */
+static void
+compile_arg(gm_instr_t *code, int *n, symbols_t *s, const ndt_t *p, int arg)
+{
+    int slot;
+
+    if (p->tag == EllipsisDim) {
+        if (p->EllipsisDim.name != NULL) {
+            return;
+        }
+        emit(code, n, OpArg, true, arg, p->EllipsisDim.type->ndim);
+        p = p->EllipsisDim.type;
+    }
+    else {
+        emit(code, n, OpArg, false, arg, 0);
+    }
+
+    while (1) {
+        const bool opt = ndt_is_optional(p);
+
+        switch (p->tag) {
+        case FixedDim:
+            emit(code, n, OpFixed, opt, arg, p->FixedDim.shape);
+            p = p->FixedDim.type;
+            break;
+        case SymbolicDim:
+            slot = symbol_slot(s, p->SymbolicDim.name);
+            if (slot < 0) {
+                return;
+            }
+            emit(code, n, OpSymbol, opt, arg, slot);
+            p = p->SymbolicDim.type;
+            break;
+        default:
+            if (p->ndim > 0) {
+                return;
+            }
+            emit(code, n, is_primitive(p->tag) ? OpDtype : OpOption, opt,
+                 arg, p->tag);
+            return;
+        }
+    }
+}
+
+/*
+ * Compile the signature of a kernel.  Returns NULL if the signature is not
+ * a function type or if memory is exhausted; the caller then falls back to
+ * ndt_typecheck() alone.
+ */
+gm_matcher_t *
+gm_matcher_new(const ndt_t *sig)
+{
+    gm_matcher_t *m;
+    symbols_t symbols;
+    int64_t nargs, len;
+
+    if (sig->tag != Function) {
+        return NULL;
+    }
+
+    nargs = sig->Function.nargs;
+    if (nargs > INT16_MAX) {
+        return NULL;
+    }
+
+    /* one OpArg per argument plus at most one instruction per dimension */
+    len = nargs;
+    for (int64_t i = 0; i < nargs; i++) {
+        len += sig->Function.types[i]->ndim + 1;
+    }
+
+    m = ndt_alloc_size(sizeof *m);
+    if (m == NULL) {
+        return NULL;
+    }
+
+    m->code = ndt_alloc(len, sizeof *m->code);
+    if (m->code == NULL) {
+        ndt_free(m);
+        return NULL;
+    }
+
+    m->nin = (int)sig->Function.nin;
+    m->nout = (int)sig->Function.nout;
+    m->ninstr = 0;
+
+    symbols.nsymbols = 0;
+    for (int64_t i = 0; i < nargs; i++) {
+        compile_arg(m->code, &m->ninstr, &symbols, sig->Function.types[i],
+                    (int)i);
+    }
+
+    return m;
+}
+
+void
+gm_matcher_del(gm_matcher_t *m)
+{
+    if (m == NULL) {
+        return;
+    }
+
+    ndt_free(m->code);
+    ndt_free(m);
+}
+
+
+/******************************************************************************/
+/*                                 Interpreter                                */
+/******************************************************************************/
+
+/*
+ * Return true if ndt_typecheck() cannot succeed for the signature of 'm' and
+ * the given arguments.  A false result means that the arguments may match.
+ */
+bool
+gm_matcher_reject(const gm_matcher_t *m, const ndt_t *types[], int nin, int nout,
+                  bool check_broadcast)
+{
+    int64_t shapes[GM_MATCHER_MAX_SYMBOLS];
+    uint32_t bound = 0;
+    const ndt_t *c = NULL;
+    bool skip = false;
+
+    if (nin != m->nin || (nout && nout != m->nout)) {
+        return true;
+    }
+
+    /* invalid arguments: leave the error to ndt_typecheck() */
+    if (!nout && check_broadcast) {
+        return false;
+    }
+
+    for (int i = 0; i < m->ninstr; i++) {
+        const gm_instr_t *x = &m->code[i];
+
+        if (x->op == OpArg) {
+            /* inferred 'out' arguments are not checked */
+            skip = x->arg >= nin+nout;
+            if (skip) {
+                continue;
+            }
+
+            c = types[x->arg];
+            if (ndt_is_abstract(c)) {
+                return true;
+            }
+
+            if (x->opt) {
+                if (c->ndim < x->value) {
+                    return true;
+                }
+                while (c->ndim > x->value) {
+                    if (c->tag != FixedDim) {
+                        return true;
+                    }
+                    c = c->FixedDim.type;
+                }
+            }
+
+            continue;
+        }
+
+        if (skip) {
+            continue;
+        }
+
+        while (c->tag == VarDimElem) {
+            c = c->VarDimElem.type;
+        }
+
+        if (ndt_is_optional(c) != x->opt) {
+            return true;
+        }
+
+        switch (x->op) {
+        case OpFixed:
+            if (c->tag != FixedDim || c->FixedDim.shape != x->value) {
+                return true;
+            }
+            c = c->FixedDim.type;
+            break;
+        case OpSymbol: {
+            const uint32_t bit = (uint32_t)1 << x->value;
+            if (c->tag != FixedDim) {
+                return true;
+            }
+            if (bound & bit) {
+                if (shapes[x->value] != c->FixedDim.shape) {
+                    return true;
+                }
+            }
+            else {
+                shapes[x->value] = c->FixedDim.shape;
+                bound |= bit;
+            }
+            c = c->FixedDim.type;
+            break;
+        }
+        case OpDtype:
+            if (c->tag != (enum ndt)x->value) {
+                return true;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    return false;
+}
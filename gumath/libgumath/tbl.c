@@ -215,6 +215,8 @@ gm_init(void)
 
     if (!initialized) {
         init_charmap();
+        gm_init_isa();
+        xnd_set_copy_thread(gm_copy_thread);
     }
     else {
         fprintf(stderr, "gm_init: warning: ignoring attempt to initialize "
@@ -38,23 +38,63 @@
 #include "ndtypes.h"
 #include "xnd.h"
 #include "gumath.h"
+#ifndef _MSC_VER
 #include "config.h"
+#endif
+
+
+/*
+ * Upper bound for the number of threads (including the calling threads) that
+ * work on gufunc calls at any given time.  The bound is shared by all
+ * application threads, so concurrent callers do not oversubscribe the cpu.
+ */
+static int64_t max_threads = 1;
 
 
 #ifdef HAVE_PTHREAD_H
 #include <pthread.h>
 
+struct job {
+    int pending;
+    pthread_cond_t done;
+};
+
 struct thread_info {
-    pthread_t tid;
+    struct thread_info *next;
+    struct job *job;
     int tnum;
     int nrows;
-    int ncols;
-    const gm_kernel_t *kernel;
+    const gm_kernel_t *kernel; /* NULL for copies */
     xnd_t **slices;
     int outer_dims;
+    uint32_t flags;            /* xnd_copy() flags */
     ndt_context_t ctx;
 };
 
+/*
+ * Process-wide worker pool.  Workers are created lazily and are parked on
+ * 'wakeup' while the task queue is empty.  'busy' is the number of helper
+ * slots that are currently reserved by running gufunc calls.  The invariant
+ * nworkers >= busy guarantees that every queued task has an idle worker.
+ */
+static struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t wakeup;
+    struct thread_info *head;
+    struct thread_info *tail;
+    int64_t nworkers;
+    int64_t busy;
+} pool = {
+  .mutex=PTHREAD_MUTEX_INITIALIZER,
+  .wakeup=PTHREAD_COND_INITIALIZER,
+  .head=NULL,
+  .tail=NULL,
+  .nworkers=0,
+  .busy=0
+};
+
+static pthread_once_t pool_once = PTHREAD_ONCE_INIT;
+
 static void
 init_static_context(ndt_context_t *ctx)
 {
@@ -78,111 +118,445 @@ clear_all_slices(xnd_t *slices[], int *nslices, int stop)
     }
 }
 
-static void *
-apply_thread(void *arg)
+static void
+run_task(struct thread_info *tinfo)
 {
-    struct thread_info *tinfo = arg;
     ALLOCA(xnd_t, stack, tinfo->nrows);
 
     for (int i = 0; i < tinfo->nrows; i++) {
         stack[i] = tinfo->slices[i][tinfo->tnum];
     }
 
-    gm_apply(tinfo->kernel, stack, tinfo->outer_dims, &tinfo->ctx);
+    if (tinfo->kernel == NULL) {
+        (void)xnd_copy_serial(&stack[0], &stack[1], tinfo->flags, &tinfo->ctx);
+    }
+    else {
+        (void)gm_apply(tinfo->kernel, stack, tinfo->outer_dims, &tinfo->ctx);
+    }
+}
+
+
+/******************************************************************************/
+/*                                 Worker pool                                */
+/******************************************************************************/
+
+static void
+pool_prepare_fork(void)
+{
+    pthread_mutex_lock(&pool.mutex);
+}
+
+static void
+pool_parent_fork(void)
+{
+    pthread_mutex_unlock(&pool.mutex);
+}
+
+/* The workers do not exist in the child, start with an empty pool. */
+static void
+pool_child_fork(void)
+{
+    pthread_mutex_init(&pool.mutex, NULL);
+    pthread_cond_init(&pool.wakeup, NULL);
+    pool.head = pool.tail = NULL;
+    pool.nworkers = 0;
+    pool.busy = 0;
+}
+
+static void
+pool_init_once(void)
+{
+    (void)pthread_atfork(pool_prepare_fork, pool_parent_fork, pool_child_fork);
+}
+
+static void *
+worker(void *arg GM_UNUSED)
+{
+    pthread_mutex_lock(&pool.mutex);
+
+    for (;;) {
+        struct thread_info *tinfo;
+
+        while (pool.head == NULL) {
+            pthread_cond_wait(&pool.wakeup, &pool.mutex);
+        }
+
+        tinfo = pool.head;
+        pool.head = tinfo->next;
+        if (pool.head == NULL) {
+            pool.tail = NULL;
+        }
+
+        pthread_mutex_unlock(&pool.mutex);
+        run_task(tinfo);
+        pthread_mutex_lock(&pool.mutex);
+
+        if (--tinfo->job->pending == 0) {
+            pthread_cond_signal(&tinfo->job->done);
+        }
+    }
+
     return NULL;
 }
 
-int
-gm_apply_thread(const gm_kernel_t *kernel, xnd_t stack[], int outer_dims,
-                const int64_t nthreads, ndt_context_t *ctx)
+/* Requires the pool lock. */
+static int
+spawn_worker(void)
 {
-    const int nrows = (int)kernel->set->sig->Function.nargs;
-    ALLOCA(xnd_t *, slices, nrows);
-    ALLOCA(int, nslices, nrows);
-    struct thread_info *tinfo;
-    int ncols, tnum;
-    bool use_threads = true;
+    pthread_attr_t attr;
+    pthread_t tid;
+    int ret;
 
-    if (nthreads <= 1 || nrows == 0 || outer_dims == 0) {
-        use_threads = false;
+    if (pthread_attr_init(&attr) != 0) {
+        return -1;
     }
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
 
-    for (int i = 0; i < nrows; i++) {
-        const ndt_t *t = stack[i].type;
-        if (!ndt_is_ndarray(t) || ndt_nelem(t) < GM_THREAD_CUTOFF) {
-            use_threads = false;
+    ret = pthread_create(&tid, &attr, worker, NULL);
+    pthread_attr_destroy(&attr);
+
+    if (ret != 0) {
+        return -1;
+    }
+
+    pool.nworkers++;
+    return 0;
+}
+
+/*
+ * Reserve up to 'nthreads-1' helper threads from the global budget. Return
+ * the number of reserved helpers, which may be zero if all threads are busy.
+ */
+static int64_t
+pool_reserve(int64_t nthreads)
+{
+    int64_t n;
+
+    pthread_once(&pool_once, pool_init_once);
+    pthread_mutex_lock(&pool.mutex);
+
+    n = max_threads - 1 - pool.busy;
+    if (n > nthreads - 1) {
+        n = nthreads - 1;
+    }
+    if (n < 0) {
+        n = 0;
+    }
+
+    pool.busy += n;
+
+    while (pool.nworkers < pool.busy) {
+        if (spawn_worker() < 0) {
+            const int64_t shortfall = pool.busy - pool.nworkers;
+            pool.busy -= shortfall;
+            n -= shortfall;
+            break;
         }
     }
 
-    if (!use_threads) {
-        return gm_apply(kernel, stack, outer_dims, ctx);
+    pthread_mutex_unlock(&pool.mutex);
+
+    return n;
+}
+
+static void
+pool_release(int64_t n)
+{
+    pthread_mutex_lock(&pool.mutex);
+    pool.busy -= n;
+    pthread_mutex_unlock(&pool.mutex);
+}
+
+/* Requires the pool lock. */
+static void
+pool_push(struct thread_info *tinfo)
+{
+    tinfo->next = NULL;
+
+    if (pool.tail == NULL) {
+        pool.head = pool.tail = tinfo;
+    }
+    else {
+        pool.tail->next = tinfo;
+        pool.tail = tinfo;
     }
+}
+
+
+/******************************************************************************/
+/*                               Threaded apply                               */
+/******************************************************************************/
 
+int64_t
+gm_get_max_threads(void)
+{
+    int64_t n;
+
+    pthread_mutex_lock(&pool.mutex);
+    n = max_threads;
+    pthread_mutex_unlock(&pool.mutex);
+
+    return n;
+}
+
+int
+gm_set_max_threads(int64_t n, ndt_context_t *ctx)
+{
+    if (n <= 0) {
+        ndt_err_format(ctx, NDT_ValueError,
+            "max_threads must be greater than 0");
+        return -1;
+    }
+
+    /* Surplus workers stay parked, the budget alone limits parallelism. */
+    pthread_mutex_lock(&pool.mutex);
+    max_threads = n;
+    pthread_mutex_unlock(&pool.mutex);
+
+    return 0;
+}
+
+/*
+ * Split all rows of 'stack' into the same number of slices and run them on
+ * the calling thread and 'nhelpers' reserved workers.  Releases the workers.
+ */
+static int
+run_threads(const gm_kernel_t *kernel, xnd_t stack[], int nrows, int outer_dims,
+            uint32_t flags, int64_t nhelpers, ndt_context_t *ctx)
+{
+    ALLOCA(xnd_t *, slices, nrows);
+    ALLOCA(int, nslices, nrows);
+    struct thread_info *tinfo;
+    struct job job;
+    int ncols, tnum;
+
+    ncols = 0;
     for (int i = 0; i < nrows; i++) {
-        int64_t ncols = nthreads;
-        slices[i] = xnd_split(&stack[i], &ncols, outer_dims, ctx);
+        int64_t n = nhelpers + 1;
+        slices[i] = xnd_split(&stack[i], &n, outer_dims, ctx);
         if (ndt_err_occurred(ctx)) {
             clear_all_slices(slices, nslices, i);
+            pool_release(nhelpers);
             return -1;
         }
-        nslices[i] = ncols;
+        nslices[i] = (int)n;
+        if (i == 0) {
+            ncols = nslices[0];
+        }
     }
 
-    ncols = nslices[0];
     for (int i = 1; i < nrows; i++) {
         if (nslices[i] != ncols) {
             clear_all_slices(slices, nslices, nrows);
+            pool_release(nhelpers);
             ndt_err_format(ctx, NDT_RuntimeError,
                 "equal subdivision in threaded apply loop failed");
             return -1;
         }
     }
 
-    tinfo = ndt_calloc(nthreads, sizeof *tinfo);
+    tinfo = ndt_calloc(ncols, sizeof *tinfo);
     if (tinfo == NULL) {
         clear_all_slices(slices, nslices, nrows);
+        pool_release(nhelpers);
         (void)ndt_memory_error(ctx);
         return -1;
     }
 
+    job.pending = ncols-1;
+    if (pthread_cond_init(&job.done, NULL) != 0) {
+        clear_all_slices(slices, nslices, nrows);
+        pool_release(nhelpers);
+        ndt_free(tinfo);
+        ndt_err_format(ctx, NDT_RuntimeError, "could not initialize condition");
+        return -1;
+    }
+
     for (tnum = 0; tnum < ncols; tnum++) {
+        tinfo[tnum].job = &job;
         tinfo[tnum].tnum = tnum;
         tinfo[tnum].kernel = kernel;
         tinfo[tnum].nrows = nrows;
-        tinfo[tnum].ncols = ncols;
         tinfo[tnum].slices = slices;
         tinfo[tnum].outer_dims = outer_dims;
+        tinfo[tnum].flags = flags;
         init_static_context(&tinfo[tnum].ctx);
+    }
 
-        int ret = pthread_create(&tinfo[tnum].tid, NULL, &apply_thread,
-                                 &tinfo[tnum]);
-        if (ret != 0) {
-            clear_all_slices(slices, nslices, nrows);
-            ndt_free(tinfo);
-            ndt_err_format(ctx, NDT_RuntimeError, "could not create thread");
-            return -1;
-        }
+    /* The calling thread processes the first slice. */
+    pthread_mutex_lock(&pool.mutex);
+    for (tnum = 1; tnum < ncols; tnum++) {
+        pool_push(&tinfo[tnum]);
     }
+    pthread_cond_broadcast(&pool.wakeup);
+    pthread_mutex_unlock(&pool.mutex);
+
+    run_task(&tinfo[0]);
+
+    pthread_mutex_lock(&pool.mutex);
+    while (job.pending > 0) {
+        pthread_cond_wait(&job.done, &pool.mutex);
+    }
+    pthread_mutex_unlock(&pool.mutex);
+
+    pthread_cond_destroy(&job.done);
+    pool_release(nhelpers);
 
-    int ret = 0;
     for (tnum = 0; tnum < ncols; tnum++) {
-        ret |= pthread_join(tinfo[tnum].tid, NULL);
         if (ndt_err_occurred(&tinfo[tnum].ctx)) {
             if (!ndt_err_occurred(ctx)) {
-                ndt_err_format(ctx, tinfo[tnum].ctx.err,
+                ndt_err_format(ctx, tinfo[tnum].ctx.err, "%s",
                                ndt_context_msg(&tinfo[tnum].ctx));
             }
             ndt_err_clear(&tinfo[tnum].ctx);
         }
     }
 
-    if (ret != 0 && !ndt_err_occurred(ctx)) {
-        ndt_err_format(ctx, NDT_RuntimeError, "error in thread");
-    }
- 
     clear_all_slices(slices, nslices, nrows);
     ndt_free(tinfo);
 
     return ndt_err_occurred(ctx) ? -1 : 0;
 }
+
+int
+gm_apply_thread(const gm_kernel_t *kernel, xnd_t stack[], int outer_dims,
+                const int64_t nthreads, ndt_context_t *ctx)
+{
+    const int nrows = (int)kernel->set->sig->Function.nargs;
+    int64_t nhelpers;
+    int64_t nelem = 0;
+    bool use_threads = true;
+
+    if (nthreads <= 1 || nrows == 0 || outer_dims == 0 ||
+        (kernel->set->cap & GM_CAP_REQUIRES_GIL)) {
+        use_threads = false;
+    }
+
+    /*
+     * The amount of work is determined by the largest argument.  This matters
+     * for reductions, where the output is much smaller than the input.
+     */
+    for (int i = 0; i < nrows; i++) {
+        const ndt_t *t = stack[i].type;
+        if (!ndt_is_ndarray(t)) {
+            use_threads = false;
+        }
+        else if (ndt_nelem(t) > nelem) {
+            nelem = ndt_nelem(t);
+        }
+    }
+
+    if (nelem < GM_THREAD_CUTOFF) {
+        use_threads = false;
+    }
+
+    gm_prepare_bitmaps(kernel, stack);
+
+    if (!use_threads) {
+        return gm_apply(kernel, stack, outer_dims, ctx);
+    }
+
+    nhelpers = pool_reserve(nthreads);
+    if (nhelpers == 0) {
+        return gm_apply(kernel, stack, outer_dims, ctx);
+    }
+
+    return run_threads(kernel, stack, nrows, outer_dims, 0, nhelpers, ctx);
+}
+
+
+/******************************************************************************/
+/*                                Threaded copy                               */
+/******************************************************************************/
+
+/*
+ * Dtypes that are copied without allocating.  Strings, bytes and other types
+ * with pointers allocate in the copy and are copied serially.
+ */
+static bool
+copy_dtype_safe(const ndt_t *t)
+{
+    switch (t->tag) {
+    case Bool:
+    case Int8: case Int16: case Int32: case Int64:
+    case Uint8: case Uint16: case Uint32: case Uint64:
+    case BFloat16: case Float16: case Float32: case Float64:
+    case BComplex32: case Complex32: case Complex64: case Complex128:
+    case FixedString: case FixedBytes: case Categorical:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool
+copy_thread_safe(const xnd_t *y, const xnd_t *x)
+{
+    const ndt_t *u = y->type;
+    const ndt_t *t = x->type;
+
+    /* Validity bits of neighboring elements share bytes and the NA count. */
+    if (u->tag != FixedDim ||
+        ndt_subtree_is_optional(u) || ndt_subtree_is_optional(t)) {
+        return false;
+    }
+
+    while (u->tag == FixedDim) {
+        if (t->tag != FixedDim || t->FixedDim.shape != u->FixedDim.shape) {
+            return false;
+        }
+        t = t->FixedDim.type;
+        u = u->FixedDim.type;
+    }
+
+    /* Slices of overlapping arrays would be copied in an arbitrary order. */
+    return copy_dtype_safe(u) && copy_dtype_safe(t) && !xnd_overlap(y, x);
+}
+
+int
+gm_copy_thread(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx)
+{
+    xnd_t stack[2];
+    int64_t nhelpers;
+
+    if (!copy_thread_safe(y, x) ||
+        ndt_nelem(y->type) < GM_THREAD_CUTOFF) {
+        return xnd_copy_serial(y, x, flags, ctx);
+    }
+
+    nhelpers = pool_reserve(INT64_MAX);
+    if (nhelpers == 0) {
+        return xnd_copy_serial(y, x, flags, ctx);
+    }
+
+    stack[0] = *y;
+    stack[1] = *x;
+
+    return run_threads(NULL, stack, 2, y->type->ndim, flags, nhelpers, ctx);
+}
+#else
+int64_t
+gm_get_max_threads(void)
+{
+    return max_threads;
+}
+
+int
+gm_set_max_threads(int64_t n, ndt_context_t *ctx)
+{
+    if (n <= 0) {
+        ndt_err_format(ctx, NDT_ValueError,
+            "max_threads must be greater than 0");
+        return -1;
+    }
+
+    max_threads = n;
+    return 0;
+}
+
+int
+gm_copy_thread(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx)
+{
+    return xnd_copy_serial(y, x, flags, ctx);
+}
 #endif
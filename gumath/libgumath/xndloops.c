@@ -35,6 +35,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <inttypes.h>
+#include <assert.h>
 #include "ndtypes.h"
 #include "xnd.h"
 #include "gumath.h"
@@ -102,9 +103,318 @@ any_stored_index(xnd_t stack[], const int nargs)
     return false;
 }
 
-int
-gm_xnd_map(const gm_xnd_kernel_t f, xnd_t stack[], const int nargs,
-           const int outer_dims, ndt_context_t *ctx)
+/*
+ * Iteration plan for outer dimensions that are fixed for all arguments.
+ * Steps are in units of the linear index, stored as step[d*nargs+k].
+ * The innermost dimension of the plan may be the 1D dimension of an
+ * optimized kernel, which is then called with the largest possible block.
+ */
+typedef struct {
+    int ndim;
+    int64_t shape[NDT_MAX_DIM+1];
+    int64_t *step;
+} loop_plan_t;
+
+/* Gather the outer dimensions, return false if they are not all fixed. */
+static bool
+plan_init(loop_plan_t *plan, const ndt_t *inner[], const xnd_t stack[],
+          const int nargs, const int outer_dims, const bool merge_inner)
+{
+    for (int k = 0; k < nargs; k++) {
+        const ndt_t *t = stack[k].type;
+
+        if (stack[k].ptr == NULL) {
+            return false;
+        }
+
+        for (int d = 0; d < outer_dims; d++) {
+            if (t->tag != FixedDim ||
+                (k > 0 && t->FixedDim.shape != plan->shape[d])) {
+                return false;
+            }
+            plan->shape[d] = t->FixedDim.shape;
+            plan->step[d*nargs+k] = t->Concrete.FixedDim.step;
+            t = t->FixedDim.type;
+        }
+
+        inner[k] = t;
+    }
+
+    plan->ndim = outer_dims;
+
+    /*
+     * Kernel dimensions of length one may have arbitrary steps and are
+     * not known to be contiguous, so they are never merged.
+     */
+    if (merge_inner && inner[0]->tag == FixedDim &&
+        inner[0]->FixedDim.shape > 1) {
+        const int64_t shape = inner[0]->FixedDim.shape;
+
+        for (int k = 0; k < nargs; k++) {
+            const ndt_t *t = inner[k];
+            if (t->tag != FixedDim || t->ndim != 1 ||
+                t->FixedDim.shape != shape) {
+                return true;
+            }
+            plan->step[outer_dims*nargs+k] = t->Concrete.FixedDim.step;
+        }
+
+        plan->shape[outer_dims] = shape;
+        plan->ndim = outer_dims + 1;
+    }
+
+    return true;
+}
+
+static inline int64_t
+dim_weight(const loop_plan_t *plan, const int d, const int nargs)
+{
+    int64_t w = 0;
+
+    for (int k = 0; k < nargs; k++) {
+        const int64_t s = plan->step[d*nargs+k];
+        w += s < 0 ? -s : s;
+    }
+
+    return w;
+}
+
+static inline void
+swap_dims(loop_plan_t *plan, const int a, const int b, const int nargs)
+{
+    int64_t tmp = plan->shape[a];
+    plan->shape[a] = plan->shape[b];
+    plan->shape[b] = tmp;
+
+    for (int k = 0; k < nargs; k++) {
+        tmp = plan->step[a*nargs+k];
+        plan->step[a*nargs+k] = plan->step[b*nargs+k];
+        plan->step[b*nargs+k] = tmp;
+    }
+}
+
+/*
+ * Sort the outer dimensions by decreasing stride, so that the innermost
+ * loops walk memory in order.  Arguments with zero steps are broadcast or
+ * reduced, in that case the order is left alone to keep the order of the
+ * accumulation stable.
+ */
+static void
+plan_reorder(loop_plan_t *plan, const int outer_dims, const int nargs)
+{
+    for (int i = 0; i < outer_dims*nargs; i++) {
+        if (plan->step[i] == 0) {
+            return;
+        }
+    }
+
+    for (int i = 1; i < outer_dims; i++) {
+        for (int j = i; j > 0; j--) {
+            if (dim_weight(plan, j-1, nargs) >= dim_weight(plan, j, nargs)) {
+                break;
+            }
+            swap_dims(plan, j-1, j, nargs);
+        }
+    }
+}
+
+/*
+ * Merge adjacent dimensions that are contiguous for all arguments and drop
+ * dimensions of length one.  The steps of a merged dimension are the steps
+ * of the inner dimension.
+ */
+static void
+plan_coalesce(loop_plan_t *plan, const int nargs)
+{
+    int n = 0;
+
+    for (int d = 0; d < plan->ndim; d++) {
+        const int64_t shape = plan->shape[d];
+        bool merge = n > 0;
+
+        for (int k = 0; merge && k < nargs; k++) {
+            const int64_t outer = plan->step[(n-1)*nargs+k];
+            merge = shape == 1 || outer == plan->step[d*nargs+k] * shape;
+        }
+
+        if (merge) {
+            plan->shape[n-1] *= shape;
+            if (shape == 1) {
+                continue;
+            }
+        }
+        else if (plan->shape[d] == 1 && d < plan->ndim-1) {
+            continue;
+        }
+        else {
+            plan->shape[n] = shape;
+            n++;
+        }
+
+        for (int k = 0; k < nargs; k++) {
+            plan->step[(n-1)*nargs+k] = plan->step[d*nargs+k];
+        }
+    }
+
+    plan->ndim = n;
+}
+
+static int
+plan_run(const gm_xnd_kernel_t f, xnd_t stack[], const int nargs,
+         const loop_plan_t *plan, const ndt_t *inner[], ndt_context_t *ctx)
+{
+    ALLOCA(xnd_t, next, nargs);
+    ALLOCA(int64_t, index, nargs);
+    int64_t count[NDT_MAX_DIM+1];
+    int d;
+
+    for (int k = 0; k < nargs; k++) {
+        next[k].bitmap = stack[k].bitmap;
+        next[k].type = inner[k];
+        index[k] = stack[k].index;
+    }
+
+    for (d = 0; d < plan->ndim; d++) {
+        count[d] = 0;
+    }
+
+    while (1) {
+        for (int k = 0; k < nargs; k++) {
+            next[k].index = index[k];
+            next[k].ptr = inner[k]->ndim == 0 ?
+                          stack[k].ptr + index[k] * inner[k]->datasize :
+                          stack[k].ptr;
+        }
+
+        if (f(next, ctx) < 0) {
+            return -1;
+        }
+
+        for (d = plan->ndim-1; d >= 0; d--) {
+            const int64_t *step = plan->step + d*nargs;
+
+            if (++count[d] < plan->shape[d]) {
+                for (int k = 0; k < nargs; k++) {
+                    index[k] += step[k];
+                }
+                break;
+            }
+
+            for (int k = 0; k < nargs; k++) {
+                index[k] -= (plan->shape[d]-1) * step[k];
+            }
+            count[d] = 0;
+        }
+
+        if (d < 0) {
+            return 0;
+        }
+    }
+}
+
+/*
+ * Storage for a kernel type of a merged inner dimension.  The type is a
+ * shallow copy of the original kernel type with the shape and step of the
+ * merged dimension taken from the plan, so that running a plan never
+ * allocates.  The copies are only read by the kernels and are not reference
+ * counted.
+ */
+typedef struct {
+    alignas(MAX_ALIGN) char data[sizeof(ndt_t)];
+} block_type_t;
+
+static const ndt_t *
+block_type(block_type_t *mem, const ndt_t *t, const int64_t shape,
+           const int64_t step)
+{
+    const ndt_t *dtype = t->FixedDim.type;
+    const int64_t abs_step = step < 0 ? -step : step;
+    ndt_t *u = (ndt_t *)mem->data;
+
+    assert(t->tag == FixedDim && t->ndim == 1 && shape > 0);
+
+    memcpy(u, t, sizeof *u);
+    u->FixedDim.shape = shape;
+    u->Concrete.FixedDim.step = step;
+    u->datasize = dtype->datasize == 0 ? 0 :
+        (shape-1) * abs_step * t->Concrete.FixedDim.itemsize + dtype->datasize;
+    u->refcnt = 1;
+    u->interned = false;
+    u->hash = 0;
+
+    return u;
+}
+
+/*
+ * Run the kernel over the outer dimensions using a flat loop.  Return 1 if
+ * the dimensions cannot be planned and the caller should use the recursive
+ * loop.
+ */
+static int
+gm_xnd_map_plan(const gm_xnd_kernel_t f, xnd_t stack[], const int nargs,
+                const int outer_dims, const bool merge_inner,
+                ndt_context_t *ctx)
+{
+    ALLOCA(int64_t, step, (outer_dims+1)*nargs);
+    ALLOCA(const ndt_t *, inner, nargs);
+    loop_plan_t plan;
+
+    plan.step = step;
+
+    if (!plan_init(&plan, inner, stack, nargs, outer_dims, merge_inner)) {
+        return 1;
+    }
+
+    for (int d = 0; d < outer_dims; d++) {
+        if (plan.shape[d] == 0) {
+            return 0;
+        }
+    }
+
+    plan_reorder(&plan, outer_dims, nargs);
+
+    const bool have_inner = plan.ndim > outer_dims;
+    const int64_t inner_shape = have_inner ? plan.shape[outer_dims] : 0;
+
+    plan_coalesce(&plan, nargs);
+
+    if (have_inner && plan.shape[plan.ndim-1] != inner_shape) {
+        ALLOCA(block_type_t, mem, nargs);
+        ALLOCA(const ndt_t *, block, nargs);
+
+        plan.ndim--;
+        for (int k = 0; k < nargs; k++) {
+            block[k] = block_type(&mem[k], inner[k], plan.shape[plan.ndim],
+                                  plan.step[plan.ndim*nargs+k]);
+        }
+
+        return plan_run(f, stack, nargs, &plan, block, ctx);
+    }
+
+    if (have_inner) {
+        plan.ndim--;
+    }
+
+    return plan_run(f, stack, nargs, &plan, inner, ctx);
+}
+
+static int
+map(const gm_xnd_kernel_t f, xnd_t stack[], const int nargs,
+    const int outer_dims, const bool merge_inner, ndt_context_t *ctx)
+{
+    if (outer_dims > 0 && nargs > 0) {
+        int ret = gm_xnd_map_plan(f, stack, nargs, outer_dims, merge_inner, ctx);
+        if (ret <= 0) {
+            return ret;
+        }
+    }
+
+    return _gm_xnd_map(f, stack, nargs, outer_dims, ctx);
+}
+
+static int
+xnd_map(const gm_xnd_kernel_t f, xnd_t stack[], const int nargs,
+        const int outer_dims, const bool merge_inner, ndt_context_t *ctx)
 {
     if (any_stored_index(stack, nargs)) {
         ALLOCA(xnd_t, next, nargs);
@@ -122,10 +432,29 @@ gm_xnd_map(const gm_xnd_kernel_t f, xnd_t stack[], const int nargs,
             }
         }
 
-        return _gm_xnd_map(f, next, nargs, outer_dims, ctx);
+        return map(f, next, nargs, outer_dims, merge_inner, ctx);
     }
 
-    return _gm_xnd_map(f, stack, nargs, outer_dims, ctx);
+    return map(f, stack, nargs, outer_dims, merge_inner, ctx);
+}
+
+int
+gm_xnd_map(const gm_xnd_kernel_t f, xnd_t stack[], const int nargs,
+           const int outer_dims, ndt_context_t *ctx)
+{
+    return xnd_map(f, stack, nargs, outer_dims, false, ctx);
+}
+
+/*
+ * Same as gm_xnd_map() for optimized kernels with a 1D inner dimension.
+ * Outer dimensions that are contiguous with the inner dimension for all
+ * arguments are merged into it, so the kernel runs on larger blocks.
+ */
+int
+gm_xnd_map_1D(const gm_xnd_kernel_t f, xnd_t stack[], const int nargs,
+              const int outer_dims, ndt_context_t *ctx)
+{
+    return xnd_map(f, stack, nargs, outer_dims, true, ctx);
 }
 
 static int
@@ -30,8 +30,9 @@
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #
 
+import threading
 from ndtypes import ndt
-from xnd import xnd
+from xnd import xnd, array, _convert_smallest
 from ._gumath import *
 from . import functions as _fn
 
@@ -41,8 +42,10 @@ except ImportError:
     _cd = None
 
 
-__all__ = ['cuda', 'fold', 'functions', 'get_max_threads', 'gufunc', 'reduce',
-           'set_max_threads', 'unsafe_add_kernel', 'vfold', 'xndvectorize']
+__all__ = ['cuda', 'defer', 'deferred', 'evaluate', 'expr', 'fold', 'functions',
+           'get_isa', 'get_max_threads', 'get_strict_math', 'gufunc', 'reduce',
+           'set_isa', 'set_max_threads', 'set_strict_math', 'unsafe_add_kernel',
+           'vfold', 'xndvectorize']
 
 
 # ==============================================================================
@@ -117,6 +120,53 @@ def reduce_cpu(f, x, axes, dtype):
 
     return fold(f, acc, tl)
 
+def _reduce_blocks(g, x, dtype):
+    """Tree reduction of a large contiguous 1D array: the equal sized blocks
+       are reduced in parallel, then the partial results are reduced."""
+    k = get_max_threads()
+    n = x.type.shape[0]
+    m = n // k
+    kwargs = {} if dtype is None else {'dtype': dtype}
+
+    head = g(x[:k*m].reshape(k, m), **kwargs)
+    if k*m == n:
+        return g(head, **kwargs)
+
+    partial = xnd.empty("%d * %s" % (k+1, head.dtype))
+    _fn.copy(head, out=partial[:k])
+    _fn.copy(g(x[k*m:], **kwargs), out=partial[k])
+
+    return g(partial, **kwargs)
+
+def reduce_native(g, x, axes, dtype):
+    """Reductions with the native reduce_* kernels.  The kernels reduce the
+       innermost dimension, so the reduced axes are moved to the end and
+       consumed one at a time."""
+    axes = _get_axes(axes, x.ndim)
+    if not axes:
+        return x
+
+    if len(axes) > 1 and _contains(_arg_reductions, g):
+        raise ValueError("argmin and argmax require a single axis")
+
+    if dtype is not None and not isinstance(dtype, ndt):
+        dtype = ndt(dtype)
+
+    permute = [n for n in range(x.ndim) if n not in axes]
+    permute = permute + sorted(axes)
+
+    T = x.transpose(permute=permute)
+    kwargs = {} if dtype is None else {'dtype': dtype}
+
+    for _ in axes:
+        if T.ndim == 1 and _contains(_tree_reductions, g) and get_max_threads() > 1 and \
+           T.type.shape[0] >= _THREAD_CUTOFF and T.type.is_c_contiguous():
+            T = _reduce_blocks(g, T, dtype)
+        else:
+            T = g(T, **kwargs)
+
+    return T
+
 def reduce_cuda(g, x, axes, dtype):
     """Reductions in CUDA use the thrust library for speed and have limited
        functionality."""
@@ -135,7 +185,22 @@ def get_cuda_reduction_func(f):
     else:
         return None
 
+def _contains(lst, f):
+    return any(f is g for g in lst)
+
+def get_cpu_reduction_func(f):
+    for g, h in _binary_reductions:
+        if f is g:
+            return h
+    return None
+
 def reduce(f, x, axes=0, dtype=None):
+    """Reduce 'x' along 'axes'.  'f' is either a binary function or one of
+       the native reductions in gumath.functions (reduce_add, reduce_min, ...).
+       Binary functions with a native counterpart use the native kernels."""
+    if _contains(_native_reductions, f):
+        return reduce_native(f, x, axes, dtype)
+
     if dtype is None:
         dtype = maxcast[x.dtype]
 
@@ -143,9 +208,40 @@ def reduce(f, x, axes=0, dtype=None):
     if g is not None:
         return reduce_cuda(g, x, axes, dtype)
 
+    g = get_cpu_reduction_func(f)
+    if g is not None and x.device is None:
+        try:
+            return reduce_native(g, x, axes, dtype)
+        except TypeError:
+            # No kernel for the input type (e.g. var dimensions), use fold.
+            pass
+
     return reduce_cpu(f, x, axes, dtype)
 
 
+# Must match GM_THREAD_CUTOFF in gumath.h.
+_THREAD_CUTOFF = 1000000
+
+# gufuncs are not hashable, these are searched by identity.
+_binary_reductions = [
+  (_fn.add, _fn.reduce_add),
+  (_fn.multiply, _fn.reduce_multiply),
+]
+
+_native_reductions = [
+  _fn.reduce_add, _fn.reduce_multiply, _fn.reduce_min, _fn.reduce_max,
+  _fn.reduce_argmin, _fn.reduce_argmax, _fn.reduce_mean
+]
+
+_tree_reductions = [
+  _fn.reduce_add, _fn.reduce_multiply, _fn.reduce_min, _fn.reduce_max
+]
+
+_arg_reductions = [
+  _fn.reduce_argmin, _fn.reduce_argmax
+]
+
+
 maxcast = {
   ndt("int8"): ndt("int64"),
   ndt("int16"): ndt("int64"),
@@ -181,6 +277,423 @@ maxcast = {
 }
 
 
+# ==============================================================================
+#                       Deferred elementwise expressions
+# ==============================================================================
+
+# Functions that map elements to elements.  Chains of these can be evaluated
+# in tiles, since every output element only depends on the input elements at
+# the same (broadcast) index.
+_elementwise_unary = frozenset([
+  "abs", "acos", "acosh", "asin", "asinh", "atan", "atanh", "cbrt", "ceil",
+  "copy", "cos", "cosh", "erf", "erfc", "exp", "exp2", "expm1", "fabs",
+  "floor", "invert", "lgamma", "log", "log10", "log1p", "log2", "logb",
+  "nearbyint", "negative", "round", "sin", "sinh", "sqrt", "tan", "tanh",
+  "tgamma", "trunc"
+])
+
+_elementwise_binary = frozenset([
+  "add", "bitwise_and", "bitwise_or", "bitwise_xor", "divide", "equal",
+  "equaln", "floor_divide", "greater", "greater_equal", "less", "less_equal",
+  "multiply", "not_equal", "power", "remainder", "subtract"
+])
+
+# Upper bound for the size of one tile of a single intermediate result.  A
+# handful of these should stay in L2.
+_TILE_BYTES = 1 << 17
+
+_deferred_state = threading.local()
+
+# Number of active deferred() contexts in all threads.  The hook in
+# xnd.array is only installed while this is nonzero, so that eager array
+# operations do not pay for a Python call.
+_deferred_lock = threading.Lock()
+_deferred_active = 0
+
+
+class expr(object):
+    """Node of a deferred elementwise expression.  Leaves hold an xnd value,
+       inner nodes the name of a gumath.functions kernel and the arguments."""
+
+    __slots__ = ('name', 'args', 'value')
+
+    def __init__(self, name, args, value=None):
+        self.name = name
+        self.args = args
+        self.value = value
+
+    def eval(self, out=None):
+        return evaluate(self, out=out)
+
+    def _format(self):
+        if self.name is None:
+            return str(self.value.type)
+        return "%s(%s)" % (self.name, ", ".join(a._format() for a in self.args))
+
+    def __repr__(self):
+        return "expr(%s)" % self._format()
+
+    def __bool__(self):
+        raise TypeError("the truth value of a deferred expression is undefined")
+
+    __hash__ = object.__hash__
+
+def _leaf(v):
+    if isinstance(v, expr):
+        return v
+    if not isinstance(v, xnd):
+        v = _convert_smallest(v)
+    return expr(None, (), v)
+
+def _unary_method(name):
+    def f(self):
+        return expr(name, (self,))
+    return f
+
+def _binary_method(name):
+    def f(self, other):
+        return expr(name, (self, _leaf(other)))
+    return f
+
+def _reflected_method(name):
+    def f(self, other):
+        return expr(name, (_leaf(other), self))
+    return f
+
+for _name, _op in [("negative", "neg"), ("abs", "abs"), ("invert", "invert")]:
+    setattr(expr, "__%s__" % _op, _unary_method(_name))
+
+for _name, _op in [("add", "add"), ("subtract", "sub"), ("multiply", "mul"),
+                   ("divide", "truediv"), ("floor_divide", "floordiv"),
+                   ("remainder", "mod"), ("power", "pow"),
+                   ("bitwise_and", "and"), ("bitwise_or", "or"),
+                   ("bitwise_xor", "xor")]:
+    setattr(expr, "__%s__" % _op, _binary_method(_name))
+    setattr(expr, "__r%s__" % _op, _reflected_method(_name))
+
+for _name, _op in [("equal", "eq"), ("not_equal", "ne"), ("less", "lt"),
+                   ("less_equal", "le"), ("greater", "gt"),
+                   ("greater_equal", "ge")]:
+    setattr(expr, "__%s__" % _op, _binary_method(_name))
+
+
+class deferred(object):
+    """Context manager: array operations in the current thread are recorded
+       as expressions instead of being evaluated."""
+
+    def __enter__(self):
+        global _deferred_active
+        with _deferred_lock:
+            _deferred_active += 1
+            array._recorder = _record
+        _deferred_state.depth = getattr(_deferred_state, "depth", 0) + 1
+        return self
+
+    def __exit__(self, *exc):
+        global _deferred_active
+        _deferred_state.depth -= 1
+        with _deferred_lock:
+            _deferred_active -= 1
+            if _deferred_active == 0:
+                array._recorder = None
+        return False
+
+def _is_elementwise(name, nargs):
+    if nargs == 1:
+        return name in _elementwise_unary
+    return nargs == 2 and name in _elementwise_binary
+
+def _record(name, args, out=None, force=False):
+    """Hook for the operators of xnd.array inside deferred() contexts.  Returns
+       NotImplemented if the operation should be evaluated eagerly by the
+       caller."""
+    has_expr = any(isinstance(v, expr) for v in args)
+    if not (force or has_expr or getattr(_deferred_state, "depth", 0)):
+        return NotImplemented
+
+    if not _is_elementwise(name, len(args)) or \
+       any(getattr(v, "device", None) is not None for v in args):
+        if not has_expr:
+            return NotImplemented
+        args = [evaluate(v) if isinstance(v, expr) else v for v in args]
+        return getattr(_fn, name)(*args, out=out, cls=array)
+
+    e = expr(name, tuple(_leaf(v) for v in args))
+    if out is not None:
+        return evaluate(e, out=out)
+    return e
+
+array._deferred_types = (expr,)
+
+def defer(obj):
+    """Return a deferred version of an xnd value or of an elementwise
+       function in gumath.functions."""
+    if isinstance(obj, (xnd, expr)):
+        return _leaf(obj)
+
+    for name in _elementwise_unary | _elementwise_binary:
+        if getattr(_fn, name, None) is obj:
+            def f(*args, out=None):
+                return _record(name, args, out=out, force=True)
+            f.__name__ = name
+            return f
+
+    raise ValueError("defer: expected an xnd value or an elementwise function")
+
+def _schedule(e):
+    """Topologically sorted list of the distinct nodes of 'e'.  Leaves are
+       ('leaf', value), nodes (name, argument slots).  Structurally equal
+       subexpressions share a slot."""
+    items = []
+    slots = {}
+    memo = {}
+    stack = [(e, False)]
+
+    while stack:
+        node, ready = stack.pop()
+        if id(node) in memo:
+            continue
+        if node.name is None:
+            key = ("leaf", id(node.value))
+            item = key[:1] + (node.value,)
+        elif not ready:
+            stack.append((node, True))
+            stack.extend((a, False) for a in reversed(node.args)
+                         if id(a) not in memo)
+            continue
+        else:
+            key = (node.name,) + tuple(memo[id(a)] for a in node.args)
+            item = (node.name, key[1:])
+
+        slot = slots.get(key)
+        if slot is None:
+            slot = slots[key] = len(items)
+            items.append(item)
+        memo[id(node)] = slot
+
+    return items, memo[id(e)]
+
+def _last_use(items):
+    last = list(range(len(items)))
+    for i, (name, args) in enumerate(items):
+        if name != "leaf":
+            for j in args:
+                last[j] = i
+    return last
+
+def _eval_eager(items, root, cls, out):
+    last = _last_use(items)
+    vals = [None] * len(items)
+
+    for i, (name, args) in enumerate(items):
+        if name == "leaf":
+            vals[i] = args
+            continue
+        kwargs = {"out": out} if i == root and out is not None else {}
+        vals[i] = getattr(_fn, name)(*[vals[j] for j in args], cls=cls, **kwargs)
+        for j in args:
+            if last[j] == i and items[j][0] != "leaf":
+                vals[j] = None
+
+    if items[root][0] == "leaf" and out is not None:
+        _fn.copy(vals[root], out=out)
+        return out
+
+    return vals[root]
+
+def _broadcast_shape(shapes):
+    ndim = max(len(s) for s in shapes)
+    result = [1] * ndim
+    for s in shapes:
+        for i, n in enumerate(s, ndim - len(s)):
+            if n != 1:
+                if result[i] not in (1, n):
+                    return None
+                result[i] = n
+    return result
+
+def _type_string(shape, dtype):
+    return " * ".join([str(n) for n in shape] + [str(dtype)])
+
+def _eval_tiles(items, root, cls, out):
+    """Evaluate 'items' in tiles.  If all arrays have the broadcast shape and
+       are C-contiguous, the tiles cover the flattened index space, otherwise
+       they are slices of the first dimension.  Large expressions are split
+       between get_max_threads() threads.  Returns None if tiling is not
+       possible or not worthwhile."""
+    leaves = [i for i, (name, _) in enumerate(items) if name == "leaf"]
+    if any(items[i][1].device is not None for i in leaves):
+        return None
+
+    try:
+        shapes = [items[i][1].type.shape for i in leaves]
+    except TypeError:
+        return None
+
+    shape = _broadcast_shape(shapes)
+    if shape is None or len(shape) == 0 or 0 in shape:
+        return None
+
+    # Skip the probe if the whole result fits into a tile for any dtype.
+    size = 1
+    for n in shape:
+        size *= n
+    if size * 16 <= _TILE_BYTES:
+        return None
+
+    def flat(v):
+        return isinstance(v, xnd) and v.type.shape == tuple(shape) and \
+               v.type.is_c_contiguous()
+
+    src = [args if name == "leaf" else None for name, args in items]
+    if all(src[i].ndim == 0 or flat(src[i]) for i in leaves) and \
+       (out is None or flat(out)):
+        for i in leaves:
+            if src[i].ndim > 0:
+                src[i] = src[i].reshape(size)
+        dims = [size]
+    elif shape[0] == 1:
+        return None
+    else:
+        dims = shape
+
+    M = dims[0]
+    ndim = len(dims)
+    tiled = [False] * len(items)
+    for i, (name, args) in enumerate(items):
+        if name == "leaf":
+            tiled[i] = src[i].ndim == ndim and src[i].type.shape[0] == M
+        else:
+            tiled[i] = any(tiled[j] for j in args)
+
+    if not tiled[root] or items[root][0] == "leaf":
+        return None
+
+    # Probe run on the first row: yields the result types of the tiled nodes
+    # and evaluates the invariant nodes once.
+    vals = [None] * len(items)
+    types = [None] * len(items)
+    for i, (name, args) in enumerate(items):
+        if name == "leaf":
+            vals[i] = src[i][0:1] if tiled[i] else src[i]
+        else:
+            vals[i] = getattr(_fn, name)(*[vals[j] for j in args], cls=cls)
+        if tiled[i] and name != "leaf":
+            types[i] = (vals[i].type.shape[1:], vals[i].dtype)
+
+    row_bytes = max(vals[i].type.datasize for i in range(len(items))
+                    if tiled[i] and items[i][0] != "leaf")
+    rows = max(1, _TILE_BYTES // max(1, row_bytes))
+    if rows >= 8:
+        rows -= rows % 8
+    if rows >= M:
+        return None
+
+    if out is None:
+        out = cls.empty(_type_string(shape, types[root][1]))
+    elif not isinstance(out, xnd) or out.ndim == 0 or out.type.shape[0] != shape[0]:
+        return None
+    dest = out.reshape(size) if ndim < len(shape) else out
+
+    # Static buffer assignment: the result of a tiled node occupies a buffer
+    # until its last use.  Buffers of the same type are reused.
+    last = _last_use(items)
+    bufof = [None] * len(items)
+    buftypes = []
+    free = {}
+    for i, (name, args) in enumerate(items):
+        if not tiled[i] or name == "leaf" or i == root:
+            continue
+        t = _type_string([rows] + list(types[i][0]), types[i][1])
+        lst = free.get(t)
+        if lst:
+            bufof[i] = lst.pop()
+        else:
+            bufof[i] = len(buftypes)
+            buftypes.append(t)
+        for j in args:
+            if last[j] == i and bufof[j] is not None:
+                free.setdefault(buftypes[bufof[j]], []).append(bufof[j])
+
+    program = [(i, getattr(_fn, name), args) for i, (name, args) in enumerate(items)
+               if tiled[i] and name != "leaf"]
+    inputs = [i for i in leaves if tiled[i]]
+    invariant = [None if tiled[i] else v for i, v in enumerate(vals)]
+
+    def run(start, stop):
+        bufs = [xnd.empty(t) for t in buftypes]
+        vals = list(invariant)
+        for lo in range(start, stop, rows):
+            hi = min(lo + rows, stop)
+            for i in inputs:
+                vals[i] = src[i][lo:hi]
+            for i, f, args in program:
+                if i == root:
+                    y = dest[lo:hi]
+                else:
+                    y = bufs[bufof[i]]
+                    if hi - lo != rows:
+                        y = y[:hi-lo]
+                f(*[vals[j] for j in args], out=y)
+                vals[i] = y
+
+    # The tiles are far below the thread cutoff of the kernels, so large
+    # expressions are split into contiguous ranges of tiles that are run
+    # in parallel.  The kernels release the GIL.
+    ntiles = (M + rows - 1) // rows
+    nthreads = min(get_max_threads(), ntiles) if size >= _THREAD_CUTOFF else 1
+    if nthreads <= 1:
+        run(0, M)
+        return out
+
+    step = (ntiles + nthreads - 1) // nthreads * rows
+    errors = []
+
+    def work(start):
+        try:
+            run(start, min(start + step, M))
+        except BaseException as e:
+            errors.append(e)
+
+    threads = [threading.Thread(target=work, args=(start,))
+               for start in range(step, M, step)]
+    for t in threads:
+        t.start()
+    work(0)
+    for t in threads:
+        t.join()
+
+    if errors:
+        raise errors[0]
+
+    return out
+
+def evaluate(e, out=None):
+    """Evaluate a deferred expression.  Elementwise chains over arrays are
+       computed in cache sized tiles, so the intermediate results never exist
+       in full.  Common subexpressions are computed once."""
+    if not isinstance(e, expr):
+        raise TypeError("evaluate: expected a deferred expression")
+
+    items, root = _schedule(e)
+    leaves = [v for name, v in items if name == "leaf"]
+    cls = array if any(isinstance(v, array) for v in leaves if v.ndim > 0) or \
+                   all(isinstance(v, array) for v in leaves) else xnd
+
+    # Writing into an 'out' that aliases an input would overwrite elements
+    # that later tiles or kernels still read.  This includes the in-place
+    # operators of arrays, so the result is computed into a temporary.
+    if isinstance(out, xnd) and any(out._overlaps(v) for v in leaves):
+        out[()] = evaluate(e)
+        return out
+
+    result = _eval_tiles(items, root, cls, out)
+    if result is None:
+        result = _eval_eager(items, root, cls, out)
+
+    return result
+
+
 # ==============================================================================
 #                         Numba's GUVectorize on xnd arrays
 # ==============================================================================
@@ -84,9 +84,6 @@ static PyTypeObject *xnd = NULL;
 /* Empty positional arguments */
 static PyObject *positional_empty = NULL;
 
-/* Maximum number of threads */
-static int64_t max_threads = 1;
-
 
 /****************************************************************************/
 /*                               Error handling                             */
@@ -234,6 +231,41 @@ parse_args(PyObject *pystack[NDT_MAX_ARGS], int *py_nin, int *py_nout, int *py_n
     return 0;
 }
 
+/*
+ * Run a cpu kernel.  Kernels are executed without the GIL unless they are
+ * marked with GM_CAP_REQUIRES_GIL, in which case they also run serially in
+ * the calling thread.  The kernel set is copied first, since another thread
+ * may reallocate the kernel table in unsafe_add_kernel() once the GIL has
+ * been released.
+ */
+static int
+apply_kernel(const gm_kernel_t *kernel, xnd_t stack[], int outer_dims,
+             int64_t nthreads, ndt_context_t *ctx)
+{
+    const gm_kernel_set_t set = *kernel->set;
+    const gm_kernel_t k = { .flag = kernel->flag, .set = &set };
+    PyThreadState *save = NULL;
+    int ret;
+
+    if (!(set.cap & GM_CAP_REQUIRES_GIL)) {
+        save = PyEval_SaveThread();
+    }
+
+#ifdef HAVE_PTHREAD_H
+    ret = gm_apply_thread(&k, stack, outer_dims, nthreads, ctx);
+#else
+    (void)nthreads;
+    gm_prepare_bitmaps(&k, stack);
+    ret = gm_apply(&k, stack, outer_dims, ctx);
+#endif
+
+    if (save != NULL) {
+        PyEval_RestoreThread(save);
+    }
+
+    return ret;
+}
+
 static PyObject *
 _gufunc_call(GufuncObject *self, PyObject *args, PyObject *kwargs,
              bool enable_threads, bool check_broadcast)
@@ -311,6 +343,11 @@ _gufunc_call(GufuncObject *self, PyObject *args, PyObject *kwargs,
         }
     }
 
+    /*
+     * Selection parses lazily added signatures on first use, updates the
+     * per-function caches and reads the kernel table, which unsafe_add_kernel()
+     * may reallocate.  All of these are protected by the GIL.
+     */
     kernel = gm_select(&spec, self->tbl, self->name, types, li, nin, nout,
                        nout && check_broadcast, stack, &ctx);
     if (kernel.set == NULL) {
@@ -387,9 +424,19 @@ _gufunc_call(GufuncObject *self, PyObject *args, PyObject *kwargs,
             return seterr(&ctx);
         }
 
-        const int ret = gm_apply(&kernel, stack, spec.outer_dims, &ctx);
+        const gm_kernel_set_t set = *kernel.set;
+        int ret;
 
-        if (xnd_cuda_device_synchronize(&ctx) < 0 || ret < 0) {
+        kernel.set = &set;
+        gm_prepare_bitmaps(&kernel, stack);
+        Py_BEGIN_ALLOW_THREADS
+        ret = gm_apply(&kernel, stack, spec.outer_dims, &ctx);
+        if (xnd_cuda_device_synchronize(&ctx) < 0) {
+            ret = -1;
+        }
+        Py_END_ALLOW_THREADS
+
+        if (ret < 0) {
             clear_pystack(pystack, spec.nargs);
             ndt_apply_spec_clear(&spec);
             return seterr(&ctx);
@@ -403,25 +450,11 @@ _gufunc_call(GufuncObject *self, PyObject *args, PyObject *kwargs,
     #endif
     }
     else {
-    #ifdef HAVE_PTHREAD_H
         const int rounding = fegetround();
         fesetround(FE_TONEAREST);
 
-        const int64_t N = enable_threads ? max_threads : 1;
-        const int ret = gm_apply_thread(&kernel, stack, spec.outer_dims, N,
-                                        &ctx);
-        fesetround(rounding);
-
-        if (ret < 0) {
-            clear_pystack(pystack, spec.nargs);
-            ndt_apply_spec_clear(&spec);
-            return seterr(&ctx);
-        }
-    #else
-        const int rounding = fegetround();
-        fesetround(FE_TONEAREST);
-
-        const int ret = gm_apply(&kernel, stack, spec.outer_dims, &ctx);
+        const int64_t N = enable_threads ? gm_get_max_threads() : 1;
+        const int ret = apply_kernel(&kernel, stack, spec.outer_dims, N, &ctx);
 
         fesetround(rounding);
 
@@ -430,7 +463,6 @@ _gufunc_call(GufuncObject *self, PyObject *args, PyObject *kwargs,
             ndt_apply_spec_clear(&spec);
             return seterr(&ctx);
         }
-    #endif
     }
 
     nin = spec.nin;
@@ -503,7 +535,7 @@ gufunc_getkernels(GufuncObject *self, PyObject *args GM_UNUSED)
     int i;
 
     f = gm_tbl_find(self->tbl, self->name, &ctx);
-    if (f == NULL) {
+    if (f == NULL || gm_func_resolve(f, &ctx) < 0) {
         return seterr(&ctx);
     }
 
@@ -720,17 +752,18 @@ static PyObject *
 unsafe_add_kernel(PyObject *m GM_UNUSED, PyObject *args, PyObject *kwds)
 {
     NDT_STATIC_CONTEXT(ctx);
-    static char *kwlist[] = {"name", "sig", "tag", "ptr", NULL};
+    static char *kwlist[] = {"name", "sig", "tag", "ptr", "nogil", NULL};
     gm_kernel_init_t k = {NULL};
     gm_func_t *f;
     char *name;
     char *sig;
     char *tag;
     PyObject *ptr;
+    int nogil = 0;
     void *p;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwds, "sssO", kwlist, &name, &sig,
-        &tag, &ptr)) {
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "sssO|$p", kwlist, &name, &sig,
+        &tag, &ptr, &nogil)) {
         return NULL;
     }
 
@@ -742,6 +775,9 @@ unsafe_add_kernel(PyObject *m GM_UNUSED, PyObject *args, PyObject *kwds)
     k.name = name;
     k.sig = sig;
 
+    /* Foreign kernels may call back into Python unless declared otherwise. */
+    k.cap = nogil ? 0 : GM_CAP_REQUIRES_GIL;
+
     if (strcmp(tag, "Opt") == 0) { /* XXX */
         k.OptC = p;
     }
@@ -778,6 +814,7 @@ unsafe_add_kernel(PyObject *m GM_UNUSED, PyObject *args, PyObject *kwds)
 static void
 init_max_threads(void)
 {
+    NDT_STATIC_CONTEXT(ctx);
     PyObject *os = NULL;
     PyObject *n = NULL;
     int64_t i64;
@@ -797,7 +834,10 @@ init_max_threads(void)
         goto error;
     }
 
-    max_threads = i64;
+    if (gm_set_max_threads(i64, &ctx) < 0) {
+        ndt_err_clear(&ctx);
+        goto error;
+    }
 
 out:
     Py_XDECREF(os);
@@ -816,12 +856,13 @@ error:
 static PyObject *
 get_max_threads(PyObject *m UNUSED, PyObject *args UNUSED)
 {
-    return PyLong_FromLongLong(max_threads);
+    return PyLong_FromLongLong(gm_get_max_threads());
 }
 
 static PyObject *
 set_max_threads(PyObject *m UNUSED, PyObject *obj)
 {
+    NDT_STATIC_CONTEXT(ctx);
     int64_t n;
 
     n = PyLong_AsLongLong(obj);
@@ -829,13 +870,54 @@ set_max_threads(PyObject *m UNUSED, PyObject *obj)
         return NULL;
     }
 
-    if (n <= 0) {
-        PyErr_SetString(PyExc_ValueError,
-            "max_threads must be greater than 0");
+    if (gm_set_max_threads(n, &ctx) < 0) {
+        return seterr(&ctx);
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+get_isa(PyObject *m UNUSED, PyObject *args UNUSED)
+{
+    return PyUnicode_FromString(gm_get_isa());
+}
+
+static PyObject *
+set_isa(PyObject *m UNUSED, PyObject *obj)
+{
+    NDT_STATIC_CONTEXT(ctx);
+    const char *name;
+
+    name = PyUnicode_AsUTF8(obj);
+    if (name == NULL) {
+        return NULL;
+    }
+
+    if (gm_set_isa(name, &ctx) < 0) {
+        return seterr(&ctx);
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+get_strict_math(PyObject *m UNUSED, PyObject *args UNUSED)
+{
+    return PyBool_FromLong(gm_get_strict_math());
+}
+
+static PyObject *
+set_strict_math(PyObject *m UNUSED, PyObject *obj)
+{
+    int strict;
+
+    strict = PyObject_IsTrue(obj);
+    if (strict < 0) {
         return NULL;
     }
 
-    max_threads = n;
+    gm_set_strict_math(strict);
 
     Py_RETURN_NONE;
 }
@@ -848,6 +930,10 @@ static PyMethodDef gumath_methods [] =
   { "unsafe_add_kernel", (PyCFunction)unsafe_add_kernel, METH_VARARGS|METH_KEYWORDS, NULL },
   { "get_max_threads", (PyCFunction)get_max_threads, METH_NOARGS, NULL },
   { "set_max_threads", (PyCFunction)set_max_threads, METH_O, NULL },
+  { "get_isa", (PyCFunction)get_isa, METH_NOARGS, NULL },
+  { "set_isa", (PyCFunction)set_isa, METH_O, NULL },
+  { "get_strict_math", (PyCFunction)get_strict_math, METH_NOARGS, NULL },
+  { "set_strict_math", (PyCFunction)set_strict_math, METH_O, NULL },
   { NULL, NULL, 1 }
 };
 
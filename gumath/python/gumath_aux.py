@@ -497,7 +497,7 @@ class Tfloat(object):
         for v in un_randfloat():
             yield float(v)
     def cpu_noimpl(self, f=None):
-        return self.type == "float16"
+        return False
     def cpu_nokern(self, f=None):
         return False
     def cuda_noimpl(self, f=None):
@@ -33,13 +33,16 @@
 import gumath as gm
 import gumath.functions as fn
 import gumath.examples as ex
-from xnd import xnd
+from xnd import xnd, array
 from ndtypes import ndt
 from extending import Graph
-import sys, time
+import sys, os, time
+import subprocess
+import threading
 import platform
 import math
 import cmath
+import struct
 import unittest
 import argparse
 from gumath_aux import *
@@ -69,6 +72,18 @@ class TestAPI(unittest.TestCase):
         self.assertRaises(TypeError, gm.gufunc.__new__)
         self.assertRaises(TypeError, gm.gufunc.__new__, 1)
 
+    def test_lazy_kernels(self):
+
+        # The signatures of the builtin kernels are parsed on first lookup.
+        lst = fn.cosh.kernels
+        self.assertIn("... * float64 -> ... * float64", lst)
+        self.assertEqual(fn.cosh.kernels, lst)
+        self.assertEqual(fn.cosh(xnd([0.0])), [1.0])
+
+        lst = fn.remainder.kernels
+        self.assertEqual(fn.remainder(xnd([7]), xnd([3])), [1])
+        self.assertEqual(fn.remainder.kernels, lst)
+
 
 class TestCall(unittest.TestCase):
 
@@ -115,7 +130,7 @@ class TestCall(unittest.TestCase):
             if np is not None:
                 a = np.array(lst, dtype=dtype)
                 b = np.sin(a)
-                np.testing.assert_equal(y, b)
+                np.testing.assert_array_max_ulp(np.array(y.value, dtype=dtype), b)
 
     def test_sin_strided(self):
 
@@ -131,7 +146,7 @@ class TestCall(unittest.TestCase):
                 a = np.array(lst, dtype=dtype)
                 b = a[::-2, ::-2]
                 c = np.sin(b)
-                np.testing.assert_equal(z, c)
+                np.testing.assert_array_max_ulp(np.array(z.value, dtype=dtype), c)
 
     def test_copy(self):
 
@@ -160,6 +175,59 @@ class TestCall(unittest.TestCase):
                 c = np.copy(b)
                 np.testing.assert_equal(y, b)
 
+    def test_outer_loops(self):
+
+        def depth(a):
+            return 1 + depth(a[0]) if isinstance(a, list) and a else int(a == [])
+
+        def add(a, b):
+            if depth(a) > depth(b):
+                return [add(v, b) for v in a]
+            if depth(b) > depth(a):
+                return [add(a, w) for w in b]
+            if isinstance(a, list):
+                if len(a) == 1:
+                    a = a * len(b)
+                if len(b) == 1:
+                    b = b * len(a)
+                return [add(v, w) for v, w in zip(a, b)]
+            return None if a is None or b is None else a + b
+
+        lst = [[[100*i + 10*j + k for k in range(5)] for j in range(4)] for i in range(3)]
+        opt = [[[None if (i+j+k) % 4 == 0 else 100*i + 10*j + k for k in range(5)]
+                for j in range(4)] for i in range(3)]
+
+        for t, value in [("3 * 4 * 5 * int64", lst), ("3 * 4 * 5 * ?int64", opt)]:
+            x = xnd(value, type=t)
+            y = xnd(lst, type="3 * 4 * 5 * int64")
+
+            # contiguous: all outer dimensions merge into the inner one
+            self.assertEqual(fn.add(x, y), add(x.value, y.value))
+
+            # transposed and strided views
+            for u, v in [(x.transpose(), y.transpose()),
+                         (x.transpose(permute=[1, 0, 2]), y.transpose(permute=[1, 0, 2])),
+                         (x.transpose(permute=[0, 2, 1]), y.transpose(permute=[0, 2, 1])),
+                         (x[::-1, 1:, ::2], y[::-1, 1:, ::2]),
+                         (x[:, ::2], y[:, ::2]),
+                         (x[1:2, :, 1:2], y[1:2, :, 1:2]),
+                         (x.transpose(), y[::-1].transpose())]:
+                self.assertEqual(fn.add(u, v), add(u.value, v.value))
+                self.assertEqual(fn.add(u, v).value, add(u.value, v.value))
+
+            # broadcasting
+            for v in [xnd([1, 2, 3, 4, 5]), xnd([[1], [2], [3], [4]]),
+                      xnd([[[7]], [[8]], [[9]]])]:
+                self.assertEqual(fn.add(x, v), add(x.value, v.value))
+
+            # explicit output with a different layout
+            out = xnd.empty("5 * 4 * 3 * %s" % t.split()[-1])
+            fn.add(x.transpose(), y.transpose(), out=out)
+            self.assertEqual(out, add(x.transpose().value, y.transpose().value))
+
+            # zero length outer dimension
+            self.assertEqual(fn.add(x[:, 4:], y[:, 4:]), [[], [], []])
+
     @unittest.skipIf(sys.platform == "win32", "missing C99 complex support")
     def test_quaternion(self):
   
@@ -272,6 +340,104 @@ class TestMissingValues(unittest.TestCase):
         y = gm.reduce(fn.add, x)
         self.assertEqual(y, 0)
 
+    def test_long_bitmaps(self):
+        N = 300
+        a = [None if i % 7 == 3 or 100 <= i < 170 else i for i in range(N)]
+        b = [None if i % 5 == 1 else i for i in range(N)]
+        x = xnd(a, dtype="?int64")
+        y = xnd(b, dtype="?int64")
+
+        def add(v, w):
+            return None if v is None or w is None else v + w
+
+        # Bitmaps that start at different bit offsets.
+        for i, j, n in [(0, 0, N), (3, 0, 200), (0, 5, 260), (9, 17, 203),
+                        (64, 8, 130), (1, 1, 1), (2, 250, 50)]:
+            ans = fn.add(x[i:i+n], y[j:j+n])
+            self.assertEqual(ans.value, [add(v, w) for v, w in
+                                         zip(a[i:i+n], b[j:j+n])])
+
+            ans = fn.negative(x[i:i+n])
+            self.assertEqual(ans.value, [None if v is None else -v
+                                         for v in a[i:i+n]])
+
+            z = xnd([0] * N, dtype="?int64")
+            fn.add(x[i:i+n], y[j:j+n], out=z[j:j+n])
+            self.assertEqual(z[j:j+n].value, [add(v, w) for v, w in
+                                              zip(a[i:i+n], b[j:j+n])])
+            self.assertEqual(z[:j].value, [0] * j)
+            self.assertEqual(z[j+n:].value, [0] * (N-j-n))
+
+        # Optional and non-optional operands.
+        y = xnd(list(range(N)), dtype="int64")
+        ans = fn.multiply(x[3:], y[:N-3])
+        self.assertEqual(ans.value, [None if v is None else v * w
+                                     for v, w in zip(a[3:], range(N-3))])
+
+        # Strided.
+        ans = fn.add(x[::3], x[1::3])
+        self.assertEqual(ans.value, [add(v, w) for v, w in zip(a[::3], a[1::3])])
+
+        # Reductions.
+        c = [None if i == 250 else i for i in range(N)]
+        x = xnd(c, dtype="?int64")
+        self.assertEqual(gm.reduce(fn.add, x[:250]).value, sum(range(250)))
+        self.assertEqual(gm.reduce(fn.add, x[5:250]).value, sum(range(5, 250)))
+        self.assertIsNone(gm.reduce(fn.add, x[5:]).value)
+        self.assertIsNone(gm.reduce(fn.add, x[250:]).value)
+        self.assertEqual(gm.reduce(fn.add, x[251:]).value, sum(range(251, N)))
+
+    def test_all_valid_bitmaps(self):
+        N = 200
+
+        def add(v, w):
+            return None if v is None or w is None else v + w
+
+        x = xnd([float(i) for i in range(N)], dtype="?float64")
+        self.assertEqual(fn.add(x, x).value, [2.0*i for i in range(N)])
+        self.assertEqual(fn.negative(x[3:]).value, [-float(i) for i in range(3, N)])
+        self.assertEqual(gm.reduce(fn.add, x).value, sum(range(N)))
+
+        # Setting an item updates the summary.
+        x[70] = None
+        a = x.value
+        self.assertEqual(fn.add(x, x).value, [add(v, v) for v in a])
+        self.assertIsNone(gm.reduce(fn.add, x).value)
+        self.assertEqual(gm.reduce(fn.add, x[71:]).value, sum(range(71, N)))
+
+        x[70] = 70.0
+        self.assertEqual(fn.add(x, x).value, [2.0*i for i in range(N)])
+
+        # Copying into a bitmap.
+        x[10:13] = xnd([None, 1.0, None], dtype="?float64")
+        a = x.value
+        self.assertEqual(fn.add(x, x).value, [add(v, v) for v in a])
+
+        # Outputs written by a kernel.
+        y = xnd([float(i) for i in range(N)], dtype="?float64")
+        z = xnd([1.0] * N, dtype="?float64")
+        fn.add(x, y, out=z)
+        self.assertEqual(z.value, [add(v, w) for v, w in zip(a, y.value)])
+        self.assertEqual(fn.add(z, y).value, [add(v, w) for v, w in zip(z.value, y.value)])
+
+        fn.add(y, y, out=z)
+        self.assertEqual(fn.add(z, y).value, [3.0*i for i in range(N)])
+
+        # In-place.
+        fn.add(y, x, out=y)
+        self.assertEqual(y.value, [add(float(i), v) for i, v in enumerate(a)])
+        self.assertIsNone(gm.reduce(fn.add, y).value)
+
+        # Two-dimensional arrays and threads.
+        x = xnd([[float(i)] * 50 for i in range(300)], dtype="?float64")
+        y = fn.multiply(x, x)
+        self.assertEqual(y.value, [[float(i*i)] * 50 for i in range(300)])
+        x[100][7] = None
+        y = fn.multiply(x, x)
+        self.assertIsNone(y[100][7].value)
+        self.assertEqual(y[100][8].value, 10000.0)
+        self.assertEqual(y[101].value, [101.0*101.0] * 50)
+
     @unittest.skipIf(cd is None, "test requires cuda")
     def test_reduce_cuda(self):
         a = [1, None, 2]
@@ -921,6 +1087,45 @@ class TestBinaryCPU(unittest.TestCase):
             z = fn.multiply(x, y)
             self.assertEqual(z, [2, 6, 12, 20, 30, 42, 56, 72])
 
+    def test_broadcast(self):
+        for t, u in implemented_sigs["binary"]["default"]:
+            w = implemented_sigs["binary"]["default"][(t, u)]
+
+            if t.cpu_noimpl() or u.cpu_noimpl():
+                continue
+
+            x = xnd([2, 3, 4, 5, 6, 7, 8, 9], dtype=t.type)
+            y = xnd([2, 3, 4, 5, 6, 7, 8, 9], dtype=u.type)
+
+            # scalar on the right and on the left
+            z = fn.subtract(x, xnd(1, dtype=u.type))
+            self.assertEqual(z, [1, 2, 3, 4, 5, 6, 7, 8])
+
+            z = fn.subtract(xnd(10, dtype=t.type), y)
+            self.assertEqual(z, [8, 7, 6, 5, 4, 3, 2, 1])
+
+            # column vector
+            x = xnd(2 * [[2, 3, 4, 5, 6, 7, 8, 9]], dtype=t.type)
+            z = fn.subtract(x, xnd([[1], [2]], dtype=u.type))
+            self.assertEqual(z, [[1, 2, 3, 4, 5, 6, 7, 8], [0, 1, 2, 3, 4, 5, 6, 7]])
+
+            # optional operands
+            x = xnd([2, 3, None, 5, 6, 7, 8, 9], dtype="?" + t.type)
+            z = fn.add(x, xnd(1, dtype="?" + u.type))
+            self.assertEqual(z, [3, 4, None, 6, 7, 8, 9, 10])
+
+            z = fn.add(x, xnd(None, type="?" + u.type))
+            self.assertEqual(z, 8 * [None])
+
+        # long operands cross the block boundaries of the half kernels
+        for t in ["float16", "bfloat16", "float32", "float64", "int32"]:
+            lst = [i % 40 for i in range(1001)]
+            x = xnd(lst, dtype=t)
+            s = xnd(3, dtype=t)
+            self.assertEqual(fn.multiply(x, s), [3 * v for v in lst])
+            self.assertEqual(fn.subtract(s, x), [3 - v for v in lst])
+            self.assertEqual(fn.less(x, s), [v < 3 for v in lst])
+
 
 @unittest.skipIf(cd is None, "test requires cuda")
 class TestBinaryCUDA(unittest.TestCase):
@@ -1665,6 +1870,902 @@ class TestSpec(unittest.TestCase):
                         check_buffer(nd, d, value, 0)
 
 
+class TestThreads(unittest.TestCase):
+
+    def test_max_threads(self):
+
+        n = gm.get_max_threads()
+        self.assertGreaterEqual(n, 1)
+
+        self.assertRaises(ValueError, gm.set_max_threads, 0)
+        self.assertRaises(ValueError, gm.set_max_threads, -1)
+        self.assertEqual(gm.get_max_threads(), n)
+
+        try:
+            gm.set_max_threads(3)
+            self.assertEqual(gm.get_max_threads(), 3)
+        finally:
+            gm.set_max_threads(n)
+
+    def test_threaded_apply(self):
+
+        n = gm.get_max_threads()
+        N = 2000000
+        x = xnd(list(range(N)), type="%d * int64" % N)
+
+        try:
+            for nthreads in [1, 2, 3, 8]:
+                gm.set_max_threads(nthreads)
+                for _ in range(3):
+                    y = fn.add(x, x)
+                    self.assertEqual(y[0], 0)
+                    self.assertEqual(y[N//2], N)
+                    self.assertEqual(y[N-1], 2*(N-1))
+        finally:
+            gm.set_max_threads(n)
+
+    def test_concurrent_calls(self):
+
+        n = gm.get_max_threads()
+        N = 2000000
+        x = xnd(list(range(N)), type="%d * int64" % N)
+        results = [None] * 4
+
+        def f(i):
+            results[i] = fn.multiply(x, x)
+
+        try:
+            gm.set_max_threads(4)
+            threads = [threading.Thread(target=f, args=(i,)) for i in range(4)]
+            for t in threads:
+                t.start()
+            for t in threads:
+                t.join()
+        finally:
+            gm.set_max_threads(n)
+
+        for y in results:
+            self.assertEqual(y[0], 0)
+            self.assertEqual(y[1000], 1000000)
+            self.assertEqual(y[N-1], (N-1)*(N-1))
+
+    def test_debug_allocator(self):
+
+        # The debug allocators abort if memory is allocated without the GIL
+        # by a non-raw allocator.
+        code = ("import gumath as gm, gumath.functions as fn\n"
+                "from xnd import xnd\n"
+                "gm.set_max_threads(4)\n"
+                "x = xnd([1.0, 2.0, 3.0])\n"
+                "assert fn.add(x, x) == xnd([2.0, 4.0, 6.0])\n"
+                "x = xnd(list(range(2000000)), dtype='float64')\n"
+                "assert fn.add(x, x)[10] == 20.0\n"
+                "x = xnd(['a%d' % i for i in range(1100000)])\n"
+                "assert x.copy_contiguous() == x\n")
+
+        env = dict(os.environ, PYTHONMALLOC="debug",
+                   PYTHONPATH=os.pathsep.join(sys.path))
+        p = subprocess.run([sys.executable, "-c", code], env=env,
+                           stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+        self.assertEqual(p.returncode, 0, p.stderr.decode())
+
+    def test_threaded_copy(self):
+
+        n = gm.get_max_threads()
+        M, N = 1500, 1000
+        x = xnd(list(range(M*N)), type="%d * int64" % (M*N))
+        x = x.reshape(M, N)
+
+        try:
+            gm.set_max_threads(1)
+            expected = [x.transpose().copy_contiguous(),
+                        x[::-3, 1::2].copy_contiguous()]
+
+            for nthreads in [2, 3, 8]:
+                gm.set_max_threads(nthreads)
+                for v, e in zip([x.transpose(), x[::-3, 1::2]], expected):
+                    y = v.copy_contiguous()
+                    self.assertEqual(y, e)
+
+                y = xnd.empty("%d * %d * float64" % (M, N))
+                y[:] = x
+                self.assertEqual(y[M-1][N-1], M*N-1)
+
+                y = xnd.empty("%d * %d * int16" % (M, N))
+                self.assertRaises(ValueError, y.__setitem__, slice(None), x)
+        finally:
+            gm.set_max_threads(n)
+
+    def test_threaded_copy_serial_fallback(self):
+
+        n = gm.get_max_threads()
+        N = 1100000
+
+        try:
+            # Overlapping source and destination.
+            expected = []
+            for nthreads in [1, 4]:
+                gm.set_max_threads(nthreads)
+                x = xnd(list(range(N)), type="%d * int64" % N)
+                x[1:] = x[:-1]
+                y = xnd(list(range(N)), type="%d * int64" % N)
+                y[:N//2] = y[::-2]
+                expected.append((x, y))
+            self.assertEqual(expected[0], expected[1])
+
+            # Dtypes that allocate.
+            gm.set_max_threads(4)
+            x = xnd(["a%d" % i for i in range(N)])
+            self.assertEqual(x.copy_contiguous(), x)
+            x = xnd([{"a": b"x" * (i % 3), "b": i} for i in range(N)])
+            self.assertEqual(x.copy_contiguous(), x)
+        finally:
+            gm.set_max_threads(n)
+
+
+class TestDispatchCache(unittest.TestCase):
+
+    def test_repeated_types(self):
+
+        x = xnd([1, 2, 3], dtype="int64")
+        y = xnd([1.5, 2.5, 3.5], dtype="float64")
+        z = xnd([[1, 2], [3, 4]], dtype="int8")
+
+        for _ in range(3):
+            ans = fn.add(x, x)
+            self.assertEqual(ans, xnd([2, 4, 6], dtype="int64"))
+
+            ans = fn.add(y, y)
+            self.assertEqual(ans, xnd([3.0, 5.0, 7.0], dtype="float64"))
+
+            ans = fn.add(z, z)
+            self.assertEqual(ans, xnd([[2, 4], [6, 8]], dtype="int8"))
+
+            # Same dtype, different layout.
+            ans = fn.add(z[::-1], z[::-1])
+            self.assertEqual(ans, xnd([[6, 8], [2, 4]], dtype="int8"))
+
+            ans = fn.add(z[0], z[1])
+            self.assertEqual(ans, xnd([4, 6], dtype="int8"))
+
+    def test_many_types(self):
+
+        dtypes = ["int8", "int16", "int32", "int64", "uint8", "uint16",
+                  "uint32", "uint64", "float32", "float64"]
+
+        for _ in range(2):
+            for dtype in dtypes:
+                x = xnd([1, 2, 3], dtype=dtype)
+                ans = fn.multiply(x, x)
+                self.assertEqual(ans, xnd([1, 4, 9], dtype=dtype))
+
+            self.assertRaises(ValueError, fn.add, xnd(["a"]), xnd(["b"]))
+
+    def test_signature_matcher(self):
+
+        # Candidates are rejected by the compiled matcher before ndt_typecheck().
+        x = xnd([[1, 2, 3], [4, 5, 6]], dtype="int64")
+        y = xnd([10, 20], dtype="int64")
+        ans = ex.add_scalar(x, y)
+        self.assertEqual(ans, xnd([[11, 12, 13], [24, 25, 26]], dtype="int64"))
+
+        self.assertRaises(TypeError, ex.add_scalar, x, xnd([1, 2], dtype="int32"))
+        self.assertRaises(TypeError, ex.add_scalar, xnd(1), xnd(2))
+
+        # Symbolic dimensions must agree across arguments.
+        for out, ok in [("2 * 3 * int64", True), ("2 * 4 * int64", False),
+                        ("2 * 3 * int32", False), ("3 * int64", False)]:
+            out = xnd.empty(out)
+            if ok:
+                ex.add_scalar(x, y, out=out)
+                self.assertEqual(out, xnd([[11, 12, 13], [24, 25, 26]], dtype="int64"))
+            else:
+                self.assertRaises(TypeError, ex.add_scalar, x, y, out=out)
+
+        # Option types only match option signatures.
+        a = xnd([[1, None, 3]], dtype="?int64")
+        self.assertRaises(TypeError, ex.add_scalar, a, xnd([1], dtype="int64"))
+
+        # Ragged arrays are not matched by the broadcast ellipsis.
+        r = xnd([[1], [2, 3]], dtype="int64")
+        self.assertRaises(TypeError, ex.add_scalar, r, xnd(1))
+
+    def test_error_message(self):
+
+        # Failed candidates do not format messages, the final error does.
+        x = xnd([1.5, 2.5], dtype="float64")
+        with self.assertRaisesRegex(TypeError, "could not find 'add_scalar' kernel"):
+            ex.add_scalar(x, x)
+
+
+class TestReduce(unittest.TestCase):
+
+    def test_reduce_kernels(self):
+
+        x = xnd([[3, -1, 2], [0, 5, -4]], dtype="int32")
+
+        self.assertEqual(fn.reduce_add(x), xnd([4, 1], dtype="int64"))
+        self.assertEqual(fn.reduce_add(x, dtype=ndt("int32")),
+                         xnd([4, 1], dtype="int32"))
+        self.assertEqual(fn.reduce_multiply(x), xnd([-6, 0], dtype="int64"))
+        self.assertEqual(fn.reduce_min(x), xnd([-1, -4], dtype="int32"))
+        self.assertEqual(fn.reduce_max(x), xnd([3, 5], dtype="int32"))
+        self.assertEqual(fn.reduce_argmin(x), xnd([1, 2], dtype="int64"))
+        self.assertEqual(fn.reduce_argmax(x), xnd([0, 1], dtype="int64"))
+        self.assertEqual(fn.reduce_mean(x), xnd([4/3, 1/3], dtype="float64"))
+
+        # Strided input.
+        self.assertEqual(fn.reduce_add(x[:, ::-2]), xnd([5, -4], dtype="int64"))
+
+        # Integer sums wrap around like the binary kernels.
+        y = xnd([100, 100], dtype="int8")
+        self.assertEqual(fn.reduce_add(y, dtype=ndt("int8")),
+                         xnd(-56, dtype="int8"))
+
+        self.assertEqual(fn.reduce_add(xnd([], dtype="float64")), 0)
+        self.assertEqual(fn.reduce_multiply(xnd([], dtype="float64")), 1)
+        self.assertRaises(ValueError, fn.reduce_min, xnd([], dtype="int64"))
+        self.assertRaises(ValueError, fn.reduce_argmax, xnd([], dtype="int64"))
+
+    def test_reduce_nan(self):
+
+        x = xnd([1.0, float("nan"), -3.0, float("nan")])
+
+        self.assertTrue(math.isnan(fn.reduce_min(x).value))
+        self.assertTrue(math.isnan(fn.reduce_max(x).value))
+        self.assertEqual(fn.reduce_argmin(x), 1)
+        self.assertEqual(fn.reduce_argmax(x), 1)
+
+    def test_reduce_optional(self):
+
+        x = xnd([[1, None, 3], [4, 5, 6]])
+
+        self.assertEqual(fn.reduce_add(x).value, [None, 15])
+        self.assertEqual(fn.reduce_min(x).value, [None, 4])
+        self.assertEqual(fn.reduce_argmax(x).value, [None, 2])
+
+    def test_reduce_float_accuracy(self):
+
+        N = 100000
+        x = xnd([0.1] * N, dtype="float32")
+
+        # Pairwise summation keeps the error far below that of a naive loop.
+        y = fn.reduce_add(x, dtype=ndt("float32"))
+        self.assertLess(abs(y.value - 0.1 * N), 1)
+
+    @unittest.skipIf(np is None, "numpy not found")
+    def test_reduce_axes(self):
+
+        a = np.arange(60, dtype="int16").reshape(3, 4, 5) - 30
+        x = xnd.from_buffer(a)
+
+        for axes in [0, 1, 2, (0, 1), (0, 2), (1, 2), (0, 1, 2), None]:
+            npaxes = (0, 1, 2) if axes is None else axes
+
+            ans = gm.reduce(fn.add, x, axes=axes)
+            self.assertEqual(ans.value, np.add.reduce(a, axis=npaxes, dtype="int64").tolist())
+
+            ans = gm.reduce(fn.multiply, x, axes=axes, dtype=ndt("int16"))
+            self.assertEqual(ans.value, np.multiply.reduce(a, axis=npaxes, dtype="int16").tolist())
+
+            ans = gm.reduce(fn.reduce_min, x, axes=axes)
+            self.assertEqual(ans.value, np.min(a, axis=npaxes).tolist())
+
+            ans = gm.reduce(fn.reduce_max, x, axes=axes)
+            self.assertEqual(ans.value, np.max(a, axis=npaxes).tolist())
+
+            ans = gm.reduce(fn.reduce_mean, x, axes=axes)
+            np.testing.assert_allclose(ans.value, np.mean(a, axis=npaxes))
+
+        for axis in [0, 1, 2]:
+            ans = gm.reduce(fn.reduce_argmin, x, axes=axis)
+            self.assertEqual(ans.value, np.argmin(a, axis=axis).tolist())
+
+            ans = gm.reduce(fn.reduce_argmax, x, axes=axis)
+            self.assertEqual(ans.value, np.argmax(a, axis=axis).tolist())
+
+        self.assertRaises(ValueError, gm.reduce, fn.reduce_argmin, x, axes=(0, 1))
+
+    def test_reduce_threaded(self):
+
+        n = gm.get_max_threads()
+        N = 2000003
+        x = xnd(list(range(N)), type="%d * int64" % N)
+
+        try:
+            for nthreads in [1, 2, 3, 8]:
+                gm.set_max_threads(nthreads)
+                self.assertEqual(gm.reduce(fn.add, x), N*(N-1)//2)
+                self.assertEqual(gm.reduce(fn.reduce_max, x), N-1)
+                self.assertEqual(gm.reduce(fn.reduce_min, x[::-1]), 0)
+        finally:
+            gm.set_max_threads(n)
+
+
+class TestISA(unittest.TestCase):
+
+    def supported_isas(self):
+        isas = []
+        for name in ["base", "avx2", "avx512"]:
+            try:
+                gm.set_isa(name)
+            except ValueError:
+                continue
+            isas.append(name)
+        return isas
+
+    def test_set_isa(self):
+
+        isa = gm.get_isa()
+        self.assertIn(isa, ["base", "avx2", "avx512"])
+
+        self.assertRaises(ValueError, gm.set_isa, "sse17")
+        self.assertRaises(TypeError, gm.set_isa, 1)
+        self.assertEqual(gm.get_isa(), isa)
+
+        try:
+            gm.set_isa("base")
+            self.assertEqual(gm.get_isa(), "base")
+        finally:
+            gm.set_isa(isa)
+
+    def test_isa_kernels(self):
+
+        isa = gm.get_isa()
+        N = 1003
+        a = [(i % 17) - 8 for i in range(N)]
+        b = [(i % 5) + 1 for i in range(N)]
+        f = [0.5 * v for v in a]
+
+        try:
+            for name in self.supported_isas():
+                gm.set_isa(name)
+
+                for dtype in ["int8", "int32", "int64", "float32", "float64"]:
+                    x = xnd(a, dtype=dtype)
+                    y = xnd(b, dtype=dtype)
+
+                    ans = fn.add(x, y)
+                    self.assertEqual(ans.value, [v+w for v, w in zip(a, b)])
+
+                    ans = fn.multiply(x, y)
+                    self.assertEqual(ans.value, [v*w for v, w in zip(a, b)])
+
+                    ans = fn.less(x, y)
+                    self.assertEqual(ans.value, [v<w for v, w in zip(a, b)])
+
+                    ans = fn.negative(x)
+                    self.assertEqual(ans.value, [-v for v in a])
+
+                    ans = fn.copy(x)
+                    self.assertEqual(ans.value, a)
+
+                    ans = fn.reduce_add(x)
+                    self.assertEqual(ans.value, sum(a))
+
+                    ans = fn.reduce_max(x)
+                    self.assertEqual(ans.value, max(a))
+
+                x = xnd(f, dtype="float64")
+                y = xnd(b, dtype="float64")
+                ans = fn.divide(x, y)
+                self.assertEqual(ans.value, [v/w for v, w in zip(f, b)])
+
+                # In-place operation.
+                x = xnd(a, dtype="int64")
+                fn.add(x, x, out=x)
+                self.assertEqual(x.value, [2*v for v in a])
+        finally:
+            gm.set_isa(isa)
+
+class TestMath(unittest.TestCase):
+
+    # Maximum float64 error in ulps, see kernels/vmath.h.
+    ulps = {
+      "exp": 1, "exp2": 2, "expm1": 2, "log": 1, "log2": 1, "log10": 1,
+      "log1p": 1, "sqrt": 0, "sin": 1, "cos": 1, "tanh": 3, "erf": 2
+    }
+
+    domains = {
+      "exp": (-745, 709), "exp2": (-1074, 1023), "expm1": (-50, 709),
+      "log": (1e-300, 1e300), "log2": (1e-300, 1e300),
+      "log10": (1e-300, 1e300), "log1p": (-0.999, 1e10),
+      "sqrt": (0, 1e300), "sin": (-1e7, 1e7), "cos": (-1e7, 1e7),
+      "tanh": (-30, 30), "erf": (-7, 7)
+    }
+
+    supported_isas = TestISA.supported_isas
+
+    def values(self, name):
+        lo, hi = self.domains[name]
+        N = 2000
+        if lo > 0:
+            l = math.log(lo)
+            r = math.log(hi) - l
+            a = [math.exp(l + r*i/N) for i in range(N)]
+        else:
+            a = [lo + (hi-lo)*i/N for i in range(N)]
+        # Small arguments.
+        a += [v * 1e-3 for v in range(-100, 101) if lo <= v * 1e-3 <= hi]
+        return a
+
+    def reference(self, name, v):
+        if name == "exp2":
+            return math.pow(2, v)
+        return getattr(math, name)(v)
+
+    def test_math_float64(self):
+
+        isa = gm.get_isa()
+
+        try:
+            for isa_name in self.supported_isas():
+                gm.set_isa(isa_name)
+
+                for name, ulps in self.ulps.items():
+                    f = getattr(fn, name)
+                    a = self.values(name)
+                    x = xnd(a, dtype="float64")
+                    ans = f(x).value
+
+                    for v, y in zip(a, ans):
+                        ref = self.reference(name, v)
+                        self.assertLessEqual(abs(y-ref), ulps*math.ulp(ref),
+                                             msg=(name, v, y, ref))
+
+                    # Strided input.
+                    self.assertEqual(f(x[::3]).value, ans[::3])
+                    self.assertEqual(f(x[::-1]).value, ans[::-1])
+        finally:
+            gm.set_isa(isa)
+
+    def test_math_float32(self):
+
+        for name in self.ulps:
+            f = getattr(fn, name)
+            a = [v for v in self.values(name) if abs(v) < 1e38]
+            x = xnd(a, dtype="float32")
+            ans = f(x).value
+
+            for v, y in zip(x.value, ans):
+                try:
+                    ref = xnd(self.reference(name, v), dtype="float32").value
+                except (OverflowError, ValueError):
+                    continue
+                if y == ref:
+                    continue
+                ulp = max(math.ulp(ref) * 2**29, 2**-149)
+                self.assertLessEqual(abs(y-ref), ulp, msg=(name, v, y, ref))
+
+    def test_math_special(self):
+
+        inf = float("inf")
+        nan = float("nan")
+        a = [0.0, -0.0, inf, -inf, nan, -1.0, 1.0, 1e-310, -1e-310, 1e308,
+             -1e308, 1e300, 5e-324]
+        b = [0.0, -0.0, inf, -inf, nan, -1.0, 1.0, 1e-40, -1e-40, 3e38,
+             -3e38, 1e30, 1e-45]
+
+        for dtype, values in [("float32", b), ("float64", a)]:
+            for name in self.ulps:
+                f = getattr(fn, name)
+                x = xnd(values, dtype=dtype)
+                ans = f(x).value
+
+                gm.set_strict_math(True)
+                try:
+                    expected = f(x).value
+                finally:
+                    gm.set_strict_math(False)
+
+                for v, y, ref in zip(x.value, ans, expected):
+                    if math.isnan(ref):
+                        self.assertTrue(math.isnan(y), msg=(name, v, y))
+                    elif math.isinf(ref) or ref == 0:
+                        self.assertEqual(y, ref, msg=(name, v, y, ref))
+                        self.assertEqual(math.copysign(1, y),
+                                         math.copysign(1, ref),
+                                         msg=(name, v, y, ref))
+
+    def test_strict_math(self):
+
+        self.assertFalse(gm.get_strict_math())
+
+        a = self.values("sin") + [1e22, -1e300, 0.5, 3.0]
+        x = xnd(a, dtype="float64")
+
+        gm.set_strict_math(True)
+        try:
+            self.assertTrue(gm.get_strict_math())
+            for name in ["exp", "log", "sin", "cos"]:
+                f = getattr(fn, name)
+                ans = f(x[::-1]).value
+                for v, y in zip(a[::-1], ans):
+                    try:
+                        ref = self.reference(name, v)
+                    except (OverflowError, ValueError):
+                        continue
+                    self.assertEqual(y, ref, msg=(name, v))
+        finally:
+            gm.set_strict_math(False)
+
+        self.assertFalse(gm.get_strict_math())
+
+
+class TestFloat16(unittest.TestCase):
+
+    supported_isas = TestISA.supported_isas
+
+    def half(self, v):
+        try:
+            return struct.unpack("<e", struct.pack("<e", v))[0]
+        except OverflowError:
+            return math.copysign(float("inf"), v)
+
+    def nan_to_none(self, a):
+        return [None if math.isnan(v) else v for v in a]
+
+    def values(self):
+        # All finite float16 values in [-256, 256].
+        a = []
+        for i in range(0x7c00):
+            v = struct.unpack("<e", struct.pack("<H", i))[0]
+            if v <= 256:
+                a.append(v)
+                a.append(-v)
+        return a
+
+    def test_arithmetic(self):
+
+        isa = gm.get_isa()
+        a = self.values()[::7]
+        b = [v for v in self.values()[::11] if v != 0]
+        b = (b * (len(a) // len(b) + 1))[:len(a)]
+
+        try:
+            for name in self.supported_isas():
+                gm.set_isa(name)
+
+                x = xnd(a, dtype="float16")
+                y = xnd(b, dtype="float16")
+
+                for f, op in [(fn.add, lambda v, w: v + w),
+                              (fn.subtract, lambda v, w: v - w),
+                              (fn.multiply, lambda v, w: v * w),
+                              (fn.divide, lambda v, w: v / w)]:
+                    ans = f(x, y)
+                    self.assertEqual(str(ans.type), "%d * float16" % len(a))
+                    self.assertEqual(ans.value,
+                                     [self.half(op(v, w)) for v, w in zip(a, b)])
+
+                    # Strided and scalar arguments.
+                    self.assertEqual(f(x[::-3], y[::-3]).value, ans.value[::-3])
+                    self.assertEqual(f(x[5], y[5]).value, ans.value[5])
+
+                self.assertEqual(fn.less(x, y).value,
+                                 [v < w for v, w in zip(a, b)])
+                self.assertEqual(fn.equal(x, x).value, [True] * len(a))
+                self.assertEqual(fn.negative(x).value, [-v for v in a])
+                self.assertEqual(fn.abs(x).value, [abs(v) for v in a])
+                self.assertEqual(fn.copy(x).value, a)
+
+                # Widening to float32.
+                z = xnd(b, dtype="float32")
+                self.assertEqual(fn.multiply(x, z).value,
+                                 [xnd(v * w, dtype="float32").value
+                                  for v, w in zip(a, b)])
+
+                # Mixed with an integer type.
+                z = xnd([i % 100 for i in range(len(a))], dtype="int8")
+                self.assertEqual(fn.add(x, z).value,
+                                 [self.half(v + (i % 100)) for i, v in enumerate(a)])
+        finally:
+            gm.set_isa(isa)
+
+    def test_special(self):
+
+        inf = float("inf")
+        nan = float("nan")
+        x = xnd([inf, -inf, nan, 65504.0, 6e-08, -0.0], dtype="float16")
+        y = xnd([1.0, inf, 1.0, 65504.0, 0.5, 0.0], dtype="float16")
+
+        ans = fn.add(x, y).value
+        self.assertEqual(ans[0], inf)
+        self.assertTrue(math.isnan(ans[1]))
+        self.assertTrue(math.isnan(ans[2]))
+        self.assertEqual(ans[3], inf)
+        self.assertEqual(ans[4], 0.5)
+        self.assertEqual(math.copysign(1, fn.add(x[5], y[5]).value), 1)
+        self.assertEqual(math.copysign(1, fn.negative(y[5]).value), -1)
+
+    def test_math(self):
+
+        a = self.values()[::3]
+        x = xnd(a, dtype="float16")
+
+        for name in ["exp", "exp2", "expm1", "log", "log2", "log10", "log1p",
+                     "sqrt", "cbrt", "sin", "cos", "tan", "atan", "sinh",
+                     "tanh", "erf", "erfc", "ceil", "floor", "trunc",
+                     "fabs"]:
+            f = getattr(fn, name)
+            ref = math.pow if name == "exp2" else getattr(math, name)
+            ans = f(x).value
+
+            for v, y in zip(a, ans):
+                try:
+                    expected = ref(2, v) if name == "exp2" else ref(v)
+                    expected = self.half(expected)
+                except (OverflowError, ValueError):
+                    continue
+                self.assertEqual(y, expected, msg=(name, v))
+
+            self.assertEqual(self.nan_to_none(f(x[::-2]).value),
+                             self.nan_to_none(ans[::-2]))
+
+    def test_divmod(self):
+
+        a = [7.5, -7.5, 7.5, -7.5, 1.0, 0.25]
+        b = [2.0, 2.0, -2.0, -2.0, 0.0625, 3.0]
+        x = xnd(a, dtype="float16")
+        y = xnd(b, dtype="float16")
+
+        q, r = fn.divmod(x, y)
+        self.assertEqual(q.value, [v // w for v, w in zip(a, b)])
+        self.assertEqual(r.value, [self.half(v % w) for v, w in zip(a, b)])
+
+        self.assertEqual(fn.floor_divide(x, y).value, q.value)
+        self.assertEqual(fn.remainder(x, y).value, r.value)
+
+        x = xnd([abs(v) for v in a], dtype="float16")
+        self.assertEqual(fn.power(x, y).value,
+                         [self.half(math.pow(abs(v), w)) for v, w in zip(a, b)])
+
+
+class TestDeferred(unittest.TestCase):
+
+    def test_fusion(self):
+
+        tile_bytes = gm._TILE_BYTES
+        sin = gm.defer(fn.sin)
+
+        try:
+            for tile in (1 << 17, 64, 8):
+                gm._TILE_BYTES = tile
+
+                for shape in [(100,), (37, 5), (7, 3, 4)]:
+                    n = math.prod(shape)
+                    x = xnd([float(i % 13) for i in range(n)]).reshape(*shape)
+                    y = xnd([float(i % 7) for i in range(n)]).reshape(*shape)
+                    z = xnd([i / n for i in range(n)]).reshape(*shape)
+
+                    ans = fn.subtract(fn.add(fn.multiply(x, y),
+                                             fn.multiply(fn.sin(z), y)),
+                                      fn.multiply(x, y))
+
+                    a, b = gm.defer(x), gm.defer(y)
+                    e = a * b + sin(z) * b - a * b
+                    self.assertIsInstance(e, gm.expr)
+                    self.assertEqual(e.eval(), ans)
+                    self.assertEqual(gm.evaluate(e), ans)
+
+                    out = xnd.empty(ans.type)
+                    self.assertIs(e.eval(out=out), out)
+                    self.assertEqual(out, ans)
+
+                    # Strided and transposed leaves.
+                    if len(shape) > 1:
+                        u = x[::-1]
+                        v = xnd(y.transpose().value).transpose()
+                        e = gm.defer(u) * 2 + gm.defer(v) * 1.5
+                        self.assertEqual(e.eval(),
+                            fn.add(fn.multiply(u, xnd(2, dtype="int8")),
+                                   fn.multiply(y, xnd(1.5))))
+        finally:
+            gm._TILE_BYTES = tile_bytes
+
+    def test_broadcast(self):
+
+        tile_bytes = gm._TILE_BYTES
+        gm._TILE_BYTES = 64
+
+        try:
+            x = xnd([[float(i * 10 + j) for j in range(10)] for i in range(30)])
+            row = xnd([float(j) for j in range(10)])
+            col = xnd([[float(i)] for i in range(30)])
+            first = x[0:1]
+
+            e = (gm.defer(x) - row) * col + first - 1
+            ans = [[(x[i][j].value - j) * i + j - 1 for j in range(10)]
+                   for i in range(30)]
+            self.assertEqual(e.eval(), ans)
+
+            # Invariant subexpressions.
+            e = gm.defer(row) * row + col
+            self.assertEqual(e.eval(), [[j * j + i for j in range(10)]
+                                        for i in range(30)])
+
+            self.assertRaises(TypeError, (gm.defer(x) + xnd([1.0, 2.0])).eval)
+        finally:
+            gm._TILE_BYTES = tile_bytes
+
+    def test_optional(self):
+
+        tile_bytes = gm._TILE_BYTES
+        gm._TILE_BYTES = 16
+
+        try:
+            a = [None if i % 5 == 0 else float(i) for i in range(100)]
+            b = [None if i % 3 == 0 else float(i) for i in range(100)]
+            x = xnd(a, dtype="?float64")
+            y = xnd(b, dtype="?float64")
+
+            e = gm.defer(x) * y + x
+            ans = [None if v is None or w is None else v * w + v
+                   for v, w in zip(a, b)]
+            self.assertEqual(e.eval(), ans)
+        finally:
+            gm._TILE_BYTES = tile_bytes
+
+    def test_array(self):
+
+        x = array([[1.0, 2.0], [3.0, 4.0]])
+        y = array([[5.0, 6.0], [7.0, 8.0]])
+
+        with gm.deferred():
+            e = x * y + 1 - x
+            c = x < y
+            n = -x
+
+        self.assertIsInstance(e, gm.expr)
+        r = e.eval()
+        self.assertIsInstance(r, array)
+        self.assertEqual(r.value, [[5.0, 11.0], [19.0, 29.0]])
+        self.assertEqual(c.eval().value, [[True, True], [True, True]])
+        self.assertEqual(n.eval().value, [[-1.0, -2.0], [-3.0, -4.0]])
+
+        # Outside of the context, arrays are evaluated eagerly.
+        self.assertIsInstance(x * y, array)
+
+        # Mixing arrays and expressions records.
+        e = x + gm.defer(y)
+        self.assertIsInstance(e, gm.expr)
+        self.assertIsInstance(x == e, gm.expr)
+        self.assertEqual((x == e).eval().value, [[False] * 2] * 2)
+
+        # In-place operators evaluate into the destination.
+        z = array([[1.0, 2.0], [3.0, 4.0]])
+        with gm.deferred():
+            z += x * y
+        self.assertIsInstance(z, array)
+        self.assertEqual(z.value, [[6.0, 14.0], [24.0, 36.0]])
+
+        self.assertRaises(TypeError, bool, e)
+
+    def test_recorder(self):
+
+        x = array([1.0, 2.0])
+        self.assertIsNone(array._recorder)
+        with gm.deferred():
+            self.assertIsNotNone(array._recorder)
+            with gm.deferred():
+                pass
+            self.assertIsInstance(x + x, gm.expr)
+        self.assertIsNone(array._recorder)
+        self.assertIsInstance(x + x, array)
+
+    def test_out_alias(self):
+
+        tile_bytes = gm._TILE_BYTES
+        gm._TILE_BYTES = 64
+
+        try:
+            n = 100
+            for out, src in [(slice(None, None, -1), slice(None)),
+                             (slice(1, None), slice(None, -1)),
+                             (slice(None, -1), slice(1, None))]:
+                v = [float(i) for i in range(n)]
+                x = xnd(v)
+                e = gm.defer(x[src]) * 2 + gm.defer(x[src])
+                dest = x[out]
+                self.assertIs(e.eval(out=dest), dest)
+                expected = list(v)
+                expected[out] = [3 * w for w in v[src]]
+                self.assertEqual(x, expected)
+
+            x = array([[float(i * 10 + j) for j in range(10)] for i in range(30)])
+            y = array([[float(j) for j in range(10)] for i in range(30)])
+            with gm.deferred():
+                x += x * y
+            self.assertEqual(x.value, [[(i * 10 + j) * (1 + j) for j in range(10)]
+                                       for i in range(30)])
+        finally:
+            gm._TILE_BYTES = tile_bytes
+
+    def test_cse(self):
+
+        calls = []
+        sin = fn.sin
+
+        class Counter(object):
+            def __getattr__(self, name):
+                f = getattr(fn, name)
+                def g(*args, **kwargs):
+                    calls.append(name)
+                    return f(*args, **kwargs)
+                return g
+
+        x = xnd([0.5, 1.0, 1.5])
+        a = gm.defer(x)
+        s = gm.defer(sin)
+
+        e = s(a) * s(a) + s(a) * s(a)
+        saved = gm._fn
+        gm._fn = Counter()
+        try:
+            r = e.eval()
+        finally:
+            gm._fn = saved
+
+        self.assertEqual(sorted(calls), ["add", "multiply", "sin"])
+        t = fn.multiply(fn.sin(x), fn.sin(x))
+        self.assertEqual(r, fn.add(t, t))
+
+    def test_defer(self):
+
+        x = xnd([1.0, 2.0, 3.0])
+        self.assertRaises(ValueError, gm.defer, fn.reduce_add)
+        self.assertRaises(ValueError, gm.defer, 1)
+        self.assertRaises(TypeError, gm.evaluate, x)
+
+        # Leaves and scalars.
+        self.assertEqual(gm.defer(x).eval(), x)
+        self.assertEqual((gm.defer(xnd(2.0)) * 3).eval(), 6.0)
+
+        add = gm.defer(fn.add)
+        e = add(x, 10)
+        self.assertEqual(e.eval(), [11.0, 12.0, 13.0])
+        self.assertEqual(add(x, x, out=xnd.empty("3 * float64")), [2.0, 4.0, 6.0])
+
+    def test_threads(self):
+
+        max_threads = gm.get_max_threads()
+        tile_bytes = gm._TILE_BYTES
+        thread_cutoff = gm._THREAD_CUTOFF
+        gm.set_max_threads(4)
+        gm._TILE_BYTES = 256
+        gm._THREAD_CUTOFF = 1000
+
+        try:
+            n = 5003
+            x = xnd([float(i % 101) for i in range(n)])
+            y = xnd([float(i % 17) for i in range(n)])
+            e = gm.defer(x) * y - gm.defer(x) / 2
+            self.assertEqual(e.eval(), [v * w - v / 2 for v, w in
+                                        zip(x.value, y.value)])
+
+            # Wide rows: the tiles cover the flattened index space.
+            u = x[:5000].reshape(2, 2500)
+            v = y[:5000].reshape(2, 2500)
+            e = gm.defer(u) * v + 1
+            ans = [[a * b + 1 for a, b in zip(r, s)]
+                   for r, s in zip(u.value, v.value)]
+            self.assertEqual(e.eval(), ans)
+
+            out = xnd.empty("2 * 2500 * float64")
+            self.assertIs(e.eval(out=out), out)
+            self.assertEqual(out, ans)
+
+            # Broadcasting: the tiles are slices of the first dimension.
+            col = xnd([[float(i)] for i in range(500)])
+            e = gm.defer(x[:5000].reshape(500, 10)) * col
+            self.assertEqual(e.eval(), [[x[10*i+j].value * i for j in range(10)]
+                                        for i in range(500)])
+        finally:
+            gm.set_max_threads(max_threads)
+            gm._TILE_BYTES = tile_bytes
+            gm._THREAD_CUTOFF = thread_cutoff
+
+
 class LongIndexSliceTest(unittest.TestCase):
 
     def test_subarray(self):
@@ -1857,6 +2958,13 @@ ALL_TESTS = [
   TestBitwiseCUDA,
   TestFunctions,
   TestCudaManaged,
+  TestThreads,
+  TestDispatchCache,
+  TestReduce,
+  TestISA,
+  TestMath,
+  TestFloat16,
+  TestDeferred,
   LongIndexSliceTest,
 ]
 
@@ -0,0 +1,597 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2017-2018, plures
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "ndtypes.h"
+#include "cache.h"
+
+#ifdef _MSC_VER
+  #include <windows.h>
+#else
+  #include <stdatomic.h>
+#endif
+
+
+/*
+ * Cache for the results of ndt_from_string() and ndt_from_bpformat().  Types
+ * are immutable, so the same reference counted type can be returned for all
+ * occurrences of an input string.  Only successful parses are cached.
+ *
+ * The cache is 4-way set associative with LRU replacement within a set.  The
+ * key is the input string together with the parser that was used.
+ */
+
+
+/*****************************************************************************/
+/*                                  Lock                                     */
+/*****************************************************************************/
+
+#ifdef _MSC_VER
+static SRWLOCK lock = SRWLOCK_INIT;
+#define CACHE_LOCK() AcquireSRWLockExclusive(&lock)
+#define CACHE_UNLOCK() ReleaseSRWLockExclusive(&lock)
+#else
+/* The critical sections are a few comparisons, so a spin lock suffices. */
+static atomic_flag lock = ATOMIC_FLAG_INIT;
+#define CACHE_LOCK() \
+    while (atomic_flag_test_and_set_explicit(&lock, memory_order_acquire)) {}
+#define CACHE_UNLOCK() atomic_flag_clear_explicit(&lock, memory_order_release)
+#endif
+
+
+/*****************************************************************************/
+/*                                 Entries                                   */
+/*****************************************************************************/
+
+#define CACHE_WAYS 4
+#define CACHE_SETS 256
+
+typedef struct {
+    uint64_t hash;
+    size_t len;
+    enum ndt_parse_kind kind;
+    char *key;
+    const ndt_t *type;
+    uint64_t used;
+} entry_t;
+
+static entry_t entries[CACHE_SETS][CACHE_WAYS];
+static bool enabled = true;
+static uint64_t tick = 0;
+static int64_t hits = 0;
+static int64_t misses = 0;
+static int64_t size = 0;
+
+
+static uint64_t
+fnv1a(const char *s, size_t len)
+{
+    uint64_t h = 14695981039346656037ULL;
+
+    for (size_t i = 0; i < len; i++) {
+        h ^= (unsigned char)s[i];
+        h *= 1099511628211ULL;
+    }
+
+    return h;
+}
+
+static entry_t *
+find(entry_t *set, uint64_t hash, enum ndt_parse_kind kind, const char *input,
+     size_t len)
+{
+    for (int i = 0; i < CACHE_WAYS; i++) {
+        entry_t *e = &set[i];
+        if (e->type != NULL && e->hash == hash && e->kind == kind &&
+            e->len == len && memcmp(e->key, input, len) == 0) {
+            return e;
+        }
+    }
+
+    return NULL;
+}
+
+/* Return a new reference to the cached type for 'input' or NULL. */
+const ndt_t *
+ndt_parse_cache_lookup(enum ndt_parse_kind kind, const char *input)
+{
+    const size_t len = strlen(input);
+    const uint64_t hash = fnv1a(input, len);
+    const ndt_t *t = NULL;
+    entry_t *e;
+
+    CACHE_LOCK();
+    if (enabled) {
+        e = find(entries[hash%CACHE_SETS], hash, kind, input, len);
+        if (e != NULL) {
+            e->used = ++tick;
+            t = e->type;
+            ndt_incref(t);
+            hits++;
+        }
+        else {
+            misses++;
+        }
+    }
+    CACHE_UNLOCK();
+
+    return t;
+}
+
+/*
+ * Insert a successfully parsed type.  Failure to allocate the key is not an
+ * error, the type is just not cached.
+ */
+void
+ndt_parse_cache_insert(enum ndt_parse_kind kind, const char *input, const ndt_t *t)
+{
+    const size_t len = strlen(input);
+    const uint64_t hash = fnv1a(input, len);
+    entry_t *set = entries[hash%CACHE_SETS];
+    entry_t old = {0};
+    entry_t *e;
+    char *key;
+    bool skip;
+
+    CACHE_LOCK();
+    skip = !enabled;
+    CACHE_UNLOCK();
+
+    if (skip) {
+        return;
+    }
+
+    key = ndt_alloc_size(len+1);
+    if (key == NULL) {
+        return;
+    }
+    memcpy(key, input, len+1);
+
+    CACHE_LOCK();
+    if (!enabled || find(set, hash, kind, input, len) != NULL) {
+        CACHE_UNLOCK();
+        ndt_free(key);
+        return;
+    }
+
+    e = &set[0];
+    for (int i = 0; i < CACHE_WAYS && e->type != NULL; i++) {
+        if (set[i].type == NULL || set[i].used < e->used) {
+            e = &set[i];
+        }
+    }
+
+    if (e->type != NULL) {
+        old = *e;
+    }
+    else {
+        size++;
+    }
+
+    ndt_incref(t);
+    e->hash = hash;
+    e->len = len;
+    e->kind = kind;
+    e->key = key;
+    e->type = t;
+    e->used = ++tick;
+    CACHE_UNLOCK();
+
+    ndt_free(old.key);
+    ndt_decref(old.type);
+}
+
+
+/*****************************************************************************/
+/*                                  API                                      */
+/*****************************************************************************/
+
+/* Remove all entries and reset the statistics. */
+void
+ndt_parse_cache_clear(void)
+{
+    for (int i = 0; i < CACHE_SETS; i++) {
+        for (int k = 0; k < CACHE_WAYS; k++) {
+            entry_t old;
+
+            CACHE_LOCK();
+            old = entries[i][k];
+            entries[i][k] = (entry_t){0};
+            CACHE_UNLOCK();
+
+            ndt_free(old.key);
+            ndt_decref(old.type);
+        }
+    }
+
+    CACHE_LOCK();
+    hits = misses = size = 0;
+    tick = 0;
+    CACHE_UNLOCK();
+}
+
+/* Enable or disable the cache.  Disabling also clears it.  Returns the
+   previous setting. */
+bool
+ndt_parse_cache_enable(bool flag)
+{
+    bool prev;
+
+    CACHE_LOCK();
+    prev = enabled;
+    enabled = flag;
+    CACHE_UNLOCK();
+
+    if (!flag) {
+        ndt_parse_cache_clear();
+    }
+
+    return prev;
+}
+
+void
+ndt_parse_cache_stats(ndt_parse_cache_stats_t *stats)
+{
+    CACHE_LOCK();
+    stats->enabled = enabled;
+    stats->hits = hits;
+    stats->misses = misses;
+    stats->size = size;
+    stats->capacity = CACHE_SETS*CACHE_WAYS;
+    CACHE_UNLOCK();
+}
+
+
+/*****************************************************************************/
+/*                               Interning                                   */
+/*****************************************************************************/
+
+/*
+ * Table of canonical types.  ndt_intern() returns the canonical instance of a
+ * type, so that structurally equal types share memory and ndt_equal() succeeds
+ * on the pointer comparison.
+ *
+ * The table does not own references.  A type removes itself in ndt_del() when
+ * its last reference goes away, and a lookup only returns a type whose
+ * reference count is still positive.  A type that is being deallocated
+ * concurrently is therefore never resurrected.
+ */
+
+#ifdef _MSC_VER
+static SRWLOCK intern_lock = SRWLOCK_INIT;
+#define INTERN_LOCK() AcquireSRWLockExclusive(&intern_lock)
+#define INTERN_UNLOCK() ReleaseSRWLockExclusive(&intern_lock)
+#else
+static atomic_flag intern_lock = ATOMIC_FLAG_INIT;
+#define INTERN_LOCK() \
+    while (atomic_flag_test_and_set_explicit(&intern_lock, memory_order_acquire)) {}
+#define INTERN_UNLOCK() atomic_flag_clear_explicit(&intern_lock, memory_order_release)
+#endif
+
+#define INTERN_MIN_BUCKETS 64
+
+typedef struct intern_entry {
+    uint64_t hash;
+    const ndt_t *type;
+    struct intern_entry *next;
+} intern_entry_t;
+
+static intern_entry_t **buckets = NULL;
+static int64_t nbuckets = 0;
+static int64_t ninterned = 0;
+static bool intern_enabled = false;
+
+
+/* ndt_hash() is structural, cached and cannot fail. */
+static inline uint64_t
+intern_hash(const ndt_t *t)
+{
+    return (uint64_t)ndt_hash(t, NULL);
+}
+
+/* Increment the reference count unless it has already dropped to zero. */
+static bool
+incref_if_alive(const ndt_t *t)
+{
+    ndt_t *u = (ndt_t *)t;
+#ifdef _MSC_VER
+    int64_t n = u->refcnt;
+
+    while (n > 0) {
+        int64_t m = InterlockedCompareExchange64(&u->refcnt, n+1, n);
+        if (m == n) {
+            return true;
+        }
+        n = m;
+    }
+#else
+    int64_t n = atomic_load(&u->refcnt);
+
+    while (n > 0) {
+        if (atomic_compare_exchange_weak(&u->refcnt, &n, n+1)) {
+            return true;
+        }
+    }
+#endif
+
+    return false;
+}
+
+/* Called with the lock held.  Failure to grow the table is not an error. */
+static void
+intern_grow(void)
+{
+    int64_t n = nbuckets == 0 ? INTERN_MIN_BUCKETS : 2 * nbuckets;
+    intern_entry_t **b;
+
+    b = ndt_calloc(n, sizeof *b);
+    if (b == NULL) {
+        return;
+    }
+
+    for (int64_t i = 0; i < nbuckets; i++) {
+        intern_entry_t *e = buckets[i];
+        while (e != NULL) {
+            intern_entry_t *next = e->next;
+            e->next = b[e->hash & (n-1)];
+            b[e->hash & (n-1)] = e;
+            e = next;
+        }
+    }
+
+    ndt_free(buckets);
+    buckets = b;
+    nbuckets = n;
+}
+
+/*
+ * Replace the subtypes of an exclusively owned type by their canonical
+ * instances.  Each subtype reference is stolen by ndt_intern().
+ */
+static void
+intern_children(ndt_t *t)
+{
+    int64_t i;
+
+    switch (t->tag) {
+    case Module:
+        t->Module.type = ndt_intern(t->Module.type);
+        return;
+    case Function:
+        for (i = 0; i < t->Function.nargs; i++) {
+            t->Function.types[i] = ndt_intern(t->Function.types[i]);
+        }
+        return;
+    case FixedDim:
+        t->FixedDim.type = ndt_intern(t->FixedDim.type);
+        return;
+    case VarDim: case VarDimElem:
+        t->VarDim.type = ndt_intern(t->VarDim.type);
+        return;
+    case SymbolicDim:
+        t->SymbolicDim.type = ndt_intern(t->SymbolicDim.type);
+        return;
+    case EllipsisDim:
+        t->EllipsisDim.type = ndt_intern(t->EllipsisDim.type);
+        return;
+    case Array:
+        t->Array.type = ndt_intern(t->Array.type);
+        return;
+    case Tuple:
+        for (i = 0; i < t->Tuple.shape; i++) {
+            t->Tuple.types[i] = ndt_intern(t->Tuple.types[i]);
+        }
+        return;
+    case Record:
+        for (i = 0; i < t->Record.shape; i++) {
+            t->Record.types[i] = ndt_intern(t->Record.types[i]);
+        }
+        return;
+    case Union:
+        for (i = 0; i < t->Union.ntags; i++) {
+            t->Union.types[i] = ndt_intern(t->Union.types[i]);
+        }
+        return;
+    case Ref:
+        t->Ref.type = ndt_intern(t->Ref.type);
+        return;
+    case Constr:
+        t->Constr.type = ndt_intern(t->Constr.type);
+        return;
+    case Nominal:
+        t->Nominal.type = ndt_intern(t->Nominal.type);
+        return;
+    default:
+        return;
+    }
+}
+
+/*
+ * Steal a reference to 't' and return a new reference to the canonical
+ * instance of 't'.  If 't' is not shared, its subtypes are interned first.
+ * This function cannot fail: if memory is short, 't' itself is returned.
+ */
+const ndt_t *
+ndt_intern(const ndt_t *t)
+{
+    const ndt_t *u = NULL;
+    intern_entry_t *e, *p;
+    uint64_t hash;
+
+    if (t == NULL || ndt_is_static(t)) {
+        return t;
+    }
+
+    if (t->refcnt == 1 && !t->interned) {
+        intern_children((ndt_t *)t);
+    }
+
+    hash = intern_hash(t);
+
+    e = ndt_alloc_size(sizeof *e);
+
+    INTERN_LOCK();
+    if (ninterned >= nbuckets) {
+        intern_grow();
+    }
+
+    if (nbuckets > 0) {
+        for (p = buckets[hash & (nbuckets-1)]; p != NULL; p = p->next) {
+            if (p->type == t) {
+                u = t;
+                break;
+            }
+            if (p->hash == hash && ndt_equal(p->type, t) &&
+                incref_if_alive(p->type)) {
+                u = p->type;
+                break;
+            }
+        }
+
+        if (u == NULL && e != NULL) {
+            e->hash = hash;
+            e->type = t;
+            e->next = buckets[hash & (nbuckets-1)];
+            buckets[hash & (nbuckets-1)] = e;
+            ((ndt_t *)t)->interned = true;
+            ninterned++;
+            e = NULL;
+        }
+    }
+    INTERN_UNLOCK();
+
+    ndt_free(e);
+
+    if (u != NULL && u != t) {
+        ndt_decref(t);
+        return u;
+    }
+
+    return t;
+}
+
+/* Intern the result of a parser if automatic interning is enabled. */
+const ndt_t *
+ndt_intern_parsed(const ndt_t *t)
+{
+    bool flag;
+
+    INTERN_LOCK();
+    flag = intern_enabled;
+    INTERN_UNLOCK();
+
+    return flag ? ndt_intern(t) : t;
+}
+
+/* Called by ndt_del() while the subtypes of 't' are still alive. */
+void
+ndt_intern_remove(const ndt_t *t)
+{
+    const uint64_t hash = intern_hash(t);
+    intern_entry_t *e = NULL;
+    intern_entry_t **pp;
+
+    INTERN_LOCK();
+    if (nbuckets > 0) {
+        for (pp = &buckets[hash & (nbuckets-1)]; *pp != NULL; pp = &(*pp)->next) {
+            if ((*pp)->type == t) {
+                e = *pp;
+                *pp = e->next;
+                ninterned--;
+                break;
+            }
+        }
+    }
+    INTERN_UNLOCK();
+
+    ndt_free(e);
+}
+
+/* Release the table.  Types that are still alive are no longer canonical. */
+void
+ndt_intern_finalize(void)
+{
+    INTERN_LOCK();
+    for (int64_t i = 0; i < nbuckets; i++) {
+        intern_entry_t *e = buckets[i];
+        while (e != NULL) {
+            intern_entry_t *next = e->next;
+            ((ndt_t *)e->type)->interned = false;
+            ndt_free(e);
+            e = next;
+        }
+    }
+
+    ndt_free(buckets);
+    buckets = NULL;
+    nbuckets = 0;
+    ninterned = 0;
+    INTERN_UNLOCK();
+}
+
+/*
+ * Enable or disable interning of the types returned by ndt_from_string() and
+ * ndt_from_bpformat().  Enabling clears the parse cache, which may hold types
+ * that are not canonical.  Returns the previous setting.
+ */
+bool
+ndt_intern_enable(bool flag)
+{
+    bool prev;
+
+    INTERN_LOCK();
+    prev = intern_enabled;
+    intern_enabled = flag;
+    INTERN_UNLOCK();
+
+    if (flag && !prev) {
+        ndt_parse_cache_clear();
+    }
+
+    return prev;
+}
+
+/* Return the number of canonical types. */
+int64_t
+ndt_intern_size(void)
+{
+    int64_t n;
+
+    INTERN_LOCK();
+    n = ninterned;
+    INTERN_UNLOCK();
+
+    return n;
+}
@@ -35,6 +35,7 @@
 #include <assert.h>
 #include <setjmp.h>
 #include "ndtypes.h"
+#include "cache.h"
 #include "bpgrammar.h"
 #include "bplexer.h"
 
@@ -49,8 +50,8 @@ int ndt_bpdebug = 1;
 jmp_buf ndt_bp_lexerror;
 
 
-const ndt_t *
-ndt_from_bpformat(const char *input, ndt_context_t *ctx)
+static const ndt_t *
+_ndt_from_bpformat(const char *input, ndt_context_t *ctx)
 {
     volatile yyscan_t scanner = NULL;
     volatile YY_BUFFER_STATE state = NULL;
@@ -108,3 +109,22 @@ ndt_from_bpformat(const char *input, ndt_context_t *ctx)
         return NULL;
     }
 }
+
+const ndt_t *
+ndt_from_bpformat(const char *input, ndt_context_t *ctx)
+{
+    const ndt_t *t;
+
+    t = ndt_parse_cache_lookup(NDT_PARSE_BPFORMAT, input);
+    if (t != NULL) {
+        return t;
+    }
+
+    t = _ndt_from_bpformat(input, ctx);
+    if (t != NULL) {
+        t = ndt_intern_parsed(t);
+        ndt_parse_cache_insert(NDT_PARSE_BPFORMAT, input, t);
+    }
+
+    return t;
+}
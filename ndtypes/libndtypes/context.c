@@ -86,6 +86,16 @@ ndt_err_format(ndt_context_t *ctx, enum ndt_error err, const char *fmt, ...)
     ndt_err_clear(ctx);
     ctx->err = err;
 
+    /*
+     * The caller discards the message, e.g. when trying candidate kernels.
+     * Skip the formatting and the allocation.
+     */
+    if (ctx->flags & NDT_Probe) {
+        ctx->msg = ConstMsg;
+        ctx->ConstMsg = ndt_err_as_string(err);
+        return;
+    }
+
     va_start(ap, fmt);
     va_copy(aq, ap);
 
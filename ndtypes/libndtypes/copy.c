@@ -433,6 +433,7 @@ ndt_copy(const ndt_t *t, ndt_context_t *ctx)
         }
         *u = *t;
         u->refcnt = 1;
+        u->interned = false;
         return u;
     }
 
@@ -176,6 +176,11 @@ offsets_equal(const ndt_offsets_t *x, const ndt_offsets_t *y)
 int
 ndt_equal(const ndt_t *t, const ndt_t *u)
 {
+    /* Shared and interned types. */
+    if (t == u) {
+        return 1;
+    }
+
     if (!ndt_common_equal(t, u)) {
         return 0;
     }
@@ -80,24 +80,28 @@ static int
 resolve_broadcast(symtable_entry_t w, symtable_t *tbl, ndt_context_t *ctx)
 {
     const char *key = "00_ELLIPSIS";
-    symtable_entry_t *v;
+    symtable_entry_t v;
     int vsize;
 
-    v = symtable_find_ptr(tbl, key);
-    if (v == NULL) {
+    v = symtable_find(tbl, key);
+    if (v.tag == Unbound) {
         if (symtable_add(tbl, key, w, ctx) < 0) {
             return -1;
         }
         return 1;
     }
 
-    vsize = _resolve_broadcast(v->BroadcastSeq.dims, v->BroadcastSeq.size,
+    vsize = _resolve_broadcast(v.BroadcastSeq.dims, v.BroadcastSeq.size,
                                w.BroadcastSeq.dims, w.BroadcastSeq.size);
     if (vsize < 0) {
         ndt_err_format(ctx, NDT_TypeError, "broadcast error");
         return -1;
     }
-    v->BroadcastSeq.size = vsize;
+    v.BroadcastSeq.size = vsize;
+
+    if (symtable_update(tbl, key, v, ctx) < 0) {
+        return -1;
+    }
 
     return 1;
 }
@@ -761,20 +765,16 @@ match_datashape_top(const ndt_t *p, const ndt_t *c, int64_t linear_index,
 int
 ndt_match(const ndt_t *p, const ndt_t *c, ndt_context_t *ctx)
 {
-    symtable_t *tbl;
+    symtable_t tbl;
     int ret;
 
     if (ndt_is_abstract(c)) {
         return 0;
     }
 
-    tbl = symtable_new(ctx);
-    if (tbl == NULL) {
-        return -1;
-    }
-
-    ret = match_datashape_top(p, c, 0, tbl, ctx);
-    symtable_del(tbl);
+    symtable_init(&tbl);
+    ret = match_datashape_top(p, c, 0, &tbl, ctx);
+    symtable_clear(&tbl);
     return ret;
 }
 
@@ -935,7 +935,8 @@ ndt_typecheck(ndt_apply_spec_t *spec, const ndt_t *sig,
               const ndt_constraint_t *c, const void *args,
               ndt_context_t *ctx)
 {
-    symtable_t *tbl;
+    symtable_t table;
+    symtable_t *tbl = &table;
     const ndt_t *t;
     const char *name;
     const int nargs = nin + nout;
@@ -990,15 +991,12 @@ ndt_typecheck(ndt_apply_spec_t *spec, const ndt_t *sig,
         }
     }
 
-    tbl = symtable_new(ctx);
-    if (tbl == NULL) {
-        return -1;
-    }
+    symtable_init(tbl);
 
     for (i = 0; i < nargs; i++) {
         ret = match_datashape_top(sig->Function.types[i], types[i], li[i], tbl, ctx);
         if (ret <= 0) {
-            symtable_del(tbl);
+            symtable_clear(tbl);
 
             if (ret == 0) {
                 ndt_err_format(ctx, NDT_TypeError,
@@ -1010,7 +1008,7 @@ ndt_typecheck(ndt_apply_spec_t *spec, const ndt_t *sig,
     }
 
     if (c != NULL && resolve_constraint(c, args, tbl, ctx) < 0) {
-        symtable_del(tbl);
+        symtable_clear(tbl);
         return -1;
     }
 
@@ -1028,7 +1026,7 @@ ndt_typecheck(ndt_apply_spec_t *spec, const ndt_t *sig,
             spec->types[nin+i] = ndt_substitute(sig->Function.types[nin+i], tbl, false, ctx);
             if (spec->types[nin+i] == NULL) {
                 ndt_apply_spec_clear(spec);
-                symtable_del(tbl);
+                symtable_clear(tbl);
                 return -1;
             }
             spec->nout++;
@@ -1048,7 +1046,7 @@ ndt_typecheck(ndt_apply_spec_t *spec, const ndt_t *sig,
             ndt_err_format(ctx, NDT_RuntimeError,
                "unexpected configuration of ellipsis flag and function types");
             ndt_apply_spec_clear(spec);
-            symtable_del(tbl);
+            symtable_clear(tbl);
             return -1;
         }
 
@@ -1077,20 +1075,20 @@ ndt_typecheck(ndt_apply_spec_t *spec, const ndt_t *sig,
                 ndt_err_format(ctx, NDT_RuntimeError,
                     "unexpected missing dimension list entry");
                 ndt_apply_spec_clear(spec);
-                symtable_del(tbl);
+                symtable_clear(tbl);
                 return -1;
             }
         }
         else {
             if (broadcast_all(spec, sig, check_broadcast, tbl, ctx) < 0) {
                 ndt_apply_spec_clear(spec);
-                symtable_del(tbl);
+                symtable_clear(tbl);
                 return -1;
             }
         }
     }
 
-    symtable_del(tbl);
+    symtable_clear(tbl);
 
     if (nout == 0) {
         for (i = 0; i < sig->Function.nout; i++) {
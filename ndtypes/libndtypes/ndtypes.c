@@ -43,6 +43,7 @@
 #include <complex.h>
 #include <assert.h>
 #include "ndtypes.h"
+#include "cache.h"
 #include "overflow.h"
 #include "slice.h"
 
@@ -933,6 +934,8 @@ ndt_new(enum ndt tag, uint32_t flags, ndt_context_t *ctx)
     t->align = UINT16_MAX;
 
     t->refcnt = 1;
+    t->interned = false;
+    t->hash = 0;
 
     return t;
 }
@@ -964,6 +967,8 @@ ndt_new_extra(enum ndt tag, int64_t n, uint32_t flags, ndt_context_t *ctx)
     t->align = UINT16_MAX;
 
     t->refcnt = 1;
+    t->interned = false;
+    t->hash = 0;
 
     return t;
 }
@@ -1142,6 +1147,10 @@ ndt_del(ndt_t *t)
         return;
     }
 
+    if (t->interned) {
+        ndt_intern_remove(t);
+    }
+
     switch (t->tag) {
     case Module: {
         ndt_free(t->Module.name);
@@ -35,6 +35,7 @@
 #include <assert.h>
 #include <setjmp.h>
 #include "ndtypes.h"
+#include "cache.h"
 #include "seq.h"
 #include "grammar.h"
 #include "lexer.h"
@@ -188,16 +189,35 @@ _ndt_from_string(const char *input, ndt_context_t *ctx)
     }
 }
 
+static const ndt_t *
+_ndt_from_string_cached(const char *input, ndt_context_t *ctx)
+{
+    const ndt_t *t;
+
+    t = ndt_parse_cache_lookup(NDT_PARSE_DATASHAPE, input);
+    if (t != NULL) {
+        return t;
+    }
+
+    t = _ndt_from_string(input, ctx);
+    if (t != NULL) {
+        t = ndt_intern_parsed(t);
+        ndt_parse_cache_insert(NDT_PARSE_DATASHAPE, input, t);
+    }
+
+    return t;
+}
+
 const ndt_t *
 ndt_from_string(const char *input, ndt_context_t *ctx)
 {
-    return _ndt_from_string(input, ctx);
+    return _ndt_from_string_cached(input, ctx);
 }
 
 const ndt_t *
 ndt_from_string_v(const char *input, ndt_context_t *ctx)
 {
-    const ndt_t *t = _ndt_from_string(input, ctx);
+    const ndt_t *t = _ndt_from_string_cached(input, ctx);
     if (t == NULL) {
         ndt_err_append(ctx, input);
     }
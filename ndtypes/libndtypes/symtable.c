@@ -34,7 +34,9 @@
 #include <stdio.h>
 #include <limits.h>
 #include <stddef.h>
+#include <string.h>
 #include "ndtypes.h"
+#include "cache.h"
 #include "symtable.h"
 
 
@@ -211,6 +213,8 @@ ndt_init(ndt_context_t *ctx)
 void
 ndt_finalize(void)
 {
+    ndt_parse_cache_clear();
+    ndt_intern_finalize();
     typedef_trie_del(typedef_map);
     typedef_map = NULL;
 }
@@ -220,120 +224,276 @@ ndt_finalize(void)
 /*                        Symbol tables for matching                         */
 /*****************************************************************************/
 
-symtable_t *
-symtable_new(ndt_context_t *ctx)
+void
+symtable_init(symtable_t *t)
 {
-    symtable_t *t;
-    int i;
+    t->size = 0;
+    t->ndims = 0;
+    t->overflow = NULL;
+    t->dims_overflow = NULL;
+}
 
-    t = ndt_alloc_size(offsetof(symtable_t, next) + ALPHABET_LEN * (sizeof t));
-    if (t == NULL) {
-        return ndt_memory_error(ctx);
+/* Reset the table for reuse. */
+void
+symtable_clear(symtable_t *t)
+{
+    t->size = 0;
+    t->ndims = 0;
+
+    if (t->overflow != NULL) {
+        symtable_chunk_t *c = t->overflow;
+        while (c != NULL) {
+            symtable_chunk_t *next = c->next;
+            ndt_free(c);
+            c = next;
+        }
+        t->overflow = NULL;
     }
 
-    t->entry.tag = Unbound;
+    if (t->dims_overflow != NULL) {
+        symtable_dims_chunk_t *c = t->dims_overflow;
+        while (c != NULL) {
+            symtable_dims_chunk_t *next = c->next;
+            ndt_free(c);
+            c = next;
+        }
+        t->dims_overflow = NULL;
+    }
+}
 
-    for (i = 0; i < ALPHABET_LEN; i++) {
-        t->next[i] = NULL;
+static symtable_slot_t *
+symtable_slot(symtable_t *t, int i)
+{
+    symtable_chunk_t *c;
+
+    if (i < SYMTABLE_SLOTS) {
+        return &t->slots[i];
     }
 
-    return t;
+    for (c = t->overflow, i -= SYMTABLE_SLOTS; i >= SYMTABLE_SLOTS;
+         c = c->next, i -= SYMTABLE_SLOTS);
+
+    return &c->slots[i];
 }
 
-void
-symtable_del(symtable_t *t)
+static symtable_slot_t *
+symtable_lookup(const symtable_t *t, const char *key)
 {
-    int i;
+    const symtable_chunk_t *c = t->overflow;
+    const symtable_slot_t *slots = t->slots;
+    int n = t->size;
 
-    if (t == NULL) {
-        return;
+    while (1) {
+        const int m = n < SYMTABLE_SLOTS ? n : SYMTABLE_SLOTS;
+
+        for (int i = 0; i < m; i++) {
+            if (slots[i].key == key || strcmp(slots[i].key, key) == 0) {
+                return (symtable_slot_t *)&slots[i];
+            }
+        }
+
+        n -= m;
+        if (n == 0) {
+            return NULL;
+        }
+
+        slots = c->slots;
+        c = c->next;
     }
+}
 
-    for (i = 0; i < ALPHABET_LEN; i++) {
-        symtable_del(t->next[i]);
+/* Reserve 'n' dimensions, preferably in the inline arena. */
+static symtable_dim_t *
+symtable_alloc_dims(symtable_t *t, int n, ndt_context_t *ctx)
+{
+    symtable_dims_chunk_t *c;
+
+    if (n <= SYMTABLE_DIMS - t->ndims) {
+        symtable_dim_t *dims = t->dims + t->ndims;
+        t->ndims += n;
+        return dims;
     }
 
-    ndt_free(t);
+    c = ndt_alloc_size(offsetof(symtable_dims_chunk_t, dims) + n * (sizeof *c->dims));
+    if (c == NULL) {
+        return ndt_memory_error(ctx);
+    }
+
+    c->next = t->dims_overflow;
+    t->dims_overflow = c;
+
+    return c->dims;
+}
+
+/* Store the payload of 'entry' in 'slot', reusing the slot's dimensions if possible. */
+static int
+symtable_store(symtable_t *t, symtable_slot_t *slot, const symtable_entry_t *entry,
+               ndt_context_t *ctx)
+{
+    int size;
+
+    switch (entry->tag) {
+    case Shape: slot->Shape = entry->Shape; break;
+    case Symbol: slot->Symbol = entry->Symbol; break;
+    case Type: slot->Type = entry->Type; break;
+    case Unbound: break;
+
+    case BroadcastSeq: case FixedSeq: case VarSeq: case ArraySeq:
+        switch (entry->tag) {
+        case BroadcastSeq: size = entry->BroadcastSeq.size; break;
+        case VarSeq: size = entry->VarSeq.size; break;
+        case FixedSeq: size = entry->FixedSeq.size; break;
+        default: size = entry->ArraySeq.size; break;
+        }
+
+        if (slot->tag != entry->tag || size > slot->Seq.capacity) {
+            symtable_dim_t *dims = symtable_alloc_dims(t, size, ctx);
+            if (dims == NULL) {
+                return -1;
+            }
+            slot->Seq.dims = dims;
+            slot->Seq.capacity = size;
+        }
+
+        slot->Seq.size = size;
+        slot->Seq.linear_index = 0;
+
+        for (int i = 0; i < size; i++) {
+            switch (entry->tag) {
+            case BroadcastSeq:
+                slot->Seq.dims[i].shape = entry->BroadcastSeq.dims[i];
+                break;
+            case VarSeq:
+                slot->Seq.dims[i].type = entry->VarSeq.dims[i];
+                break;
+            case FixedSeq:
+                slot->Seq.dims[i].type = entry->FixedSeq.dims[i];
+                break;
+            default:
+                slot->Seq.dims[i].type = entry->ArraySeq.dims[i];
+                break;
+            }
+        }
+
+        if (entry->tag == VarSeq) {
+            slot->Seq.linear_index = entry->VarSeq.linear_index;
+        }
+        break;
+    }
+
+    slot->tag = entry->tag;
+
+    return 0;
 }
 
 int
 symtable_add(symtable_t *t, const char *key, const symtable_entry_t entry,
              ndt_context_t *ctx)
 {
+    symtable_slot_t *slot;
     const unsigned char *cp;
-    int i;
 
     for (cp = (const unsigned char *)key; *cp != '\0'; cp++) {
-        i = code[*cp];
-        if (i == UCHAR_MAX) {
+        if (code[*cp] == UCHAR_MAX) {
             ndt_err_format(ctx, NDT_ValueError,
                            "invalid character in symbol: '%c'", *cp);
             return -1;
         }
+    }
 
-        if (t->next[i] == NULL) {
-            symtable_t *u = symtable_new(ctx);
-            if (u == NULL) {
-                return -1;
-            }
-            t->next[i] = u;
-            t = u;
-        }
-        else {
-            t = t->next[i];
+    if (symtable_lookup(t, key) != NULL) {
+        ndt_err_format(ctx, NDT_ValueError, "duplicate binding for '%s'", key);
+        return -1;
+    }
+
+    if (t->size >= SYMTABLE_SLOTS && t->size % SYMTABLE_SLOTS == 0) {
+        symtable_chunk_t *c = ndt_alloc_size(sizeof *c);
+        symtable_chunk_t **p;
+
+        if (c == NULL) {
+            (void)ndt_memory_error(ctx);
+            return -1;
         }
+        c->next = NULL;
+
+        for (p = &t->overflow; *p != NULL; p = &(*p)->next);
+        *p = c;
     }
 
-    if (t->entry.tag != Unbound) {
-        ndt_err_format(ctx, NDT_ValueError, "duplicate binding for '%s'", key);
+    slot = symtable_slot(t, t->size);
+    slot->key = key;
+    slot->tag = Unbound;
+
+    if (symtable_store(t, slot, &entry, ctx) < 0) {
         return -1;
     }
 
-    t->entry = entry;
+    t->size++;
+
     return 0;
 }
 
-symtable_entry_t
-symtable_find(const symtable_t *t, const char *key)
+/* Replace the entry for an existing 'key'. */
+int
+symtable_update(symtable_t *t, const char *key, const symtable_entry_t entry,
+                ndt_context_t *ctx)
 {
-    symtable_entry_t unbound = { .tag=Unbound };
-    const unsigned char *cp;
-    int i;
+    symtable_slot_t *slot = symtable_lookup(t, key);
 
-    for (cp = (const unsigned char *)key; *cp != '\0'; cp++) {
-        i = code[*cp];
-        if (i == UCHAR_MAX) {
-            return unbound; /* NOT REACHED */
-        }
-
-        if (t->next[i] == NULL) {
-            return unbound;
-        }
-        t = t->next[i];
+    if (slot == NULL) {
+        ndt_err_format(ctx, NDT_RuntimeError, "missing binding for '%s'", key);
+        return -1;
     }
 
-    return t->entry;
+    return symtable_store(t, slot, &entry, ctx);
 }
 
-symtable_entry_t *
-symtable_find_ptr(symtable_t *t, const char *key)
+symtable_entry_t
+symtable_find(const symtable_t *t, const char *key)
 {
-    const unsigned char *cp;
+    symtable_entry_t v = { .tag=Unbound };
+    const symtable_slot_t *slot = symtable_lookup(t, key);
     int i;
 
-    for (cp = (const unsigned char *)key; *cp != '\0'; cp++) {
-        i = code[*cp];
-        if (i == UCHAR_MAX) {
-            return NULL; /* NOT REACHED */
-        }
+    if (slot == NULL) {
+        return v;
+    }
 
-        if (t->next[i] == NULL) {
-            return NULL;
+    v.tag = slot->tag;
+
+    switch (slot->tag) {
+    case Unbound: break;
+    case Shape: v.Shape = slot->Shape; break;
+    case Symbol: v.Symbol = slot->Symbol; break;
+    case Type: v.Type = slot->Type; break;
+    case BroadcastSeq:
+        v.BroadcastSeq.size = slot->Seq.size;
+        for (i = 0; i < slot->Seq.size; i++) {
+            v.BroadcastSeq.dims[i] = slot->Seq.dims[i].shape;
         }
-        t = t->next[i];
+        break;
+    case VarSeq:
+        v.VarSeq.size = slot->Seq.size;
+        v.VarSeq.linear_index = slot->Seq.linear_index;
+        for (i = 0; i < slot->Seq.size; i++) {
+            v.VarSeq.dims[i] = slot->Seq.dims[i].type;
+        }
+        break;
+    case FixedSeq:
+        v.FixedSeq.size = slot->Seq.size;
+        for (i = 0; i < slot->Seq.size; i++) {
+            v.FixedSeq.dims[i] = slot->Seq.dims[i].type;
+        }
+        break;
+    case ArraySeq:
+        v.ArraySeq.size = slot->Seq.size;
+        for (i = 0; i < slot->Seq.size; i++) {
+            v.ArraySeq.dims[i] = slot->Seq.dims[i].type;
+        }
+        break;
     }
 
-    return &t->entry;
+    return v;
 }
 
 int64_t
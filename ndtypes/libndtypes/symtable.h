@@ -79,9 +79,58 @@ typedef struct {
   };
 } symtable_entry_t;
 
+/*
+ * Flat symbol table.  Signatures bind only a handful of symbols, so a linear
+ * search over a small inline array is faster than a trie and the table can
+ * live on the stack of the caller.  Keys are borrowed and must outlive the
+ * table.
+ *
+ * The dimensions of sequence entries are stored in an inline arena that is
+ * shared by all slots.  Extra slots and dimensions that do not fit are
+ * allocated in chunks, which is rare enough that resetting the table is
+ * normally O(1).
+ */
+#define SYMTABLE_SLOTS 8
+#define SYMTABLE_DIMS 64
+
+typedef union {
+    int64_t shape;
+    const ndt_t *type;
+} symtable_dim_t;
+
+typedef struct {
+    const char *key;
+    enum symtable_entry tag;
+    union {
+        int64_t Shape;
+        const char *Symbol;
+        const ndt_t *Type;
+        struct {
+            int size;
+            int capacity;
+            int64_t linear_index;
+            symtable_dim_t *dims;
+        } Seq;
+    };
+} symtable_slot_t;
+
+typedef struct symtable_chunk {
+    struct symtable_chunk *next;
+    symtable_slot_t slots[SYMTABLE_SLOTS];
+} symtable_chunk_t;
+
+typedef struct symtable_dims_chunk {
+    struct symtable_dims_chunk *next;
+    symtable_dim_t dims[];
+} symtable_dims_chunk_t;
+
 typedef struct symtable {
-    symtable_entry_t entry;
-    struct symtable *next[];
+    int size;
+    int ndims;
+    symtable_chunk_t *overflow;
+    symtable_dims_chunk_t *dims_overflow;
+    symtable_slot_t slots[SYMTABLE_SLOTS];
+    symtable_dim_t dims[SYMTABLE_DIMS];
 } symtable_t;
 
 
@@ -89,13 +138,13 @@ typedef struct symtable {
 NDT_PRAGMA(NDT_HIDE_SYMBOLS_START)
 
 
-symtable_t *symtable_new(ndt_context_t *ctx);
-void symtable_free_entry(symtable_entry_t entry);
-void symtable_del(symtable_t *t);
+void symtable_init(symtable_t *t);
+void symtable_clear(symtable_t *t);
 int symtable_add(symtable_t *t, const char *key, const symtable_entry_t entry,
                  ndt_context_t *ctx);
 symtable_entry_t symtable_find(const symtable_t *t, const char *key);
-symtable_entry_t *symtable_find_ptr(symtable_t *t, const char *key);
+int symtable_update(symtable_t *t, const char *key, const symtable_entry_t entry,
+                    ndt_context_t *ctx);
 int64_t symtable_find_shape(const symtable_t *tbl, const char *key, ndt_context_t *ctx);
 const ndt_t *symtable_find_typevar(const symtable_t *tbl, const char *key, ndt_context_t *ctx);
 const ndt_t *symtable_find_var_dim(const symtable_t *tbl, int ndim, ndt_context_t *ctx);
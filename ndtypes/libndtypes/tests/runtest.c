@@ -98,6 +98,10 @@ init_tests(void)
         return -1;
     }
 
+    /* The parser tests run with injected allocation failures and need to
+       reach the parser every time, see test_parse_cache(). */
+    (void)ndt_parse_cache_enable(false);
+
     ndt_context_del(ctx);
     return 0;
 }
@@ -293,6 +297,240 @@ test_parse_error(void)
     return 0;
 }
 
+static int
+test_parse_cache(void)
+{
+    const char **c;
+    ndt_context_t *ctx;
+    ndt_parse_cache_stats_t stats;
+    const ndt_t *t, *u;
+    char buf[64];
+    int64_t n = 0;
+    int count = 0;
+    int ret = -1;
+
+    ctx = ndt_context_new();
+    if (ctx == NULL) {
+        fprintf(stderr, "error: out of memory");
+        return -1;
+    }
+
+    (void)ndt_parse_cache_enable(true);
+
+    for (c = parse_tests; *c != NULL; c++) {
+        t = ndt_from_string(*c, ctx);
+        if (t == NULL) {
+            fprintf(stderr, "test_parse_cache: FAIL: expected success: \"%s\"\n", *c);
+            goto out;
+        }
+
+        u = ndt_from_string(*c, ctx);
+        if (u != t) {
+            fprintf(stderr, "test_parse_cache: FAIL: no shared type for: \"%s\"\n", *c);
+            ndt_decref(t);
+            ndt_decref(u);
+            goto out;
+        }
+
+        ndt_decref(t);
+        ndt_decref(u);
+        count++;
+    }
+
+    /* Failed parses are not cached. */
+    for (int i = 0; i < 2; i++) {
+        ndt_err_clear(ctx);
+        t = ndt_from_string("10 * ", ctx);
+        if (t != NULL || ctx->err != NDT_ParseError) {
+            fprintf(stderr, "test_parse_cache: FAIL: expected parse error\n");
+            ndt_decref(t);
+            goto out;
+        }
+    }
+    ndt_err_clear(ctx);
+
+    /* The bpformat parser has separate keys. */
+    t = ndt_from_bpformat("d", ctx);
+    u = ndt_from_bpformat("d", ctx);
+    if (t == NULL || u != t || t->tag != Float64) {
+        fprintf(stderr, "test_parse_cache: FAIL: bpformat\n");
+        ndt_decref(t);
+        ndt_decref(u);
+        goto out;
+    }
+    ndt_decref(t);
+    ndt_decref(u);
+    count++;
+
+    /* The cache is bounded. */
+    ndt_parse_cache_clear();
+    for (int i = 0; i < 5000; i++) {
+        snprintf(buf, sizeof buf, "%d * int64", i+1);
+        t = ndt_from_string(buf, ctx);
+        if (t == NULL || t->FixedDim.shape != i+1) {
+            fprintf(stderr, "test_parse_cache: FAIL: \"%s\"\n", buf);
+            ndt_decref(t);
+            goto out;
+        }
+        ndt_decref(t);
+        n++;
+    }
+
+    t = ndt_from_string("5000 * int64", ctx);
+    ndt_decref(t);
+
+    ndt_parse_cache_stats(&stats);
+    if (!stats.enabled || stats.size > stats.capacity || stats.size == 0 ||
+        stats.misses != n || stats.hits != 1) {
+        fprintf(stderr, "test_parse_cache: FAIL: unexpected statistics\n");
+        goto out;
+    }
+    count++;
+
+    /* Disabling clears the cache. */
+    (void)ndt_parse_cache_enable(false);
+    t = ndt_from_string("5000 * int64", ctx);
+    u = ndt_from_string("5000 * int64", ctx);
+    ndt_parse_cache_stats(&stats);
+    if (t == NULL || u == NULL || u == t || !ndt_equal(t, u) ||
+        stats.enabled || stats.size != 0) {
+        fprintf(stderr, "test_parse_cache: FAIL: cache not disabled\n");
+        ndt_decref(t);
+        ndt_decref(u);
+        goto out;
+    }
+    ndt_decref(t);
+    ndt_decref(u);
+    count++;
+
+    fprintf(stderr, "test_parse_cache (%d test cases)\n", count);
+    ret = 0;
+
+out:
+    (void)ndt_parse_cache_enable(false);
+    ndt_context_del(ctx);
+    return ret;
+}
+
+static int
+test_intern(void)
+{
+    const char **c;
+    ndt_context_t *ctx;
+    const ndt_t *t, *u, *v;
+    int64_t size;
+    int count = 0;
+    int ret = -1;
+
+    ctx = ndt_context_new();
+    if (ctx == NULL) {
+        fprintf(stderr, "error: out of memory");
+        return -1;
+    }
+
+    (void)ndt_intern_enable(true);
+
+    for (c = parse_tests; *c != NULL; c++) {
+        t = ndt_from_string(*c, ctx);
+        if (t == NULL) {
+            fprintf(stderr, "test_intern: FAIL: expected success: \"%s\"\n", *c);
+            goto out;
+        }
+
+        u = ndt_from_string(*c, ctx);
+        if (u != t) {
+            fprintf(stderr, "test_intern: FAIL: no canonical type for: \"%s\"\n", *c);
+            ndt_decref(t);
+            ndt_decref(u);
+            goto out;
+        }
+
+        ndt_decref(t);
+        ndt_decref(u);
+        count++;
+    }
+
+    /* Subtypes owned by the typedef table remain canonical. */
+    size = ndt_intern_size();
+
+    /* Different spellings and shared subtypes. */
+    t = ndt_from_string("10 * {a: int64, b: 2 * ?float32}", ctx);
+    u = ndt_from_string("10*{a:int64,b:2*?float32}", ctx);
+    v = ndt_from_string("{x: 2 * ?float32}", ctx);
+    if (t == NULL || u != t || v == NULL ||
+        t->FixedDim.type->Record.types[1] != v->Record.types[0]) {
+        fprintf(stderr, "test_intern: FAIL: subtypes are not canonical\n");
+        ndt_decref(t);
+        ndt_decref(u);
+        ndt_decref(v);
+        goto out;
+    }
+    ndt_decref(u);
+    ndt_decref(v);
+
+    /* Explicit interning of types that were created while disabled. */
+    (void)ndt_intern_enable(false);
+    u = ndt_from_string("10 * {a: int64, b: 2 * ?float32}", ctx);
+    if (u == NULL || u == t || !ndt_equal(u, t)) {
+        fprintf(stderr, "test_intern: FAIL: interned while disabled\n");
+        ndt_decref(t);
+        ndt_decref(u);
+        goto out;
+    }
+
+    u = ndt_intern(u);
+    if (u != t) {
+        fprintf(stderr, "test_intern: FAIL: ndt_intern\n");
+        ndt_decref(t);
+        ndt_decref(u);
+        goto out;
+    }
+    ndt_decref(u);
+    count++;
+
+    /* Interning never fails. */
+    for (alloc_fail = 1; alloc_fail < INT_MAX; alloc_fail++) {
+        u = ndt_from_string("10 * {a: int64, b: 2 * ?float32}", ctx);
+        if (u == NULL) {
+            fprintf(stderr, "test_intern: FAIL: unexpected parse failure\n");
+            ndt_decref(t);
+            goto out;
+        }
+
+        ndt_set_alloc_fail();
+        u = ndt_intern(u);
+        ndt_set_alloc();
+
+        if (u == NULL || !ndt_equal(u, t)) {
+            fprintf(stderr, "test_intern: FAIL: ndt_intern after MemoryError\n");
+            ndt_decref(t);
+            ndt_decref(u);
+            goto out;
+        }
+
+        ndt_decref(u);
+        if (u == t) {
+            break;
+        }
+    }
+    ndt_decref(t);
+    count++;
+
+    if (ndt_intern_size() != size) {
+        fprintf(stderr, "test_intern: FAIL: dead types in the table\n");
+        goto out;
+    }
+    count++;
+
+    fprintf(stderr, "test_intern (%d test cases)\n", count);
+    ret = 0;
+
+out:
+    (void)ndt_intern_enable(false);
+    ndt_context_del(ctx);
+    return ret;
+}
+
 static int
 test_indent(void)
 {
@@ -1169,6 +1407,59 @@ test_static_context(void)
     return 0;
 }
 
+static int
+test_probe_context(void)
+{
+    const char **c;
+    NDT_STATIC_CONTEXT(ctx);
+    NDT_STATIC_CONTEXT(probe);
+    const ndt_t *t, *u;
+    int count = 0;
+
+    probe.flags |= NDT_Probe;
+
+    for (c = parse_error_tests; *c != NULL; c++) {
+        ndt_err_clear(&ctx);
+        ndt_err_clear(&probe);
+
+        t = ndt_from_string(*c, &ctx);
+        u = ndt_from_string(*c, &probe);
+
+        if (t != NULL || u != NULL) {
+            fprintf(stderr, "test_probe_context: FAIL: unexpected success: \"%s\"\n", *c);
+            ndt_decref(t);
+            ndt_decref(u);
+            return -1;
+        }
+
+        if (probe.err != ctx.err || probe.msg != ConstMsg ||
+            strcmp(ndt_context_msg(&probe), ndt_err_as_string(ctx.err)) != 0) {
+            fprintf(stderr, "test_probe_context: FAIL: \"%s\"\n", *c);
+            fprintf(stderr, "test_probe_context: FAIL: got: %s: %s\n\n",
+                    ndt_err_as_string(probe.err),
+                    ndt_context_msg(&probe));
+            ndt_context_del(&ctx);
+            return -1;
+        }
+        count++;
+    }
+
+    ndt_err_clear(&probe);
+    (void)ndt_memory_error(&probe);
+    if (probe.err != NDT_MemoryError || probe.msg != ConstMsg) {
+        fprintf(stderr, "test_probe_context: FAIL: ndt_memory_error\n");
+        ndt_context_del(&ctx);
+        return -1;
+    }
+    count++;
+
+    ndt_context_del(&ctx);
+    ndt_context_del(&probe);
+    fprintf(stderr, "test_probe_context (%d test cases)\n", count);
+
+    return 0;
+}
+
 typedef struct {
     const char *str;
     ndt_ssize_t hash;
@@ -1197,7 +1488,7 @@ test_hash(void)
     hash_testcase_t buf[1000];
     ptrdiff_t n = 1;
     const char **c;
-    const ndt_t *t;
+    const ndt_t *t, *u;
     hash_testcase_t x;
     int i;
 
@@ -1253,14 +1544,26 @@ test_hash(void)
     x.hash = ndt_hash(t, &ctx);
     ndt_set_alloc();
 
-    ndt_decref(t);
+    if (x.hash == -1 || ctx.err != NDT_Success) {
+        fprintf(stderr, "test_hash: FAIL: unexpected failure\n\n");
+        ndt_decref(t);
+        ndt_context_del(&ctx);
+        return -1;
+    }
 
-    if (x.hash != -1 || ctx.err != NDT_MemoryError) {
-        fprintf(stderr, "test_hash: FAIL: expected failure, got %" PRI_ndt_ssize "\n\n", x.hash);
+    /* Equal types have equal hashes. */
+    u = ndt_from_string("var*{a:float64,b:string}", &ctx);
+    if (u == NULL || ndt_hash(u, &ctx) != x.hash || ndt_hash(t, &ctx) != x.hash) {
+        fprintf(stderr, "test_hash: FAIL: hash is not structural\n\n");
+        ndt_decref(t);
+        ndt_decref(u);
         ndt_context_del(&ctx);
         return -1;
     }
 
+    ndt_decref(t);
+    ndt_decref(u);
+
     ndt_context_del(&ctx);
     fprintf(stderr, "test_hash (%d test cases)\n", (int)n);
 
@@ -1703,6 +2006,8 @@ static int (*tests[])(void) = {
   test_parse,
   test_parse_roundtrip,
   test_parse_error,
+  test_parse_cache,
+  test_intern,
   test_indent,
   test_typedef,
   test_typedef_duplicates,
@@ -1713,6 +2018,7 @@ static int (*tests[])(void) = {
   test_typecheck,
   test_numba,
   test_static_context,
+  test_probe_context,
   test_hash,
   test_copy,
   test_buffer,
@@ -824,5 +824,26 @@ const typecheck_testcase_t typecheck_tests[] = {
     .nargs=3,
     .types={ "array * array * float64", "array * uint8", "array * array * int64" } },
 
+  /* More symbols than inline slots in the symbol table. */
+  { .loc = loc(),
+    .success=true,
+
+    .signature="A * B * C * D * E * F * G * H * I * J * K * L * M * N * P * Q * R * int64, R * int64 -> R * A * int64",
+    .args={"2 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 3 * int64", "3 * int64"},
+    .kwargs={NULL},
+
+    .outer_dims=0,
+    .nin=2,
+    .nout=1,
+    .nargs=3,
+    .types={ "2 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 3 * int64", "3 * int64", "3 * 2 * int64" } },
+
+  { .loc = loc(),
+    .success=false,
+
+    .signature="A * B * C * D * E * F * G * H * I * J * K * L * M * N * P * Q * R * int64, R * int64 -> R * A * int64",
+    .args={"2 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 1 * 3 * int64", "4 * int64"},
+    .kwargs={NULL} },
+
   { .loc=NULL, .success=false, .signature= NULL, .args={NULL}, .kwargs={NULL} }
 };
@@ -382,32 +382,200 @@ ndt_transpose(const ndt_t *t, const int *p, int ndim, ndt_context_t *ctx)
     return _ndt_transpose(&a, p, ndt_dtype(t), ctx);
 }
 
-/* Unoptimized hash function for experimenting. */
-ndt_ssize_t
-ndt_hash(const ndt_t *t, ndt_context_t *ctx)
+/*
+ * Structural hash over the fields that are compared by ndt_equal().  Types
+ * are immutable once they are built, so the hash is cached in the type.
+ */
+static inline uint64_t
+mix(uint64_t h, uint64_t v)
 {
-    unsigned char *s, *cp;
-    size_t len;
-    ndt_ssize_t x;
+    return h ^ (v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2));
+}
+
+static uint64_t
+mix_string(uint64_t h, const char *s)
+{
+    uint64_t x = 14695981039346656037ULL;
 
-    cp = s = (unsigned char *)ndt_as_string(t, ctx);
     if (s == NULL) {
-        return -1;
+        return mix(h, 0);
+    }
+
+    for (; *s != '\0'; s++) {
+        x ^= (unsigned char)*s;
+        x *= 1099511628211ULL;
+    }
+
+    return mix(h, x);
+}
+
+static uint64_t
+mix_type(uint64_t h, const ndt_t *t)
+{
+    return mix(h, (uint64_t)ndt_hash(t, NULL));
+}
+
+static uint64_t
+structural_hash(const ndt_t *t)
+{
+    uint64_t h = 14695981039346656037ULL;
+    int64_t i;
+
+    h = mix(h, t->tag);
+    h = mix(h, t->access);
+    h = mix(h, t->flags);
+    h = mix(h, (uint64_t)t->ndim);
+    h = mix(h, (uint64_t)t->datasize);
+    h = mix(h, t->align);
+
+    switch (t->tag) {
+    case Module:
+        h = mix_string(h, t->Module.name);
+        return mix_type(h, t->Module.type);
+
+    case Function:
+        h = mix(h, (uint64_t)t->Function.nin);
+        h = mix(h, (uint64_t)t->Function.nout);
+        for (i = 0; i < t->Function.nargs; i++) {
+            h = mix_type(h, t->Function.types[i]);
+        }
+        return h;
+
+    case FixedDim:
+        h = mix(h, t->FixedDim.tag);
+        h = mix(h, (uint64_t)t->FixedDim.shape);
+        h = mix(h, (uint64_t)t->Concrete.FixedDim.itemsize);
+        h = mix(h, (uint64_t)t->Concrete.FixedDim.step);
+        return mix_type(h, t->FixedDim.type);
+
+    case VarDimElem:
+        h = mix(h, (uint64_t)t->VarDimElem.index);
+        /* fall through */
+    case VarDim:
+        h = mix(h, (uint64_t)t->Concrete.VarDim.itemsize);
+        h = mix(h, (uint64_t)t->Concrete.VarDim.nslices);
+        if (t->Concrete.VarDim.offsets != NULL) {
+            const ndt_offsets_t *x = t->Concrete.VarDim.offsets;
+            h = mix(h, (uint64_t)x->n);
+            for (i = 0; i < x->n; i++) {
+                h = mix(h, (uint64_t)x->v[i]);
+            }
+        }
+        return mix_type(h, t->VarDim.type);
+
+    case SymbolicDim:
+        h = mix(h, t->SymbolicDim.tag);
+        h = mix_string(h, t->SymbolicDim.name);
+        return mix_type(h, t->SymbolicDim.type);
+
+    case EllipsisDim:
+        h = mix(h, t->EllipsisDim.tag);
+        h = mix_string(h, t->EllipsisDim.name);
+        return mix_type(h, t->EllipsisDim.type);
+
+    case Array:
+        h = mix(h, (uint64_t)t->Array.itemsize);
+        return mix_type(h, t->Array.type);
+
+    case Tuple:
+        h = mix(h, t->Tuple.flag);
+        for (i = 0; i < t->Tuple.shape; i++) {
+            h = mix_type(h, t->Tuple.types[i]);
+        }
+        return h;
+
+    case Record:
+        h = mix(h, t->Record.flag);
+        for (i = 0; i < t->Record.shape; i++) {
+            h = mix_string(h, t->Record.names[i]);
+            h = mix_type(h, t->Record.types[i]);
+        }
+        return h;
+
+    case Union:
+        for (i = 0; i < t->Union.ntags; i++) {
+            h = mix_string(h, t->Union.tags[i]);
+            h = mix_type(h, t->Union.types[i]);
+        }
+        return h;
+
+    case Ref:
+        return mix_type(h, t->Ref.type);
+
+    case Constr:
+        h = mix_string(h, t->Constr.name);
+        return mix_type(h, t->Constr.type);
+
+    case Nominal:
+        h = mix_string(h, t->Nominal.name);
+        return mix_type(h, t->Nominal.type);
+
+    case Categorical:
+        for (i = 0; i < t->Categorical.ntypes; i++) {
+            const ndt_value_t *v = &t->Categorical.types[i];
+            h = mix(h, v->tag);
+            switch (v->tag) {
+            case ValBool: h = mix(h, v->ValBool); break;
+            case ValInt64: h = mix(h, (uint64_t)v->ValInt64); break;
+            case ValFloat64: {
+                /* -0.0 and 0.0 compare equal. */
+                double d = v->ValFloat64 == 0 ? 0.0 : v->ValFloat64;
+                uint64_t u;
+                memcpy(&u, &d, sizeof u);
+                h = mix(h, u);
+                break;
+            }
+            case ValString: h = mix_string(h, v->ValString); break;
+            default: break;
+            }
+        }
+        return h;
+
+    case FixedString:
+        h = mix(h, (uint64_t)t->FixedString.size);
+        return mix(h, t->FixedString.encoding);
+
+    case FixedBytes:
+        h = mix(h, (uint64_t)t->FixedBytes.size);
+        return mix(h, t->FixedBytes.align);
+
+    case Bytes:
+        return mix(h, t->Bytes.target_align);
+
+    case Char:
+        return mix(h, t->Char.encoding);
+
+    case Typevar:
+        return mix_string(h, t->Typevar.name);
+
+    default:
+        return h;
     }
+}
 
-    len = strlen((char *)s);
+/*
+ * Return the structural hash of 't'.  The function does not allocate and
+ * cannot fail, 'ctx' is unused.  The result is never 0 or -1.
+ */
+ndt_ssize_t
+ndt_hash(const ndt_t *t, ndt_context_t *ctx)
+{
+    ndt_ssize_t x;
+    (void)ctx;
 
-    x = *cp << 7;
-    while (*cp != '\0') {
-        x = (1000003 * x) ^ *cp++;
+    x = (ndt_ssize_t)t->hash;
+    if (x != 0) {
+        return x;
     }
-    x ^= len;
 
-    if (x == -1) {
+    x = (ndt_ssize_t)structural_hash(t);
+    if (x == 0 || x == -1) {
         x = -2;
     }
 
-    ndt_free(s);
+    if (!ndt_is_static(t)) {
+        ((ndt_t *)t)->hash = x;
+    }
 
     return x;
 }
@@ -1296,10 +1296,65 @@ ndtype_instantiate(PyObject *mod UNUSED, PyObject *args, PyObject *kwds)
     return ret;
 }
 
+static PyObject *
+ndtype_parse_cache_enable(PyObject *mod UNUSED, PyObject *flag)
+{
+    int v = PyObject_IsTrue(flag);
+    if (v < 0) {
+        return NULL;
+    }
+
+    return PyBool_FromLong(ndt_parse_cache_enable(v));
+}
+
+static PyObject *
+ndtype_parse_cache_clear(PyObject *mod UNUSED, PyObject *args UNUSED)
+{
+    ndt_parse_cache_clear();
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+ndtype_parse_cache_stats(PyObject *mod UNUSED, PyObject *args UNUSED)
+{
+    ndt_parse_cache_stats_t stats;
+
+    ndt_parse_cache_stats(&stats);
+
+    return Py_BuildValue("{s:O,s:L,s:L,s:L,s:L}",
+                         "enabled", stats.enabled ? Py_True : Py_False,
+                         "hits", (long long)stats.hits,
+                         "misses", (long long)stats.misses,
+                         "size", (long long)stats.size,
+                         "capacity", (long long)stats.capacity);
+}
+
+static PyObject *
+ndtype_intern_enable(PyObject *mod UNUSED, PyObject *flag)
+{
+    int v = PyObject_IsTrue(flag);
+    if (v < 0) {
+        return NULL;
+    }
+
+    return PyBool_FromLong(ndt_intern_enable(v));
+}
+
+static PyObject *
+ndtype_intern_size(PyObject *mod UNUSED, PyObject *args UNUSED)
+{
+    return PyLong_FromLongLong(ndt_intern_size());
+}
+
 static PyMethodDef _ndtypes_methods [] =
 {
   { "typedef", (PyCFunction)ndtype_typedef, METH_VARARGS|METH_KEYWORDS, NULL},
   { "instantiate", (PyCFunction)ndtype_instantiate, METH_VARARGS|METH_KEYWORDS, NULL},
+  { "parse_cache_enable", (PyCFunction)ndtype_parse_cache_enable, METH_O, doc_parse_cache_enable},
+  { "parse_cache_clear", (PyCFunction)ndtype_parse_cache_clear, METH_NOARGS, doc_parse_cache_clear},
+  { "parse_cache_stats", (PyCFunction)ndtype_parse_cache_stats, METH_NOARGS, doc_parse_cache_stats},
+  { "intern_enable", (PyCFunction)ndtype_intern_enable, METH_O, doc_intern_enable},
+  { "intern_size", (PyCFunction)ndtype_intern_size, METH_NOARGS, doc_intern_size},
   { NULL, NULL, 1, NULL }
 };
 
@@ -1328,10 +1383,12 @@ PyInit__ndtypes(void)
     static int initialized = 0;
 
     if (!initialized) {
-        ndt_mallocfunc = PyMem_Malloc;
-        ndt_reallocfunc = PyMem_Realloc;
-        ndt_callocfunc = PyMem_Calloc;
-        ndt_freefunc = PyMem_Free;
+        /* libgumath allocates types and slices in worker threads and while
+           the GIL is released, so the raw allocators are required. */
+        ndt_mallocfunc = PyMem_RawMalloc;
+        ndt_reallocfunc = PyMem_RawRealloc;
+        ndt_callocfunc = PyMem_RawCalloc;
+        ndt_freefunc = PyMem_RawFree;
 
         capsule = init_api();
         if (capsule == NULL) {
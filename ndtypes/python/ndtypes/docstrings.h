@@ -41,6 +41,37 @@
 
 PyDoc_STRVAR(doc_module, "ndtypes module");
 
+PyDoc_STRVAR(doc_parse_cache_enable,
+"parse_cache_enable(flag, /)\n--\n\n\
+Enable or disable the cache for parsed type strings and buffer protocol\n\
+formats.  Disabling the cache clears it.  Return the previous setting.\n\
+\n");
+
+PyDoc_STRVAR(doc_parse_cache_clear,
+"parse_cache_clear(/)\n--\n\n\
+Clear the cache for parsed type strings and reset the statistics.\n\
+\n");
+
+PyDoc_STRVAR(doc_parse_cache_stats,
+"parse_cache_stats(/)\n--\n\n\
+Return a dict with the hits, misses, size and capacity of the cache for\n\
+parsed type strings.\n\
+\n\
+    >>> parse_cache_stats()[\"capacity\"]\n\
+    1024\n\
+\n");
+
+PyDoc_STRVAR(doc_intern_enable,
+"intern_enable(flag, /)\n--\n\n\
+Enable or disable interning of parsed types.  Structurally equal interned\n\
+types share memory, so comparing them is cheap.  Return the previous setting.\n\
+\n");
+
+PyDoc_STRVAR(doc_intern_size,
+"intern_size(/)\n--\n\n\
+Return the number of live interned types.\n\
+\n");
+
 
 
 /******************************************************************************/
@@ -317,3 +348,4 @@ Serialize a type to a bytes format.\n\
     >>> t.serialize()\n\
     b'\\x1a\\x01\\x00\\x00\\x00\\x00\\x00\\x00\\x00\\x00\\x08\\x00\\x00\\x00\\x00\\x00\\x00\\x00\\x08\\x00'\n\
 \n");
+
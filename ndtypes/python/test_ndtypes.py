@@ -35,6 +35,8 @@ import unittest, gc
 import weakref, struct
 from copy import copy
 from ndtypes import ndt, typedef, instantiate, MAX_DIM, ApplySpec
+from ndtypes import parse_cache_enable, parse_cache_clear, parse_cache_stats
+from ndtypes import intern_enable, intern_size
 from ndt_support import *
 from ndt_randtype import *
 from random import random
@@ -1950,6 +1952,27 @@ class TestApply(unittest.TestCase):
             types = [ndt(x) for x in l]
             self.assertRaises(TypeError, sig.apply, types)
 
+    def test_apply_many_dims(self):
+        # Dimension lists that exceed the inline storage of the symbol table.
+        sig = ndt("... * int64, ... * int64 -> ... * int64")
+        t = ndt(" * ".join(["1"] * 60 + ["2"] * 10) + " * int64")
+        u = ndt(" * ".join(["1"] * 90 + ["3"]) + " * int64")
+        self.assertRaises(TypeError, sig.apply, t, u)
+
+        u = ndt(" * ".join(["1"] * 90 + ["2"]) + " * int64")
+        spec = sig.apply(t, u)
+        self.assertEqual(spec.outer_dims, 91)
+        self.assertEqual(spec.types[2].shape, (1,) * 81 + (2,) * 10)
+
+        sig = ndt("Dims... * int64, Dims... * int64 -> Dims... * int64")
+        t = ndt(" * ".join(["1"] * 100) + " * int64")
+        spec = sig.apply(t, t)
+        self.assertEqual(spec.outer_dims, 100)
+        self.assertEqual(spec.types[2], t)
+
+        u = ndt(" * ".join(["1"] * 99) + " * int64")
+        self.assertRaises(TypeError, sig.apply, t, u)
+
 
 def from_shape_strides(shape, strides):
     s = "float64"
@@ -2051,6 +2074,99 @@ class TestTypedef(unittest.TestCase):
         self.assertRaises(ValueError, instantiate, "graph", t)
 
 
+class TestParseCache(unittest.TestCase):
+
+    def test_parse_cache(self):
+        prev = parse_cache_enable(True)
+        try:
+            parse_cache_clear()
+            s = "10 * {a: int64, b: ?float32, c: string}"
+
+            t = ndt(s)
+            u = ndt(s)
+            self.assertEqual(u, t)
+            self.assertEqual(ndt.from_format("T{<q:a:<f:b:}"),
+                             ndt.from_format("T{<q:a:<f:b:}"))
+
+            stats = parse_cache_stats()
+            self.assertTrue(stats["enabled"])
+            self.assertEqual(stats["misses"], 2)
+            self.assertEqual(stats["hits"], 2)
+            self.assertEqual(stats["size"], 2)
+
+            # Errors are not cached.
+            self.assertRaises(ValueError, ndt, "10 * ")
+            self.assertRaises(ValueError, ndt, "10 * ")
+            self.assertEqual(parse_cache_stats()["hits"], 2)
+
+            # Shared types outlive the cache.
+            self.assertTrue(parse_cache_enable(False))
+            stats = parse_cache_stats()
+            self.assertFalse(stats["enabled"])
+            self.assertEqual(stats["size"], 0)
+            self.assertEqual(t, ndt(s))
+            self.assertEqual(parse_cache_stats()["hits"], 0)
+
+            parse_cache_enable(True)
+            for i in range(stats["capacity"] + 100):
+                self.assertEqual(ndt("%d * int8" % i).shape, (i,))
+            stats = parse_cache_stats()
+            self.assertLessEqual(stats["size"], stats["capacity"])
+        finally:
+            parse_cache_enable(prev)
+
+
+class TestHash(unittest.TestCase):
+
+    def test_hash(self):
+        s = "{%s}" % ", ".join("f%d: 10 * ?float64" % i for i in range(60))
+        t = ndt(s)
+        u = ndt(s.replace(" ", ""))
+        self.assertEqual(hash(t), hash(u))
+
+        d = {t: 1, ndt("10 * int64"): 2, ndt("10 * int32"): 3}
+        self.assertEqual(d[u], 1)
+        self.assertEqual(d[ndt("10*int64")], 2)
+        self.assertEqual(d[ndt("10*int32")], 3)
+
+        self.assertEqual(hash(ndt("categorical(0.0)")), hash(ndt("categorical(-0.0)")))
+        self.assertNotEqual(hash(ndt("10 * int64")), hash(ndt("20 * int64")))
+        self.assertNotEqual(hash(ndt("{a: int64}")), hash(ndt("{b: int64}")))
+
+
+class TestIntern(unittest.TestCase):
+
+    def test_intern(self):
+        prev = intern_enable(True)
+        prev_cache = parse_cache_enable(False)
+        try:
+            gc.collect()
+            n = intern_size()
+            t = ndt("100 * {a: int64, b: 10 * ?float32, c: string}")
+            m = intern_size()
+            self.assertGreater(m, n)
+
+            # Different spelling, same canonical nodes.
+            u = ndt("100*{a:int64,b:10*?float32,c:string}")
+            self.assertEqual(u, t)
+            self.assertEqual(hash(u), hash(t))
+            self.assertEqual(intern_size(), m)
+
+            # Shared subtree.
+            v = ndt("{x: 10 * ?float32}")
+            self.assertEqual(intern_size(), m + 1)
+
+            # The table does not keep types alive.
+            del t, u, v
+            gc.collect()
+            self.assertEqual(intern_size(), n)
+        finally:
+            parse_cache_enable(prev_cache)
+            intern_enable(prev)
+
+        self.assertEqual(ndt("10 * int64"), ndt("10*int64"))
+
+
 class TestSerialize(unittest.TestCase):
 
     def test_serialize(self):
@@ -2174,6 +2290,9 @@ ALL_TESTS = [
   TestApply,
   TestBroadcast,
   TestTypedef,
+  TestParseCache,
+  TestHash,
+  TestIntern,
   TestSerialize,
   TestPickle,
   LongFixedDimTests,
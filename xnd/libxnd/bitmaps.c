@@ -33,13 +33,15 @@
 
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
 #include <inttypes.h>
 #include <assert.h>
 #include "ndtypes.h"
 #include "xnd.h"
 
 
-const xnd_bitmap_t xnd_bitmap_empty = { .data = NULL, .size = 0, .next = NULL};
+const xnd_bitmap_t xnd_bitmap_empty = { .data = NULL, .size = 0, .next = NULL,
+                                        .summary = NULL };
 
 
 static int64_t
@@ -61,6 +63,23 @@ bits_new(int64_t n, ndt_context_t *ctx)
     return bits;
 }
 
+/* New bitmaps have all bits set to NA. */
+static xnd_bitmap_summary_t *
+summary_new(int64_t n, ndt_context_t *ctx)
+{
+    xnd_bitmap_summary_t *s;
+
+    s = ndt_alloc(1, sizeof *s);
+    if (s == NULL) {
+        return ndt_memory_error(ctx);
+    }
+
+    s->nbits = n;
+    s->nna = n;
+
+    return s;
+}
+
 static xnd_bitmap_t *
 bitmap_array_new(int64_t n, ndt_context_t *ctx)
 {
@@ -85,6 +104,7 @@ bitmap_init(xnd_bitmap_t *b, const ndt_t *t, int64_t nitems, ndt_context_t *ctx)
     assert(b->data == NULL);
     assert(b->size == 0);
     assert(b->next == NULL);
+    assert(b->summary == NULL);
 
     if (ndt_is_optional(t)) {
          if (t->ndim > 0) {
@@ -97,6 +117,12 @@ bitmap_init(xnd_bitmap_t *b, const ndt_t *t, int64_t nitems, ndt_context_t *ctx)
          if (b->data == NULL) {
              return -1;
          }
+
+         b->summary = summary_new(nitems, ctx);
+         if (b->summary == NULL) {
+             xnd_bitmap_clear(b);
+             return -1;
+         }
     }
 
     if (!ndt_subtree_is_optional(t)) {
@@ -275,6 +301,9 @@ xnd_bitmap_clear(xnd_bitmap_t *b)
     ndt_free(b->data);
     b->data = NULL;
 
+    ndt_free(b->summary);
+    b->summary = NULL;
+
     if (b->next) {
         for (i = 0; i < b->size; i++) {
             xnd_bitmap_clear(b->next + i);
@@ -289,7 +318,7 @@ xnd_bitmap_t
 xnd_bitmap_next(const xnd_t *x, int64_t i, ndt_context_t *ctx)
 {
     const ndt_t *t = x->type;
-    xnd_bitmap_t next = {.data=NULL, .size=0, .next=NULL};
+    xnd_bitmap_t next = {.data=NULL, .size=0, .next=NULL, .summary=NULL};
     int64_t shape;
 
     if (!ndt_subtree_is_optional(t)) {
@@ -327,16 +356,72 @@ xnd_bitmap_next(const xnd_t *x, int64_t i, ndt_context_t *ctx)
     return x->bitmap.next[x->index * shape + i];
 }
 
+static int64_t
+popcount(uint64_t w)
+{
+    w = w - ((w >> 1) & 0x5555555555555555ULL);
+    w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+    w = (w + (w >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return (int64_t)((w * 0x0101010101010101ULL) >> 56);
+}
+
+/*
+ * Return the number of NA bits in the entire bitmap and cache the result.
+ * Return -1 if the bitmap has no summary.  The caller must ensure that the
+ * bits are not written concurrently.
+ */
+int64_t
+xnd_bitmap_count_na(const xnd_bitmap_t *b)
+{
+    xnd_bitmap_summary_t *s = b->summary;
+    const uint8_t *data = b->data;
+    int64_t nvalid = 0;
+    int64_t i, n;
+
+    if (s == NULL) {
+        return -1;
+    }
+
+    if (s->nna >= 0) {
+        return s->nna;
+    }
+
+    n = s->nbits / 8;
+    for (i = 0; i+8 <= n; i += 8) {
+        uint64_t w;
+        memcpy(&w, data+i, 8);
+        nvalid += popcount(w);
+    }
+    for (; i < n; i++) {
+        nvalid += popcount(data[i]);
+    }
+    if (s->nbits % 8) {
+        const uint8_t mask = (uint8_t)((1U << (s->nbits % 8)) - 1);
+        nvalid += popcount(data[n] & mask);
+    }
+
+    s->nna = s->nbits - nvalid;
+    return s->nna;
+}
+
 void
 xnd_set_valid(xnd_t *x)
 {
     const ndt_t *t = x->type;
     int64_t n = x->index;
+    uint8_t *p = &x->bitmap.data[n / 8];
+    const uint8_t mask = (uint8_t)1 << (n % 8);
+    xnd_bitmap_summary_t *s = x->bitmap.summary;
 
     assert(ndt_is_optional(t));
     assert(0 <= n);
 
-    x->bitmap.data[n / 8] |= ((uint8_t)1 << (n % 8));
+    if (!(*p & mask)) {
+        *p |= mask;
+        if (s != NULL && s->nna > 0) {
+            s->nna--;
+        }
+    }
 }
 
 void
@@ -344,11 +429,19 @@ xnd_set_na(xnd_t *x)
 {
     const ndt_t *t = x->type;
     int64_t n = x->index;
+    uint8_t *p = &x->bitmap.data[n / 8];
+    const uint8_t mask = (uint8_t)1 << (n % 8);
+    xnd_bitmap_summary_t *s = x->bitmap.summary;
 
     assert(ndt_is_optional(t));
     assert(0 <= n);
 
-    x->bitmap.data[n / 8] &= ~((uint8_t)1 << (n % 8));
+    if (*p & mask) {
+        *p &= (uint8_t)~mask;
+        if (s != NULL && s->nna >= 0) {
+            s->nna++;
+        }
+    }
 }
 
 static int
@@ -364,3 +364,70 @@ xnd_bounds_check(const ndt_t *t, const int64_t linear_index, const int64_t bufsi
 
     return _xnd_bounds_check(&x, bufsize, ctx);
 }
+
+
+/*****************************************************************************/
+/*                               Memory overlap                              */
+/*****************************************************************************/
+
+/*
+ * Byte range of the data of an array of fixed dimensions or of a scalar.
+ * Return false if the range cannot be determined.  An empty range has
+ * lo == hi.
+ */
+static bool
+data_range(const char **lo, const char **hi, const xnd_t *x)
+{
+    const ndt_t *t = x->type;
+    int64_t imin = x->index;
+    int64_t imax = x->index;
+
+    if (t->ndim == 0) {
+        *lo = x->ptr;
+        *hi = x->ptr + t->datasize;
+        return true;
+    }
+
+    for (; t->tag == FixedDim; t = t->FixedDim.type) {
+        const int64_t shape = t->FixedDim.shape;
+        const int64_t step = t->Concrete.FixedDim.step;
+
+        if (shape == 0) {
+            *lo = *hi = x->ptr;
+            return true;
+        }
+
+        if (step < 0) {
+            imin += (shape-1) * step;
+        }
+        else {
+            imax += (shape-1) * step;
+        }
+    }
+
+    if (t->ndim != 0) {
+        return false;
+    }
+
+    *lo = x->ptr + imin * t->datasize;
+    *hi = x->ptr + (imax+1) * t->datasize;
+    return true;
+}
+
+/*
+ * Return true if the data of 'x' and 'y' may overlap.  This is a conservative
+ * test of the byte ranges spanned by the arrays: interleaved arrays like
+ * x[::2] and x[1::2] are reported as overlapping.  Memory that is only
+ * reachable through pointers in the data is not considered.
+ */
+bool
+xnd_overlap(const xnd_t *x, const xnd_t *y)
+{
+    const char *xlo, *xhi, *ylo, *yhi;
+
+    if (!data_range(&xlo, &xhi, x) || !data_range(&ylo, &yhi, y)) {
+        return true;
+    }
+
+    return xlo < xhi && ylo < yhi && xlo < yhi && ylo < xhi;
+}
@@ -35,6 +35,8 @@
 #include <stdint.h>
 #include <inttypes.h>
 #include <string.h>
+#include <float.h>
+#include <math.h>
 #include <assert.h>
 #include "ndtypes.h"
 #include "xnd.h"
@@ -88,7 +90,7 @@ copy_ref(xnd_t *y, const xnd_t *x, const uint32_t flags, ndt_context_t *ctx)
         u = y->type;
     }
 
-    return xnd_copy(y, x, flags, ctx);
+    return xnd_copy_serial(y, x, flags, ctx);
 }
 
 static int
@@ -630,8 +632,721 @@ copy_complex128(xnd_t * const x, const double real, const double imag,
     }
 }
 
+/*****************************************************************************/
+/*                                 Bulk copies                               */
+/*****************************************************************************/
+
+/*
+ * Arrays of fixed dimensions over a pointer-free dtype are copied without
+ * recursion.  Adjacent dimensions that are contiguous in both source and
+ * destination are merged, the innermost remaining dimension is copied in a
+ * single run and the outer dimensions become a strided loop over runs.
+ * Validity bits of optional dtypes are copied along with the data.
+ *
+ * If the dtypes have the same memory representation, runs are copied with
+ * memmove().  Numeric dtypes in native byte order are converted with typed
+ * loops, see below.
+ */
+
+/*
+ * Convert 'n' elements with strides 'xs' and 'ys' (in elements).  Returns
+ * the index of the first element that fails the range or exactness check
+ * of the generic conversion functions above, or 'n' if all elements were
+ * converted.
+ */
+typedef int64_t (*bulk_conv_t)(char *y, const char *x, int64_t ys, int64_t xs,
+                               int64_t n);
+
+enum bulk_bits {
+  BitsNone,     /* dtype is not optional or both bitmaps are all valid */
+  BitsValid,    /* the source is all valid: set the destination bits */
+  BitsCopy      /* copy the source bits */
+};
+
+typedef struct {
+    int ndim;
+    int64_t shape[NDT_MAX_DIM];
+    int64_t xstep[NDT_MAX_DIM];
+    int64_t ystep[NDT_MAX_DIM];
+    const ndt_t *xtype;   /* source dtype */
+    const ndt_t *ytype;   /* destination dtype */
+    bulk_conv_t conv;     /* NULL if the representations are the same */
+    enum bulk_bits bits;
+    uint32_t flags;
+    bool tile;            /* copy the last two dimensions in tiles */
+} bulk_t;
+
+/* True if a dtype can be copied byte by byte. */
+static bool
+bulk_same(const ndt_t *t, const ndt_t *u)
+{
+    if (t->tag != u->tag || t->datasize != u->datasize ||
+        le(t->flags) != le(u->flags)) {
+        return false;
+    }
+
+    switch (t->tag) {
+    case Bool:
+    case Int8: case Int16: case Int32: case Int64:
+    case Uint8: case Uint16: case Uint32: case Uint64:
+    case BFloat16: case Float16: case Float32: case Float64:
+    case BComplex32: case Complex32: case Complex64: case Complex128:
+        return true;
+    case FixedString:
+        return u->FixedString.size == t->FixedString.size &&
+               u->FixedString.encoding == t->FixedString.encoding;
+    case FixedBytes:
+        return u->FixedBytes.size == t->FixedBytes.size;
+    case Categorical:
+        return ndt_equal(t, u);
+    default:
+        return false;
+    }
+}
+
+
+/*
+ * Blocked numeric conversions.  Each block is first checked in a loop
+ * without early exits, which the compiler can vectorize, and then converted
+ * with plain casts.  Only a block that contains an offending element is
+ * processed element by element.  The checks are those of copy_int64(),
+ * copy_uint64() and copy_float64().
+ */
+
+#define BULK_BLOCK 256
+
+/*
+ * Older gcc versions do not vectorize at -O2.  With -ftrapping-math gcc
+ * does not if-convert the checks.  Neither option changes the results.
+ */
+#if defined(__GNUC__) && !defined(__clang__)
+  #define BULK_LOOP __attribute__((optimize("tree-vectorize", "no-trapping-math")))
+#else
+  #define BULK_LOOP
+#endif
+
+#define CHECK_INT(v, lo, hi) ((int64_t)(v) >= (lo) && (int64_t)(v) <= (hi))
+#define CHECK_UINT(v, hi) ((uint64_t)(v) <= (hi))
+#define CHECK_FLOAT32(v) (fabsf((float)(v)) <= FLT_MAX || !(fabs(v) <= DBL_MAX))
+#define CHECK_FLOAT_INT(v, T, lo, hi) \
+    ((double)(v) >= (double)(lo) && (double)(v) <= (double)(hi) && \
+     (double)(T)((double)(v) >= (double)(lo) && (double)(v) <= (double)(hi) ? \
+                 (double)(v) : 0.0) == (double)(v))
+
+#define BULK_CONV_LOOP(S, D, xs, ys, cond) \
+    for (int64_t i = 0; i < n; i += BULK_BLOCK) {                     \
+        const int64_t m = n-i < BULK_BLOCK ? n-i : BULK_BLOCK;        \
+        const S *s = (const S *)x + i*(xs);                           \
+        D *d = (D *)y + i*(ys);                                       \
+        bool ok = true;                                               \
+                                                                      \
+        for (int64_t k = 0; k < m; k++) {                             \
+            const S v = s[k*(xs)];                                    \
+            ok &= (cond);                                             \
+        }                                                             \
+                                                                      \
+        if (!ok) {                                                    \
+            for (int64_t k = 0; k < m; k++) {                         \
+                const S v = s[k*(xs)];                                \
+                if (!(cond)) {                                        \
+                    return i+k;                                       \
+                }                                                     \
+                d[k*(ys)] = (D)v;                                     \
+            }                                                         \
+        }                                                             \
+                                                                      \
+        for (int64_t k = 0; k < m; k++) {                             \
+            d[k*(ys)] = (D)s[k*(xs)];                                 \
+        }                                                             \
+    }
+
+#define BULK_CONV(sname, dname, S, D, cond) \
+static BULK_LOOP int64_t                                              \
+conv_##sname##_##dname(char *y, const char *x, int64_t ys, int64_t xs, \
+                       int64_t n)                                     \
+{                                                                     \
+    if (xs == 1 && ys == 1) {                                         \
+        BULK_CONV_LOOP(S, D, 1, 1, cond)                              \
+    }                                                                 \
+    else {                                                            \
+        BULK_CONV_LOOP(S, D, xs, ys, cond)                            \
+    }                                                                 \
+                                                                      \
+    return n;                                                         \
+}
+
+/* Conversions that cannot fail. */
+#define BULK_WIDEN(sname, dname, S, D) \
+static BULK_LOOP int64_t                                              \
+conv_##sname##_##dname(char *y, const char *x, int64_t ys, int64_t xs, \
+                       int64_t n)                                     \
+{                                                                     \
+    const S *s = (const S *)x;                                        \
+    D *d = (D *)y;                                                    \
+                                                                      \
+    if (xs == 1 && ys == 1) {                                         \
+        for (int64_t k = 0; k < n; k++) {                             \
+            d[k] = (D)s[k];                                           \
+        }                                                             \
+    }                                                                 \
+    else {                                                            \
+        for (int64_t k = 0; k < n; k++) {                             \
+            d[k*ys] = (D)s[k*xs];                                     \
+        }                                                             \
+    }                                                                 \
+                                                                      \
+    return n;                                                         \
+}
+
+BULK_WIDEN(int8, int16, int8_t, int16_t)
+BULK_WIDEN(int8, int32, int8_t, int32_t)
+BULK_WIDEN(int8, int64, int8_t, int64_t)
+BULK_CONV(int8, uint8, int8_t, uint8_t, v >= 0)
+BULK_CONV(int8, uint16, int8_t, uint16_t, v >= 0)
+BULK_CONV(int8, uint32, int8_t, uint32_t, v >= 0)
+BULK_CONV(int8, uint64, int8_t, uint64_t, v >= 0)
+BULK_WIDEN(int8, float32, int8_t, float)
+BULK_WIDEN(int8, float64, int8_t, double)
+BULK_CONV(int16, int8, int16_t, int8_t, CHECK_INT(v, INT8_MIN, INT8_MAX))
+BULK_WIDEN(int16, int32, int16_t, int32_t)
+BULK_WIDEN(int16, int64, int16_t, int64_t)
+BULK_CONV(int16, uint8, int16_t, uint8_t, CHECK_INT(v, 0, UINT8_MAX))
+BULK_CONV(int16, uint16, int16_t, uint16_t, v >= 0)
+BULK_CONV(int16, uint32, int16_t, uint32_t, v >= 0)
+BULK_CONV(int16, uint64, int16_t, uint64_t, v >= 0)
+BULK_WIDEN(int16, float32, int16_t, float)
+BULK_WIDEN(int16, float64, int16_t, double)
+BULK_CONV(int32, int8, int32_t, int8_t, CHECK_INT(v, INT8_MIN, INT8_MAX))
+BULK_CONV(int32, int16, int32_t, int16_t, CHECK_INT(v, INT16_MIN, INT16_MAX))
+BULK_WIDEN(int32, int64, int32_t, int64_t)
+BULK_CONV(int32, uint8, int32_t, uint8_t, CHECK_INT(v, 0, UINT8_MAX))
+BULK_CONV(int32, uint16, int32_t, uint16_t, CHECK_INT(v, 0, UINT16_MAX))
+BULK_CONV(int32, uint32, int32_t, uint32_t, v >= 0)
+BULK_CONV(int32, uint64, int32_t, uint64_t, v >= 0)
+BULK_WIDEN(int32, float32, int32_t, float)
+BULK_WIDEN(int32, float64, int32_t, double)
+BULK_CONV(int64, int8, int64_t, int8_t, CHECK_INT(v, INT8_MIN, INT8_MAX))
+BULK_CONV(int64, int16, int64_t, int16_t, CHECK_INT(v, INT16_MIN, INT16_MAX))
+BULK_CONV(int64, int32, int64_t, int32_t, CHECK_INT(v, INT32_MIN, INT32_MAX))
+BULK_CONV(int64, uint8, int64_t, uint8_t, CHECK_INT(v, 0, UINT8_MAX))
+BULK_CONV(int64, uint16, int64_t, uint16_t, CHECK_INT(v, 0, UINT16_MAX))
+BULK_CONV(int64, uint32, int64_t, uint32_t, CHECK_INT(v, 0, UINT32_MAX))
+BULK_CONV(int64, uint64, int64_t, uint64_t, v >= 0)
+BULK_CONV(int64, float32, int64_t, float, CHECK_INT(v, -4503599627370496LL, 4503599627370496LL))
+BULK_CONV(int64, float64, int64_t, double, CHECK_INT(v, -4503599627370496LL, 4503599627370496LL))
+BULK_CONV(uint8, int8, uint8_t, int8_t, CHECK_UINT(v, INT8_MAX))
+BULK_WIDEN(uint8, int16, uint8_t, int16_t)
+BULK_WIDEN(uint8, int32, uint8_t, int32_t)
+BULK_WIDEN(uint8, int64, uint8_t, int64_t)
+BULK_WIDEN(uint8, uint16, uint8_t, uint16_t)
+BULK_WIDEN(uint8, uint32, uint8_t, uint32_t)
+BULK_WIDEN(uint8, uint64, uint8_t, uint64_t)
+BULK_WIDEN(uint8, float32, uint8_t, float)
+BULK_WIDEN(uint8, float64, uint8_t, double)
+BULK_CONV(uint16, int8, uint16_t, int8_t, CHECK_UINT(v, INT8_MAX))
+BULK_CONV(uint16, int16, uint16_t, int16_t, CHECK_UINT(v, INT16_MAX))
+BULK_WIDEN(uint16, int32, uint16_t, int32_t)
+BULK_WIDEN(uint16, int64, uint16_t, int64_t)
+BULK_CONV(uint16, uint8, uint16_t, uint8_t, CHECK_UINT(v, UINT8_MAX))
+BULK_WIDEN(uint16, uint32, uint16_t, uint32_t)
+BULK_WIDEN(uint16, uint64, uint16_t, uint64_t)
+BULK_WIDEN(uint16, float32, uint16_t, float)
+BULK_WIDEN(uint16, float64, uint16_t, double)
+BULK_CONV(uint32, int8, uint32_t, int8_t, CHECK_UINT(v, INT8_MAX))
+BULK_CONV(uint32, int16, uint32_t, int16_t, CHECK_UINT(v, INT16_MAX))
+BULK_CONV(uint32, int32, uint32_t, int32_t, CHECK_UINT(v, INT32_MAX))
+BULK_WIDEN(uint32, int64, uint32_t, int64_t)
+BULK_CONV(uint32, uint8, uint32_t, uint8_t, CHECK_UINT(v, UINT8_MAX))
+BULK_CONV(uint32, uint16, uint32_t, uint16_t, CHECK_UINT(v, UINT16_MAX))
+BULK_WIDEN(uint32, uint64, uint32_t, uint64_t)
+BULK_WIDEN(uint32, float32, uint32_t, float)
+BULK_WIDEN(uint32, float64, uint32_t, double)
+BULK_CONV(uint64, int8, uint64_t, int8_t, CHECK_UINT(v, INT8_MAX))
+BULK_CONV(uint64, int16, uint64_t, int16_t, CHECK_UINT(v, INT16_MAX))
+BULK_CONV(uint64, int32, uint64_t, int32_t, CHECK_UINT(v, INT32_MAX))
+BULK_CONV(uint64, int64, uint64_t, int64_t, CHECK_UINT(v, INT64_MAX))
+BULK_CONV(uint64, uint8, uint64_t, uint8_t, CHECK_UINT(v, UINT8_MAX))
+BULK_CONV(uint64, uint16, uint64_t, uint16_t, CHECK_UINT(v, UINT16_MAX))
+BULK_CONV(uint64, uint32, uint64_t, uint32_t, CHECK_UINT(v, UINT32_MAX))
+BULK_CONV(uint64, float32, uint64_t, float, CHECK_UINT(v, 4503599627370496ULL))
+BULK_CONV(uint64, float64, uint64_t, double, CHECK_UINT(v, 4503599627370496ULL))
+BULK_CONV(float32, int8, float, int8_t, CHECK_FLOAT_INT(v, int8_t, INT8_MIN, INT8_MAX))
+BULK_CONV(float32, int16, float, int16_t, CHECK_FLOAT_INT(v, int16_t, INT16_MIN, INT16_MAX))
+BULK_CONV(float32, int32, float, int32_t, CHECK_FLOAT_INT(v, int32_t, INT32_MIN, INT32_MAX))
+BULK_CONV(float32, int64, float, int64_t, CHECK_FLOAT_INT(v, int64_t, -4503599627370496LL, 4503599627370496LL))
+BULK_CONV(float32, uint8, float, uint8_t, CHECK_FLOAT_INT(v, uint8_t, 0, UINT8_MAX))
+BULK_CONV(float32, uint16, float, uint16_t, CHECK_FLOAT_INT(v, uint16_t, 0, UINT16_MAX))
+BULK_CONV(float32, uint32, float, uint32_t, CHECK_FLOAT_INT(v, uint32_t, 0, UINT32_MAX))
+BULK_CONV(float32, uint64, float, uint64_t, CHECK_FLOAT_INT(v, uint64_t, 0, 4503599627370496ULL))
+BULK_WIDEN(float32, float64, float, double)
+BULK_CONV(float64, int8, double, int8_t, CHECK_FLOAT_INT(v, int8_t, INT8_MIN, INT8_MAX))
+BULK_CONV(float64, int16, double, int16_t, CHECK_FLOAT_INT(v, int16_t, INT16_MIN, INT16_MAX))
+BULK_CONV(float64, int32, double, int32_t, CHECK_FLOAT_INT(v, int32_t, INT32_MIN, INT32_MAX))
+BULK_CONV(float64, int64, double, int64_t, CHECK_FLOAT_INT(v, int64_t, -4503599627370496LL, 4503599627370496LL))
+BULK_CONV(float64, uint8, double, uint8_t, CHECK_FLOAT_INT(v, uint8_t, 0, UINT8_MAX))
+BULK_CONV(float64, uint16, double, uint16_t, CHECK_FLOAT_INT(v, uint16_t, 0, UINT16_MAX))
+BULK_CONV(float64, uint32, double, uint32_t, CHECK_FLOAT_INT(v, uint32_t, 0, UINT32_MAX))
+BULK_CONV(float64, uint64, double, uint64_t, CHECK_FLOAT_INT(v, uint64_t, 0, 4503599627370496ULL))
+BULK_CONV(float64, float32, double, float, CHECK_FLOAT32(v))
+
+static const bulk_conv_t bulk_conv_table[10][10] = {
+  { NULL, conv_int8_int16, conv_int8_int32, conv_int8_int64,
+    conv_int8_uint8, conv_int8_uint16, conv_int8_uint32, conv_int8_uint64,
+    conv_int8_float32, conv_int8_float64 },
+  { conv_int16_int8, NULL, conv_int16_int32, conv_int16_int64,
+    conv_int16_uint8, conv_int16_uint16, conv_int16_uint32, conv_int16_uint64,
+    conv_int16_float32, conv_int16_float64 },
+  { conv_int32_int8, conv_int32_int16, NULL, conv_int32_int64,
+    conv_int32_uint8, conv_int32_uint16, conv_int32_uint32, conv_int32_uint64,
+    conv_int32_float32, conv_int32_float64 },
+  { conv_int64_int8, conv_int64_int16, conv_int64_int32, NULL,
+    conv_int64_uint8, conv_int64_uint16, conv_int64_uint32, conv_int64_uint64,
+    conv_int64_float32, conv_int64_float64 },
+  { conv_uint8_int8, conv_uint8_int16, conv_uint8_int32, conv_uint8_int64,
+    NULL, conv_uint8_uint16, conv_uint8_uint32, conv_uint8_uint64,
+    conv_uint8_float32, conv_uint8_float64 },
+  { conv_uint16_int8, conv_uint16_int16, conv_uint16_int32, conv_uint16_int64,
+    conv_uint16_uint8, NULL, conv_uint16_uint32, conv_uint16_uint64,
+    conv_uint16_float32, conv_uint16_float64 },
+  { conv_uint32_int8, conv_uint32_int16, conv_uint32_int32, conv_uint32_int64,
+    conv_uint32_uint8, conv_uint32_uint16, NULL, conv_uint32_uint64,
+    conv_uint32_float32, conv_uint32_float64 },
+  { conv_uint64_int8, conv_uint64_int16, conv_uint64_int32, conv_uint64_int64,
+    conv_uint64_uint8, conv_uint64_uint16, conv_uint64_uint32, NULL,
+    conv_uint64_float32, conv_uint64_float64 },
+  { conv_float32_int8, conv_float32_int16, conv_float32_int32, conv_float32_int64,
+    conv_float32_uint8, conv_float32_uint16, conv_float32_uint32, conv_float32_uint64,
+    NULL, conv_float32_float64 },
+  { conv_float64_int8, conv_float64_int16, conv_float64_int32, conv_float64_int64,
+    conv_float64_uint8, conv_float64_uint16, conv_float64_uint32, conv_float64_uint64,
+    conv_float64_float32, NULL }
+};
+
+static int
+bulk_conv_index(const ndt_t *t)
+{
+    if (!le(t->flags) != !le(0)) {  /* not in native byte order */
+        return -1;
+    }
+
+    switch (t->tag) {
+    case Int8: return 0;
+    case Int16: return 1;
+    case Int32: return 2;
+    case Int64: return 3;
+    case Uint8: return 4;
+    case Uint16: return 5;
+    case Uint32: return 6;
+    case Uint64: return 7;
+    case Float32: return 8;
+    case Float64: return 9;
+    default: return -1;
+    }
+}
+
+/*
+ * Set up the dtype part of 'b'.  Returns false if the generic path must be
+ * taken.
+ */
+static bool
+bulk_dtype(bulk_t *b, const xnd_t *y, const xnd_t *x, const ndt_t *t,
+           const ndt_t *u, uint32_t flags)
+{
+    if (ndt_is_optional(t) != ndt_is_optional(u)) {
+        return false;
+    }
+
+    if (bulk_same(t, u)) {
+        b->conv = NULL;
+    }
+    else {
+        const int i = bulk_conv_index(t);
+        const int j = bulk_conv_index(u);
+
+        /* The conversion loops access the data through typed pointers. */
+        if (i < 0 || j < 0 ||
+            (uintptr_t)x->ptr % (uintptr_t)t->align != 0 ||
+            (uintptr_t)y->ptr % (uintptr_t)u->align != 0) {
+            return false;
+        }
+
+        b->conv = bulk_conv_table[i][j];
+    }
+
+    b->xtype = t;
+    b->ytype = u;
+    b->flags = flags;
+
+    if (!ndt_is_optional(t)) {
+        b->bits = BitsNone;
+    }
+    else if (xnd_bitmap_all_valid(&x->bitmap)) {
+        b->bits = xnd_bitmap_all_valid(&y->bitmap) ? BitsNone : BitsValid;
+    }
+    else {
+        b->bits = BitsCopy;
+    }
+
+    return true;
+}
+
+static inline bool
+get_bit(const uint8_t *data, int64_t n)
+{
+    return data[n / 8] & ((uint8_t)1 << (n % 8));
+}
+
+static inline void
+put_bit(uint8_t *data, int64_t n, bool v)
+{
+    const uint8_t mask = (uint8_t)1 << (n % 8);
+
+    if (v) {
+        data[n / 8] |= mask;
+    }
+    else {
+        data[n / 8] &= (uint8_t)~mask;
+    }
+}
+
+static void
+bulk_move(char *yp, const char *xp, int64_t ys, int64_t xs, int64_t n,
+          int64_t d)
+{
+    if (xs == 1 && ys == 1) {
+        memmove(yp, xp, (size_t)(n * d));
+        return;
+    }
+
+    switch (d) {
+    case 1:
+        for (int64_t k = 0; k < n; k++) yp[k*ys] = xp[k*xs];
+        break;
+    case 2:
+        for (int64_t k = 0; k < n; k++) memcpy(yp+k*ys*2, xp+k*xs*2, 2);
+        break;
+    case 4:
+        for (int64_t k = 0; k < n; k++) memcpy(yp+k*ys*4, xp+k*xs*4, 4);
+        break;
+    case 8:
+        for (int64_t k = 0; k < n; k++) memcpy(yp+k*ys*8, xp+k*xs*8, 8);
+        break;
+    case 16:
+        for (int64_t k = 0; k < n; k++) memcpy(yp+k*ys*16, xp+k*xs*16, 16);
+        break;
+    default:
+        for (int64_t k = 0; k < n; k++) memcpy(yp+k*ys*d, xp+k*xs*d, (size_t)d);
+        break;
+    }
+}
+
+/*
+ * Copy the elements at the linear indices xi+k*xs to yi+k*ys for
+ * 0 <= k < n.  Elements rejected by a conversion loop go through the generic
+ * path, which either raises the error or handles an NA value.
+ */
+static int
+bulk_run(xnd_t *y, const xnd_t *x, const bulk_t *b, int64_t yi, int64_t xi,
+         int64_t ys, int64_t xs, int64_t n, ndt_context_t *ctx)
+{
+    const int64_t xd = b->xtype->datasize;
+    const int64_t yd = b->ytype->datasize;
+
+    if (b->conv == NULL) {
+        bulk_move(y->ptr + yi * yd, x->ptr + xi * xd, ys, xs, n, xd);
+    }
+    else {
+        int64_t k = 0;
+
+        while (1) {
+            k += b->conv(y->ptr + (yi+k*ys) * yd, x->ptr + (xi+k*xs) * xd,
+                         ys, xs, n-k);
+            if (k == n) {
+                break;
+            }
+
+            const xnd_t xnext = {x->bitmap, xi+k*xs, b->xtype, x->ptr + (xi+k*xs) * xd};
+            xnd_t ynext = {y->bitmap, yi+k*ys, b->ytype, y->ptr + (yi+k*ys) * yd};
+            if (xnd_copy_serial(&ynext, &xnext, b->flags, ctx) < 0) {
+                return -1;
+            }
+            k++;
+        }
+    }
+
+    switch (b->bits) {
+    case BitsValid:
+        for (int64_t k = 0; k < n; k++) {
+            put_bit(y->bitmap.data, yi+k*ys, true);
+        }
+        break;
+    case BitsCopy:
+        for (int64_t k = 0; k < n; k++) {
+            put_bit(y->bitmap.data, yi+k*ys, get_bit(x->bitmap.data, xi+k*xs));
+        }
+        break;
+    case BitsNone:
+        break;
+    }
+
+    return 0;
+}
+
+/*
+ * Transposed copies: if the source and the destination are contiguous along
+ * different dimensions, one of them is always read or written with a large
+ * stride.  These two dimensions are then copied in tiles.  Like in a
+ * cache-oblivious transpose, the tiles are halved recursively along the
+ * longer side, here until source and destination data fit into the L1
+ * cache together.  Every cache line on both sides is used completely before
+ * it is evicted.
+ */
+#define BULK_TILE 16384 /* bytes */
+
+static inline int64_t
+abs_step(int64_t step)
+{
+    return step < 0 ? -step : step;
+}
+
+/*
+ * If the innermost dimensions of source and destination differ, move the
+ * source's innermost dimension to position ndim-2 and the destination's to
+ * ndim-1 and return true.  The other dimensions are ordered by decreasing
+ * destination step.
+ */
+static bool
+bulk_permute(bulk_t *b)
+{
+    int perm[NDT_MAX_DIM];
+    int64_t shape[NDT_MAX_DIM];
+    int64_t xstep[NDT_MAX_DIM];
+    int64_t ystep[NDT_MAX_DIM];
+    int r = -1, c = -1;
+    int n = 0;
+
+    for (int i = 0; i < b->ndim; i++) {
+        if (b->shape[i] <= 1) {
+            continue;
+        }
+        if (r < 0 || abs_step(b->xstep[i]) < abs_step(b->xstep[r])) {
+            r = i;
+        }
+        if (c < 0 || abs_step(b->ystep[i]) < abs_step(b->ystep[c])) {
+            c = i;
+        }
+    }
+
+    if (r == c) {
+        return false;
+    }
+
+    for (int i = 0; i < b->ndim; i++) {
+        if (i == r || i == c) {
+            continue;
+        }
+
+        int k = n++;
+        while (k > 0 && abs_step(b->ystep[perm[k-1]]) < abs_step(b->ystep[i])) {
+            perm[k] = perm[k-1];
+            k--;
+        }
+        perm[k] = i;
+    }
+    perm[n++] = r;
+    perm[n++] = c;
+
+    for (int i = 0; i < n; i++) {
+        shape[i] = b->shape[perm[i]];
+        xstep[i] = b->xstep[perm[i]];
+        ystep[i] = b->ystep[perm[i]];
+    }
+
+    memcpy(b->shape, shape, n * sizeof *shape);
+    memcpy(b->xstep, xstep, n * sizeof *xstep);
+    memcpy(b->ystep, ystep, n * sizeof *ystep);
+
+    return true;
+}
+
+/* Copy an m x n tile of the last two dimensions. */
+static int
+bulk_tile(xnd_t *y, const xnd_t *x, const bulk_t *b, int64_t yi, int64_t xi,
+          int64_t m, int64_t n, ndt_context_t *ctx)
+{
+    const int r = b->ndim-2;
+    const int c = b->ndim-1;
+    const int64_t size = b->xtype->datasize + b->ytype->datasize;
+
+    if (m > 1 && n > 1 && m * n * size > BULK_TILE) {
+        if (m >= n) {
+            const int64_t h = m / 2;
+            if (bulk_tile(y, x, b, yi, xi, h, n, ctx) < 0) {
+                return -1;
+            }
+            return bulk_tile(y, x, b, yi+h*b->ystep[r], xi+h*b->xstep[r],
+                             m-h, n, ctx);
+        }
+        else {
+            const int64_t h = n / 2;
+            if (bulk_tile(y, x, b, yi, xi, m, h, ctx) < 0) {
+                return -1;
+            }
+            return bulk_tile(y, x, b, yi+h*b->ystep[c], xi+h*b->xstep[c],
+                             m, n-h, ctx);
+        }
+    }
+
+    for (int64_t k = 0; k < m; k++) {
+        if (bulk_run(y, x, b, yi+k*b->ystep[r], xi+k*b->xstep[r],
+                     b->ystep[c], b->xstep[c], n, ctx) < 0) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static int
+bulk_block(xnd_t *y, const xnd_t *x, const bulk_t *b, int dim, int64_t yi,
+           int64_t xi, ndt_context_t *ctx)
+{
+    if (b->tile && dim == b->ndim-2) {
+        return bulk_tile(y, x, b, yi, xi, b->shape[dim], b->shape[dim+1], ctx);
+    }
+
+    if (dim == b->ndim-1) {
+        return bulk_run(y, x, b, yi, xi, b->ystep[dim], b->xstep[dim],
+                        b->shape[dim], ctx);
+    }
+
+    for (int64_t k = 0; k < b->shape[dim]; k++) {
+        if (bulk_block(y, x, b, dim+1, yi+k*b->ystep[dim], xi+k*b->xstep[dim],
+                       ctx) < 0) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Copy a fixed dimension array in bulk.  Return 1 if the array was copied,
+ * 0 if the types do not qualify and the generic path must be taken, -1 on
+ * error.
+ */
+static int
+copy_fixed_bulk(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx)
+{
+    const ndt_t *t = x->type;
+    const ndt_t *u = y->type;
+    bulk_t b;
+    int ret;
+
+    b.ndim = 0;
+    while (t->tag == FixedDim) {
+        if (u->tag != FixedDim || u->FixedDim.shape != t->FixedDim.shape ||
+            ndt_is_optional(t) || ndt_is_optional(u)) {
+            return 0;
+        }
+
+        const int64_t n = t->FixedDim.shape;
+        const int64_t xs = t->Concrete.FixedDim.step;
+        const int64_t ys = u->Concrete.FixedDim.step;
+
+        if (b.ndim > 0 && b.xstep[b.ndim-1] == n * xs &&
+            b.ystep[b.ndim-1] == n * ys) {
+            b.shape[b.ndim-1] *= n;
+            b.xstep[b.ndim-1] = xs;
+            b.ystep[b.ndim-1] = ys;
+        }
+        else {
+            b.shape[b.ndim] = n;
+            b.xstep[b.ndim] = xs;
+            b.ystep[b.ndim] = ys;
+            b.ndim++;
+        }
+
+        t = t->FixedDim.type;
+        u = u->FixedDim.type;
+    }
+
+    if (!bulk_dtype(&b, y, x, t, u, flags)) {
+        return 0;
+    }
+
+    for (int i = 0; i < b.ndim; i++) {
+        if (b.shape[i] == 0) {
+            return 1;
+        }
+    }
+
+    b.tile = bulk_permute(&b);
+
+    ret = bulk_block(y, x, &b, 0, y->index, x->index, ctx);
+
+    if (b.bits != BitsNone) {
+        xnd_bitmap_invalidate(&y->bitmap);
+    }
+
+    return ret < 0 ? -1 : 1;
+}
+
+/* Copy the elements of a var dimension with a dtype in bulk, see above. */
+static int
+copy_var_bulk(xnd_t *y, const xnd_t *x, int64_t ystart, int64_t ystep,
+              int64_t xstart, int64_t xstep, int64_t shape, uint32_t flags,
+              ndt_context_t *ctx)
+{
+    bulk_t b;
+    int ret;
+
+    if (!bulk_dtype(&b, y, x, x->type->VarDim.type, y->type->VarDim.type,
+                    flags)) {
+        return 0;
+    }
+
+    b.ndim = 1;
+    b.tile = false;
+    ret = bulk_run(y, x, &b, ystart, xstart, ystep, xstep, shape, ctx);
+
+    if (b.bits != BitsNone) {
+        xnd_bitmap_invalidate(&y->bitmap);
+    }
+
+    return ret < 0 ? -1 : 1;
+}
+
+
+/*****************************************************************************/
+/*                                   Copy                                    */
+/*****************************************************************************/
+
+/* Set by libraries with a thread pool, see xnd_set_copy_thread(). */
+static xnd_copy_func_t copy_thread = NULL;
+
+void
+xnd_set_copy_thread(xnd_copy_func_t f)
+{
+    copy_thread = f;
+}
+
+/*
+ * Copy 'x' to 'y'.  Arrays are handed to the registered parallel copy
+ * function, which in turn calls xnd_copy_serial() on the parts.
+ */
 int
 xnd_copy(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx)
+{
+    if (copy_thread != NULL && y->type->tag == FixedDim) {
+        return copy_thread(y, x, flags, ctx);
+    }
+
+    return xnd_copy_serial(y, x, flags, ctx);
+}
+
+int
+xnd_copy_serial(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx)
 {
     APPLY_STORED_INDICES_INT(x)
     APPLY_STORED_INDICES_INT(y)
@@ -639,7 +1354,8 @@ xnd_copy(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx)
     const ndt_t * const u = y->type;
     int n;
 
-    if (xnd_is_na(x)) {
+    /* Bitmaps that are known to be all valid are neither read nor written. */
+    if (!xnd_bitmap_all_valid(&x->bitmap) && xnd_is_na(x)) {
         if (!ndt_is_optional(u)) {
             ndt_err_format(ctx, NDT_TypeError,
                 "cannot copy NA to destination with non-optional type");
@@ -650,7 +1366,7 @@ xnd_copy(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx)
         return 0;
     }
 
-    if (ndt_is_optional(u)) {
+    if (ndt_is_optional(u) && !xnd_bitmap_all_valid(&y->bitmap)) {
         xnd_set_valid(y);
     }
 
@@ -666,10 +1382,15 @@ xnd_copy(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx)
             return type_error(ctx);
         }
 
+        n = copy_fixed_bulk(y, x, flags, ctx);
+        if (n != 0) {
+            return n < 0 ? -1 : 0;
+        }
+
         for (i = 0; i < t->FixedDim.shape; i++) {
             const xnd_t xnext = xnd_fixed_dim_next(x, i);
             xnd_t ynext = xnd_fixed_dim_next(y, i);
-            n = xnd_copy(&ynext, &xnext, flags, ctx);
+            n = xnd_copy_serial(&ynext, &xnext, flags, ctx);
             if (n < 0) return n;
         }
 
@@ -699,10 +1420,18 @@ xnd_copy(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx)
             return type_error(ctx);
         }
 
+        if (t->VarDim.type->ndim == 0 && u->VarDim.type->ndim == 0) {
+            n = copy_var_bulk(y, x, ystart, ystep, xstart, xstep, xshape,
+                              flags, ctx);
+            if (n != 0) {
+                return n < 0 ? -1 : 0;
+            }
+        }
+
         for (i = 0; i < xshape; i++) {
             const xnd_t xnext = xnd_var_dim_next(x, xstart, xstep, i);
             xnd_t ynext = xnd_var_dim_next(y, ystart, ystep, i);
-            n = xnd_copy(&ynext, &xnext, flags, ctx);
+            n = xnd_copy_serial(&ynext, &xnext, flags, ctx);
             if (n < 0) return n;
         }
 
@@ -725,7 +1454,7 @@ xnd_copy(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx)
                 return -1;
             }
 
-            n = xnd_copy(&ynext, &xnext, flags, ctx);
+            n = xnd_copy_serial(&ynext, &xnext, flags, ctx);
             if (n < 0) return n;
         }
 
@@ -752,7 +1481,7 @@ xnd_copy(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx)
                 return -1;
             }
 
-            n = xnd_copy(&ynext, &xnext, flags, ctx);
+            n = xnd_copy_serial(&ynext, &xnext, flags, ctx);
             if (n < 0) return n;
         }
 
@@ -775,7 +1504,7 @@ xnd_copy(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx)
             return -1;
         }
 
-        return xnd_copy(&ynext, &xnext, flags, ctx);
+        return xnd_copy_serial(&ynext, &xnext, flags, ctx);
     }
 
     case Constr: {
@@ -793,7 +1522,7 @@ xnd_copy(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx)
             return -1;
         }
 
-        return xnd_copy(&ynext, &xnext, flags, ctx);
+        return xnd_copy_serial(&ynext, &xnext, flags, ctx);
     }
 
     case Nominal: {
@@ -815,7 +1544,7 @@ xnd_copy(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx)
             return -1;
         }
 
-        return xnd_copy(&ynext, &xnext, flags, ctx);
+        return xnd_copy_serial(&ynext, &xnext, flags, ctx);
     }
 
     case Categorical: {
@@ -1066,7 +1795,7 @@ xnd_copy(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx)
         for (int64_t i = 0; i < shape; i++) {
             const xnd_t xnext = xnd_array_next(x, i);
             xnd_t ynext = xnd_array_next(y, i);
-            n = xnd_copy(&ynext, &xnext, flags, ctx);
+            n = xnd_copy_serial(&ynext, &xnext, flags, ctx);
             if (n < 0) return n;
         }
 
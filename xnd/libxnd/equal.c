@@ -41,6 +41,259 @@
 #include "contrib.h"
 
 
+/*****************************************************************************/
+/*                              Bulk comparisons                             */
+/*****************************************************************************/
+
+/*
+ * Arrays of fixed dimensions over a numeric dtype are compared without
+ * recursion if both sides have the same dtype and no NA values.  Adjacent
+ * dimensions that are contiguous on both sides are merged like in copy.c.
+ *
+ * Contiguous integer runs are compared with memcmp().  All other runs are
+ * compared in blocks, and the comparison stops after the first block with a
+ * mismatch.  The loops over contiguous blocks are vectorized by the compiler
+ * (for 64-bit elements only if the target has 64-bit vector compares, e.g.
+ * with -mavx2).  Floating point values are compared with '==', so NaN is
+ * unequal to itself and -0.0 is equal to 0.0, exactly like in the
+ * element-wise comparisons below.
+ */
+
+#define EQUAL_BLOCK 256
+
+/* See the comment for BULK_LOOP in copy.c. */
+#if defined(__GNUC__) && !defined(__clang__)
+  #define EQUAL_LOOP __attribute__((optimize("tree-vectorize", "no-trapping-math")))
+#else
+  #define EQUAL_LOOP
+#endif
+
+/* Return true if 'n' elements with strides 'xs' and 'ys' are equal. */
+typedef bool (*equal_run_t)(const char *x, const char *y, int64_t xs,
+                            int64_t ys, int64_t n);
+
+#define EQUAL_RUN_LOOP(T, xs, ys) \
+    for (int64_t i = 0; i < n; i += EQUAL_BLOCK) {                       \
+        const int64_t m = n-i < EQUAL_BLOCK ? n-i : EQUAL_BLOCK;         \
+        const T *a = (const T *)x + i*(xs);                              \
+        const T *b = (const T *)y + i*(ys);                              \
+        int64_t ne = 0;                                                  \
+                                                                         \
+        for (int64_t k = 0; k < m; k++) {                                \
+            ne |= a[k*(xs)] != b[k*(ys)];                                \
+        }                                                                \
+                                                                         \
+        if (ne != 0) {                                                   \
+            return false;                                                \
+        }                                                                \
+    }
+
+#define EQUAL_RUN(name, T) \
+static EQUAL_LOOP bool                                                   \
+name(const char *x, const char *y, int64_t xs, int64_t ys, int64_t n)    \
+{                                                                        \
+    if (xs == 1 && ys == 1) {                                            \
+        EQUAL_RUN_LOOP(T, 1, 1)                                          \
+    }                                                                    \
+    else {                                                               \
+        EQUAL_RUN_LOOP(T, xs, ys)                                        \
+    }                                                                    \
+                                                                         \
+    return true;                                                         \
+}
+
+EQUAL_RUN(equal_run_uint8, uint8_t)
+EQUAL_RUN(equal_run_uint16, uint16_t)
+EQUAL_RUN(equal_run_uint32, uint32_t)
+EQUAL_RUN(equal_run_uint64, uint64_t)
+EQUAL_RUN(equal_run_float32, float)
+EQUAL_RUN(equal_run_float64, double)
+
+typedef struct {
+    int ndim;
+    int64_t shape[NDT_MAX_DIM];
+    int64_t xstep[NDT_MAX_DIM];
+    int64_t ystep[NDT_MAX_DIM];
+    int64_t size;         /* size of a component */
+    int64_t parts;        /* number of components: 2 for complex numbers */
+    bool bytes;           /* components can be compared with memcmp() */
+    equal_run_t run;
+} equal_bulk_t;
+
+/*
+ * Set up the dtype part of 'b'.  Returns false if the generic path must be
+ * taken.
+ */
+static bool
+equal_dtype(equal_bulk_t *b, const xnd_t *x, const xnd_t *y, const ndt_t *t,
+            const ndt_t *u)
+{
+    if (t->tag != u->tag || !le(t->flags) != !le(u->flags)) {
+        return false;
+    }
+
+    if ((ndt_is_optional(t) && !xnd_bitmap_all_valid(&x->bitmap)) ||
+        (ndt_is_optional(u) && !xnd_bitmap_all_valid(&y->bitmap))) {
+        return false;
+    }
+
+    b->parts = 1;
+    b->bytes = true;
+
+    switch (t->tag) {
+    case Bool:
+    case Int8: case Int16: case Int32: case Int64:
+    case Uint8: case Uint16: case Uint32: case Uint64:
+        b->size = t->datasize;
+        break;
+    case Complex64:
+        b->parts = 2;
+        /* fall through */
+    case Float32:
+        b->size = 4;
+        b->bytes = false;
+        break;
+    case Complex128:
+        b->parts = 2;
+        /* fall through */
+    case Float64:
+        b->size = 8;
+        b->bytes = false;
+        break;
+    default:
+        return false;
+    }
+
+    switch (b->size) {
+    case 1: b->run = equal_run_uint8; break;
+    case 2: b->run = equal_run_uint16; break;
+    case 4: b->run = b->bytes ? equal_run_uint32 : equal_run_float32; break;
+    case 8: b->run = b->bytes ? equal_run_uint64 : equal_run_float64; break;
+    default: return false;
+    }
+
+    /* The loops access the data through typed pointers. */
+    if ((!b->bytes && !le(t->flags) != !le(0)) ||
+        (uintptr_t)x->ptr % (uintptr_t)b->size != 0 ||
+        (uintptr_t)y->ptr % (uintptr_t)b->size != 0) {
+        return false;
+    }
+
+    return true;
+}
+
+/* Compare the elements at the linear indices xi+k*xs and yi+k*ys. */
+static bool
+equal_run(const xnd_t *x, const xnd_t *y, const equal_bulk_t *b, int64_t xi,
+          int64_t yi, int64_t xs, int64_t ys, int64_t n)
+{
+    const int64_t d = b->size * b->parts;
+    const char *xp = x->ptr + xi * d;
+    const char *yp = y->ptr + yi * d;
+
+    if (xs == 1 && ys == 1) {
+        if (b->bytes) {
+            return memcmp(xp, yp, (size_t)(n * d)) == 0;
+        }
+        return b->run(xp, yp, 1, 1, n * b->parts);
+    }
+
+    for (int64_t c = 0; c < b->parts; c++) {
+        if (!b->run(xp + c * b->size, yp + c * b->size, xs * b->parts,
+                    ys * b->parts, n)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool
+equal_block(const xnd_t *x, const xnd_t *y, const equal_bulk_t *b, int dim,
+            int64_t xi, int64_t yi)
+{
+    if (dim == b->ndim-1) {
+        return equal_run(x, y, b, xi, yi, b->xstep[dim], b->ystep[dim],
+                         b->shape[dim]);
+    }
+
+    for (int64_t k = 0; k < b->shape[dim]; k++) {
+        if (!equal_block(x, y, b, dim+1, xi+k*b->xstep[dim],
+                         yi+k*b->ystep[dim])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Compare fixed dimension arrays in bulk.  Returns false if the types do not
+ * qualify and the generic path must be taken.  Otherwise the result of the
+ * comparison is stored in 'equal'.
+ */
+static bool
+equal_fixed_bulk(int *equal, const xnd_t *x, const xnd_t *y)
+{
+    const ndt_t *t = x->type;
+    const ndt_t *u = y->type;
+    equal_bulk_t b;
+
+    b.ndim = 0;
+    while (t->tag == FixedDim) {
+        if (u->tag != FixedDim || u->FixedDim.shape != t->FixedDim.shape ||
+            t->FixedDim.shape == 0 || ndt_is_optional(t) ||
+            ndt_is_optional(u)) {
+            return false;
+        }
+
+        const int64_t n = t->FixedDim.shape;
+        const int64_t xs = t->Concrete.FixedDim.step;
+        const int64_t ys = u->Concrete.FixedDim.step;
+
+        if (b.ndim > 0 && b.xstep[b.ndim-1] == n * xs &&
+            b.ystep[b.ndim-1] == n * ys) {
+            b.shape[b.ndim-1] *= n;
+            b.xstep[b.ndim-1] = xs;
+            b.ystep[b.ndim-1] = ys;
+        }
+        else {
+            b.shape[b.ndim] = n;
+            b.xstep[b.ndim] = xs;
+            b.ystep[b.ndim] = ys;
+            b.ndim++;
+        }
+
+        t = t->FixedDim.type;
+        u = u->FixedDim.type;
+    }
+
+    if (!equal_dtype(&b, x, y, t, u)) {
+        return false;
+    }
+
+    *equal = equal_block(x, y, &b, 0, x->index, y->index);
+    return true;
+}
+
+/* Compare the elements of var dimensions with a dtype in bulk, see above. */
+static bool
+equal_var_bulk(int *equal, const xnd_t *x, const xnd_t *y, int64_t xstart,
+               int64_t xstep, int64_t ystart, int64_t ystep, int64_t shape)
+{
+    equal_bulk_t b;
+
+    if (shape == 0 || y->type->tag != VarDim ||
+        !equal_dtype(&b, x, y, x->type->VarDim.type, y->type->VarDim.type)) {
+        return false;
+    }
+
+    b.ndim = 1;
+    *equal = equal_run(x, y, &b, xstart, ystart, xstep, ystep, shape);
+    return true;
+}
+
+
 /*****************************************************************************/
 /*                      Equality with strict type checking                   */
 /*****************************************************************************/
@@ -70,6 +323,10 @@ xnd_strict_equal(const xnd_t *x, const xnd_t *y, ndt_context_t *ctx)
             return 0;
         }
 
+        if (equal_fixed_bulk(&n, x, y)) {
+            return n;
+        }
+
         for (i = 0; i < t->FixedDim.shape; i++) {
             const xnd_t xnext = xnd_fixed_dim_next(x, i);
             const xnd_t ynext = xnd_fixed_dim_next(y, i);
@@ -99,6 +356,10 @@ xnd_strict_equal(const xnd_t *x, const xnd_t *y, ndt_context_t *ctx)
             return 0;
         }
 
+        if (equal_var_bulk(&n, x, y, xstart, xstep, ystart, ystep, xshape)) {
+            return n;
+        }
+
         for (i = 0; i < xshape; i++) {
             const xnd_t xnext = xnd_var_dim_next(x, xstart, xstep, i);
             const xnd_t ynext = xnd_var_dim_next(y, ystart, ystep, i);
@@ -1007,6 +1268,10 @@ xnd_equal(const xnd_t *x, const xnd_t *y, ndt_context_t *ctx)
             return 0;
         }
 
+        if (equal_fixed_bulk(&n, x, y)) {
+            return n;
+        }
+
         for (i = 0; i < t->FixedDim.shape; i++) {
             const xnd_t xnext = xnd_fixed_dim_next(x, i);
             const xnd_t ynext = xnd_fixed_dim_next(y, i);
@@ -1040,6 +1305,10 @@ xnd_equal(const xnd_t *x, const xnd_t *y, ndt_context_t *ctx)
             return 0;
         }
 
+        if (equal_var_bulk(&n, x, y, xstart, xstep, ystart, ystep, xshape)) {
+            return n;
+        }
+
         for (i = 0; i < xshape; i++) {
             const xnd_t xnext = xnd_var_dim_next(x, xstart, xstep, i);
             const xnd_t ynext = xnd_var_dim_next(y, ystart, ystep, i);
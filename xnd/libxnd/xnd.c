@@ -57,7 +57,7 @@ static int xnd_init(xnd_t * const x, const uint32_t flags, ndt_context_t *ctx);
 
 /* error return value */
 const xnd_t xnd_error = {
-  .bitmap = {.data=NULL, .size=0, .next=NULL},
+  .bitmap = {.data=NULL, .size=0, .next=NULL, .summary=NULL},
   .index = 0,
   .type = NULL,
   .ptr = NULL
@@ -389,7 +389,7 @@ xnd_init(xnd_t * const x, const uint32_t flags, ndt_context_t *ctx)
 xnd_master_t *
 xnd_empty_from_string(const char *s, uint32_t flags, ndt_context_t *ctx)
 {
-    xnd_bitmap_t b = {.data=NULL, .size=0, .next=NULL};
+    xnd_bitmap_t b = {.data=NULL, .size=0, .next=NULL, .summary=NULL};
     xnd_master_t *x;
     const ndt_t *t;
     char *ptr;
@@ -448,7 +448,7 @@ xnd_empty_from_string(const char *s, uint32_t flags, ndt_context_t *ctx)
 xnd_master_t *
 xnd_empty_from_type(const ndt_t *t, uint32_t flags, ndt_context_t *ctx)
 {
-    xnd_bitmap_t b = {.data=NULL, .size=0, .next=NULL};
+    xnd_bitmap_t b = {.data=NULL, .size=0, .next=NULL, .summary=NULL};
     xnd_master_t *x;
     char *ptr;
 
@@ -1655,7 +1655,7 @@ xnd_subscript(const xnd_t *x, const xnd_index_t indices[], int len,
 const xnd_view_t xnd_view_error = {
   .flags = 0,
   .obj = NULL,
-  .view = { .bitmap = {.data=NULL, .size=0, .next=NULL},
+  .view = { .bitmap = {.data=NULL, .size=0, .next=NULL, .summary=NULL},
             .index = 0,
             .type = NULL,
             .ptr = NULL }
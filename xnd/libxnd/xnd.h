@@ -117,6 +117,17 @@ extern "C" {
 #define XND_UNION_TAG(ptr) (*((uint8_t *)ptr))
 
 
+/*
+ * Summary of a bitmap, shared by all views.  nna is the number of NA bits
+ * in the entire bitmap or -1 if unknown.  xnd_set_valid() and xnd_set_na()
+ * keep a known count up to date, functions that write the bits directly
+ * must call xnd_bitmap_invalidate().
+ */
+typedef struct {
+    int64_t nbits;      /* number of bits */
+    int64_t nna;        /* number of NA bits or -1 */
+} xnd_bitmap_summary_t;
+
 /* Bitmap tree. */
 typedef struct xnd_bitmap xnd_bitmap_t;
 
@@ -124,6 +135,7 @@ struct xnd_bitmap {
     uint8_t *data;      /* bitmap */
     int64_t size;       /* number of subtree bitmaps in the "next" array */
     xnd_bitmap_t *next; /* array of bitmaps for subtrees */
+    xnd_bitmap_summary_t *summary; /* summary of data, NULL if data is NULL */
 };
 
 /* Typed memory block, usually a view. */
@@ -200,6 +212,10 @@ XND_API int xnd_equal(const xnd_t *x, const xnd_t *y, ndt_context_t *ctx);
 XND_API int xnd_strict_equal(const xnd_t *x, const xnd_t *y, ndt_context_t *ctx);
 
 XND_API int xnd_copy(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx);
+XND_API int xnd_copy_serial(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx);
+
+typedef int (*xnd_copy_func_t)(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ctx);
+XND_API void xnd_set_copy_thread(xnd_copy_func_t f);
 
 
 /*****************************************************************************/
@@ -208,6 +224,7 @@ XND_API int xnd_copy(xnd_t *y, const xnd_t *x, uint32_t flags, ndt_context_t *ct
 
 XND_API int xnd_bounds_check(const ndt_t *t, const int64_t linear_index,
                              const int64_t bufsize, ndt_context_t *ctx);
+XND_API bool xnd_overlap(const xnd_t *x, const xnd_t *y);
 
 
 /*****************************************************************************/
@@ -217,6 +234,7 @@ XND_API int xnd_bounds_check(const ndt_t *t, const int64_t linear_index,
 XND_API int xnd_bitmap_init(xnd_bitmap_t *b, const ndt_t *t, ndt_context_t *ctx);
 XND_API void xnd_bitmap_clear(xnd_bitmap_t *b);
 XND_API xnd_bitmap_t xnd_bitmap_next(const xnd_t *x, int64_t i, ndt_context_t *ctx);
+XND_API int64_t xnd_bitmap_count_na(const xnd_bitmap_t *b);
 XND_API void xnd_set_valid(xnd_t *x);
 XND_API void xnd_set_na(xnd_t *x);
 XND_API int xnd_is_valid(const xnd_t *x);
@@ -280,6 +298,22 @@ int xnd_cuda_device_synchronize(ndt_context_t *ctx);
 /*                           Static inline functions                         */
 /*****************************************************************************/
 
+/* True if the bitmap is known to have no NA bits. */
+static inline bool
+xnd_bitmap_all_valid(const xnd_bitmap_t *b)
+{
+    return b->summary != NULL && b->summary->nna == 0;
+}
+
+/* Mark the NA count as unknown after writing bits directly. */
+static inline void
+xnd_bitmap_invalidate(const xnd_bitmap_t *b)
+{
+    if (b->summary != NULL && b->summary->nna != -1) {
+        b->summary->nna = -1;
+    }
+}
+
 /* Check index bounds and adjust negative indices. */
 static inline int64_t
 adjust_index(const int64_t i, const int64_t shape, ndt_context_t *ctx)
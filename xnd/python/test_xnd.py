@@ -32,6 +32,7 @@
 
 import sys, unittest, argparse
 from math import isinf, isnan
+from itertools import permutations
 from ndtypes import ndt, typedef
 from xnd import xnd, XndEllipsis, data_shapes
 from xnd._xnd import _test_view_subscript, _test_view_new
@@ -414,6 +415,63 @@ class TestFixedDim(XndTestCase):
         self.assertEqual(x, y)
         self.assertNotStrictEqual(x, y)
 
+    def test_fixed_dim_equal_bulk(self):
+        lst = [[(i * 37 + j) % 120 for j in range(300)] for i in range(20)]
+
+        for dtype in ["bool", "int8", "uint16", "int32", "uint64", "float32",
+                      "float64", "complex64", "complex128"]:
+            x = xnd(lst, dtype=dtype)
+            y = xnd(lst, dtype=dtype)
+            self.assertStrictEqual(x, y)
+            self.assertStrictEqual(x[::-1, 1::3], y[::-1, 1::3])
+            self.assertStrictEqual(x.transpose(), y.transpose())
+            self.assertNotStrictEqual(x[1:], y[:-1])
+
+            # A mismatch in the last element of a long run.
+            v = lst[-1][-1]
+            y[19, 299] = not v if dtype == "bool" else v + 1
+            self.assertNotStrictEqual(x, y)
+            self.assertNotEqual(x, y)
+            self.assertStrictEqual(x[:, :-1], y[:, :-1])
+
+        inf, nan = float("inf"), float("nan")
+        for dtype in ["float32", "float64"]:
+            x = xnd([1.5, -0.0, inf, 2.0] * 100, dtype=dtype)
+            y = xnd([1.5, 0.0, inf, 2.0] * 100, dtype=dtype)
+            self.assertStrictEqual(x, y)
+
+            x[350] = nan
+            y[350] = nan
+            self.assertNotStrictEqual(x, y)
+            self.assertNotEqual(x, y)
+            self.assertNotStrictEqual(x, x)
+            self.assertStrictEqual(x[:350], y[:350])
+
+        x = xnd([complex(1, -0.0)] * 300, dtype="complex128")
+        y = xnd([complex(1, 0.0)] * 300, dtype="complex128")
+        self.assertStrictEqual(x, y)
+        y[299] = complex(1, nan)
+        self.assertNotStrictEqual(x, y)
+
+        # NA values are never equal.
+        x = xnd([1, 2, None, 4] * 100, dtype="?int64")
+        y = xnd([1, 2, None, 4] * 100, dtype="?int64")
+        self.assertNotStrictEqual(x, y)
+        self.assertNotEqual(x, y)
+        self.assertStrictEqual(x[::4], y[::4])
+
+        # Different byte orders compare values.
+        x = xnd([1, 2, 3] * 100, type="300 * <int32")
+        y = xnd([1, 2, 3] * 100, type="300 * >int32")
+        self.assertStrictEqual(x, y)
+
+        x = xnd([[1, 2, 3], [4, 5]] * 100, dtype="float64")
+        y = xnd([[1, 2, 3], [4, 5]] * 100, dtype="float64")
+        self.assertStrictEqual(x, y)
+        y[199, 1] = -1
+        self.assertNotStrictEqual(x, y)
+        self.assertStrictEqual(x[::2], y[::2])
+
 
 class TestFortran(XndTestCase):
 
@@ -3801,6 +3859,130 @@ class TestCopy(XndTestCase):
         x = xnd([1, 2, 2**63-1], dtype="int64")
         self.assertRaises(ValueError, x.copy_contiguous, dtype="int8")
 
+    def test_copy_bulk(self):
+        lst = [[[20*i + 5*j + k for k in range(5)] for j in range(4)] for i in range(3)]
+
+        for dtype in ["int8", "uint16", "int32", "float64", "complex128"]:
+            x = xnd(lst, dtype=dtype)
+
+            # contiguous, strided, reversed and transposed views
+            for v in [x, x[1:], x[:, ::2], x[::-1, :, ::-2], x[:, 1, :],
+                      x.transpose(), x[::2].transpose((1, 0, 2))]:
+                y = v.copy_contiguous()
+                self.assertEqual(y, v)
+                self.assertEqual(y.value, v.value)
+
+        x = xnd([[1, None, 3], [None, 5, 6]], dtype="?int64")
+        for v in [x, x[::-1], x[:, ::-1], x.transpose()]:
+            y = v.copy_contiguous()
+            self.assertEqual(y.value, v.value)
+
+        x = xnd([[1, 2, 3], [4, 5, 6]], dtype="?float32")
+        y = x[::-1].copy_contiguous()
+        self.assertEqual(y.value, [[4, 5, 6], [1, 2, 3]])
+
+        x = xnd([["a", "b"], ["c", "d"]], type="2 * 2 * fixed_string(3)")
+        y = x[:, ::-1].copy_contiguous()
+        self.assertEqual(y.value, [["b", "a"], ["d", "c"]])
+
+        x = xnd([[1, 2, 3], [4], [5, None]], dtype="?int64")
+        for v in [x, x[1:], x[::-1], x[:, ::-1]]:
+            y = v.copy_contiguous()
+            self.assertEqual(y.value, v.value)
+
+    def test_copy_bulk_setitem(self):
+        x = xnd([[1, 2, 3], [4, 5, 6]], dtype="int64")
+        y = xnd.empty("2 * 3 * int64")
+        y[:] = x
+        self.assertEqual(y, x)
+
+        y[0] = x[1, ::-1]
+        self.assertEqual(y.value, [[6, 5, 4], [4, 5, 6]])
+
+        y = xnd.empty("2 * 3 * ?int64")
+        y[:] = xnd([[1, None, 3], [None, 5, None]], dtype="?int64")
+        self.assertEqual(y.value, [[1, None, 3], [None, 5, None]])
+
+        y[1] = xnd([7, 8, 9], dtype="?int64")
+        self.assertEqual(y.value, [[1, None, 3], [7, 8, 9]])
+
+    def test_copy_bulk_convert(self):
+        lst = [[(7*i + 3*j) % 128 for j in range(20)] for i in range(30)]
+        dtypes = ["int8", "int16", "int32", "int64", "uint8", "uint16",
+                  "uint32", "uint64", "float32", "float64"]
+
+        for src in dtypes:
+            x = xnd(lst, dtype=src)
+            for dest in dtypes:
+                for v in [x, x[::-1], x[:, ::3], x[1::2, ::-2]]:
+                    y = xnd.empty("%d * %d * %s" % (len(v), len(v[0]), dest))
+                    y[:] = v
+                    self.assertEqual(y.value, v.value)
+
+        x = xnd([[1, None, 3], [None, 5, 6]], dtype="?int32")
+        for dest in ["?int64", "?uint8", "?float64"]:
+            y = xnd.empty("2 * 3 * %s" % dest)
+            y[:] = x[:, ::-1]
+            self.assertEqual(y.value, [[3, None, 1], [6, 5, None]])
+
+        # The first offending element is reported after the elements
+        # before it have been copied.
+        x = xnd(list(range(1000)), dtype="int32")
+        y = xnd.empty("1000 * int8")
+        self.assertRaises(ValueError, y.__setitem__, slice(None), x)
+        self.assertEqual(y[:128].value, list(range(128)))
+
+        for src, dest, value in [("int64", "uint16", -1),
+                                 ("uint64", "int64", 2**63),
+                                 ("float64", "int64", 2.5),
+                                 ("float64", "float32", 1e300),
+                                 ("float32", "uint8", -1.0)]:
+            x = xnd([1, 2, value, 4], dtype=src)
+            y = xnd.empty("4 * %s" % dest)
+            self.assertRaises(ValueError, y.__setitem__, slice(None), x)
+
+        x = xnd([1.5, float("inf"), float("nan")], dtype="float64")
+        y = xnd.empty("3 * float32")
+        y[:] = x
+        self.assertEqual(y[0], 1.5)
+        self.assertEqual(y[1], float("inf"))
+        self.assertTrue(isnan(y[2].value))
+
+    def test_copy_transpose(self):
+        lst = [[(i * 131 + j) % 100 for j in range(150)] for i in range(170)]
+        expected = [list(r) for r in zip(*lst)]
+
+        for dtype in ["uint8", "int32", "float64", "complex128"]:
+            x = xnd(lst, dtype=dtype)
+            y = x.transpose().copy_contiguous()
+            self.assertEqual(y.value, expected)
+
+            y = xnd.empty("150 * 170 * int64")
+            y.transpose()[:] = xnd(expected, dtype=dtype).transpose()
+            self.assertEqual(y.value, expected)
+
+        x = xnd(lst, dtype="int16")
+        y = x[::-2, 3::5].transpose().copy_contiguous(dtype="float64")
+        self.assertEqual(y.value, [r[::-2] for r in expected[3::5]])
+
+        lst = [[[i*40*30 + j*30 + k for k in range(30)] for j in range(40)]
+               for i in range(50)]
+        x = xnd(lst, dtype="int32")
+        for p in permutations(range(3)):
+            y = x.transpose(p).copy_contiguous()
+            self.assertEqual(y.type.shape, tuple(x.type.shape[i] for i in p))
+            for idx in [(0, 0, 0), (1, 2, 3), (17, 13, 11), (-1, -1, -1)]:
+                self.assertEqual(y[idx], x[tuple(idx[p.index(i)] for i in range(3))])
+
+        x = xnd([[None if (i + j) % 7 == 0 else i*100 + j for j in range(100)]
+                 for i in range(90)], dtype="?int64")
+        y = x.transpose().copy_contiguous()
+        self.assertEqual(y.value, [list(r) for r in zip(*x.value)])
+
+        x = xnd([[i * j for j in range(100)] for i in range(100)], dtype="int64")
+        y = xnd.empty("100 * 100 * int8")
+        self.assertRaises(ValueError, y.__setitem__, slice(None), x.transpose())
+
 
 class TestSpec(XndTestCase):
 
@@ -210,6 +210,12 @@ class array(xnd):
     _functions = None
     _cuda = None
     _np = None
+    # Set by gumath for deferred evaluation.  '_recorder' is only set while
+    # a gumath.deferred() context is active.  Operations with deferred
+    # operands return NotImplemented, so that the reflected operators of
+    # the deferred types build the expression.
+    _recorder = None
+    _deferred_types = ()
 
     @property
     def shape(self):
@@ -249,6 +255,8 @@ class array(xnd):
             if other.device != self.device:
                 raise NotImplementedError("arrays must be on the same device")
             return other
+        if isinstance(other, array._deferred_types):
+            return NotImplemented
         try:
             return _convert_smallest(other, device=self.device)
         except TypeError:
@@ -257,10 +265,20 @@ class array(xnd):
             return NotImplemented
 
     def _call_unary(self, name, out=None):
+        if array._recorder is not None:
+            x = array._recorder(name, (self,), out)
+            if x is not NotImplemented:
+                return x
         m = self._get_module()
         return getattr(m, name)(self, out=out, cls=array)
 
     def _call_binary(self, name, other, out=None, raiseit=False):
+        if array._recorder is not None:
+            x = array._recorder(name, (self, other), out)
+            if x is not NotImplemented:
+                return x
+        if isinstance(other, array._deferred_types):
+            return NotImplemented
         other = self._convert(other, raiseit)
         m = self._get_module()
         return getattr(m, name)(self, other, out=out, cls=array)
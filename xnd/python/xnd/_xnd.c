@@ -343,6 +343,7 @@ mblock_from_buffer(PyObject *obj)
     self->xnd->master.bitmap.data = NULL;
     self->xnd->master.bitmap.size = 0;
     self->xnd->master.bitmap.next = NULL;
+    self->xnd->master.bitmap.summary = NULL;
     self->xnd->master.index = 0;
     self->xnd->master.type = NDT(self->type);
     self->xnd->master.ptr = self->view->buf;
@@ -408,6 +409,7 @@ mblock_from_buffer_and_type(PyObject *obj, PyObject *type, int64_t linear_index,
     self->xnd->master.bitmap.data = NULL;
     self->xnd->master.bitmap.size = 0;
     self->xnd->master.bitmap.next = NULL;
+    self->xnd->master.bitmap.summary = NULL;
     self->xnd->master.index = linear_index;
     self->xnd->master.type = t;
     self->xnd->master.ptr = self->view->buf;
@@ -1348,6 +1350,7 @@ pyxnd_alloc(PyTypeObject *type)
     self->xnd.bitmap.data = NULL;
     self->xnd.bitmap.size = 0;
     self->xnd.bitmap.next = NULL;
+    self->xnd.bitmap.summary = NULL;
     self->xnd.index = 0;
     self->xnd.type  = NULL;
     self->xnd.ptr = NULL;
@@ -2609,6 +2612,22 @@ pyxnd_strict_equal(PyObject *self, PyObject *other)
     return res;
 }
 
+static PyObject *
+pyxnd_overlaps(PyObject *self, PyObject *other)
+{
+    PyObject *res;
+
+    if (!Xnd_Check(other)) {
+        PyErr_SetString(PyExc_TypeError,
+            "_overlaps requires an xnd argument");
+        return NULL;
+    }
+
+    res = xnd_overlap(XND(self), XND(other)) ? Py_True : Py_False;
+    Py_INCREF(res);
+    return res;
+}
+
 static PyObject *
 pyxnd_type(PyObject *self, PyObject *args UNUSED)
 {
@@ -2932,6 +2951,7 @@ static PyMethodDef pyxnd_methods [] =
   /* Methods */
   { "short_value", (PyCFunction)pyxnd_short_value, METH_VARARGS|METH_KEYWORDS, doc_short_value },
   { "strict_equal", (PyCFunction)pyxnd_strict_equal, METH_O, NULL },
+  { "_overlaps", (PyCFunction)pyxnd_overlaps, METH_O, NULL },
   { "copy_contiguous", (PyCFunction)pyxnd_copy_contiguous, METH_VARARGS|METH_KEYWORDS, NULL },
   { "split", (PyCFunction)pyxnd_split, METH_VARARGS|METH_KEYWORDS, NULL },
   { "transpose", (PyCFunction)pyxnd_transpose, METH_VARARGS|METH_KEYWORDS, NULL },